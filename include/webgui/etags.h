@@ -0,0 +1,9 @@
+// ETags of the Web GUI assets built into the firmware - generated by scripts/webgui.py, do not edit
+#pragma once
+
+#define ETAG_INDEXHTM "\"507fd72a5d860a66\""
+#define ETAG_KEYSHTM "\"e9ab8ad3da8ff9bf\""
+#define ETAG_NRELOGO "\"5f24e94332111e0c\""
+#define ETAG_NRICON "\"e76b63c55be82547\""
+#define ETAG_FAVICONPNG "\"c9dbd7d24c8514cc\""
+#define ETAG_BTLOGO "\"168d544e503f21b7\""
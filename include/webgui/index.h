@@ -4,1393 +4,373 @@
 #define WEBAPPVER_MINOR 0
 
 static const uint8_t indexhtm[] PROGMEM={
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x68, 0x74, 0x6D,
-0x6C, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0D,
-0x0A, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65, 0x65,
-0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x64, 0x6E, 0x2E,
-0x6A, 0x73, 0x64, 0x65, 0x6C, 0x69, 0x76, 0x72, 0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x6E, 0x70, 0x6D, 0x2F, 0x62, 0x6F, 0x6F, 0x74,
-0x73, 0x74, 0x72, 0x61, 0x70, 0x40, 0x33, 0x2E, 0x34, 0x2E, 0x31, 0x2F, 0x64, 0x69, 0x73, 0x74, 0x2F, 0x63, 0x73, 0x73, 0x2F,
-0x62, 0x6F, 0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70, 0x2E, 0x6D, 0x69, 0x6E, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x69, 0x6E,
-0x74, 0x65, 0x67, 0x72, 0x69, 0x74, 0x79, 0x3D, 0x22, 0x73, 0x68, 0x61, 0x33, 0x38, 0x34, 0x2D, 0x48, 0x53, 0x4D, 0x78, 0x63,
-0x52, 0x54, 0x52, 0x78, 0x6E, 0x4E, 0x2B, 0x42, 0x64, 0x67, 0x30, 0x4A, 0x64, 0x62, 0x78, 0x59, 0x4B, 0x72, 0x54, 0x68, 0x65,
-0x63, 0x4F, 0x4B, 0x75, 0x48, 0x35, 0x7A, 0x43, 0x59, 0x6F, 0x74, 0x6C, 0x53, 0x41, 0x63, 0x70, 0x31, 0x2B, 0x63, 0x38, 0x78,
-0x6D, 0x79, 0x54, 0x65, 0x39, 0x47, 0x59, 0x67, 0x31, 0x6C, 0x39, 0x61, 0x36, 0x39, 0x70, 0x73, 0x75, 0x22, 0x20, 0x63, 0x72,
-0x6F, 0x73, 0x73, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x3D, 0x22, 0x61, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x22,
-0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73,
-0x3A, 0x2F, 0x2F, 0x61, 0x6A, 0x61, 0x78, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x61, 0x70, 0x69, 0x73, 0x2E, 0x63, 0x6F,
-0x6D, 0x2F, 0x61, 0x6A, 0x61, 0x78, 0x2F, 0x6C, 0x69, 0x62, 0x73, 0x2F, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x2F, 0x33, 0x2E,
-0x37, 0x2E, 0x31, 0x2F, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x2E, 0x6D, 0x69, 0x6E, 0x2E, 0x6A, 0x73, 0x22, 0x3E, 0x3C, 0x2F,
-0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D,
-0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x64, 0x6E, 0x2E, 0x6A, 0x73, 0x64, 0x65, 0x6C, 0x69, 0x76, 0x72,
-0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x6E, 0x70, 0x6D, 0x2F, 0x62, 0x6F, 0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70, 0x40, 0x33, 0x2E,
-0x34, 0x2E, 0x31, 0x2F, 0x64, 0x69, 0x73, 0x74, 0x2F, 0x6A, 0x73, 0x2F, 0x62, 0x6F, 0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70,
-0x2E, 0x6D, 0x69, 0x6E, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x72, 0x69, 0x74, 0x79, 0x3D, 0x22, 0x73,
-0x68, 0x61, 0x33, 0x38, 0x34, 0x2D, 0x61, 0x4A, 0x32, 0x31, 0x4F, 0x6A, 0x6C, 0x4D, 0x58, 0x4E, 0x4C, 0x35, 0x55, 0x79, 0x49,
-0x6C, 0x2F, 0x58, 0x4E, 0x77, 0x54, 0x4D, 0x71, 0x76, 0x7A, 0x65, 0x52, 0x4D, 0x5A, 0x48, 0x32, 0x77, 0x38, 0x63, 0x35, 0x63,
-0x52, 0x56, 0x70, 0x7A, 0x70, 0x55, 0x38, 0x59, 0x35, 0x62, 0x41, 0x70, 0x54, 0x70, 0x70, 0x53, 0x75, 0x55, 0x6B, 0x68, 0x5A,
-0x58, 0x4E, 0x30, 0x56, 0x78, 0x48, 0x64, 0x22, 0x20, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x3D,
-0x22, 0x61, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E,
-0x0D, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A,
-0x2F, 0x2F, 0x63, 0x64, 0x6E, 0x6A, 0x73, 0x2E, 0x63, 0x6C, 0x6F, 0x75, 0x64, 0x66, 0x6C, 0x61, 0x72, 0x65, 0x2E, 0x63, 0x6F,
-0x6D, 0x2F, 0x61, 0x6A, 0x61, 0x78, 0x2F, 0x6C, 0x69, 0x62, 0x73, 0x2F, 0x62, 0x6F, 0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70,
-0x2D, 0x33, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x61, 0x68, 0x65, 0x61, 0x64, 0x2F, 0x34, 0x2E, 0x30, 0x2E, 0x32, 0x2F, 0x62, 0x6F,
-0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70, 0x33, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x61, 0x68, 0x65, 0x61, 0x64, 0x2E, 0x6D, 0x69,
-0x6E, 0x2E, 0x6A, 0x73, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x6D, 0x65, 0x74,
-0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D, 0x38, 0x22, 0x3E, 0x0D, 0x0A, 0x3C,
-0x6D, 0x65, 0x74, 0x61, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x20,
-0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x75, 0x73, 0x65, 0x72, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x61, 0x62, 0x6C,
-0x65, 0x3D, 0x6E, 0x6F, 0x2C, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x3D, 0x31,
-0x2C, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x3D, 0x31, 0x2C, 0x20, 0x6D, 0x69,
-0x6E, 0x69, 0x6D, 0x75, 0x6D, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x3D, 0x31, 0x2C, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D,
-0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6D, 0x65, 0x74, 0x61,
-0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x6D, 0x6F, 0x62, 0x69, 0x6C, 0x65, 0x2D, 0x77,
-0x65, 0x62, 0x2D, 0x61, 0x70, 0x70, 0x2D, 0x63, 0x61, 0x70, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65,
-0x6E, 0x74, 0x3D, 0x22, 0x79, 0x65, 0x73, 0x22, 0x2F, 0x3E, 0x0D, 0x0A, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x6E, 0x61, 0x6D,
-0x65, 0x3D, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x6D, 0x6F, 0x62, 0x69, 0x6C, 0x65, 0x2D, 0x77, 0x65, 0x62, 0x2D, 0x61,
-0x70, 0x70, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2D, 0x62, 0x61, 0x72, 0x2D, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x22, 0x20,
-0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x22, 0x2F, 0x3E, 0x0D, 0x0A,
-0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x74, 0x6F, 0x75, 0x63,
-0x68, 0x2D, 0x69, 0x63, 0x6F, 0x6E, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x66, 0x61, 0x76, 0x69, 0x63, 0x6F, 0x6E,
-0x2E, 0x70, 0x6E, 0x67, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x69, 0x63,
-0x6F, 0x6E, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x66, 0x61, 0x76, 0x69, 0x63, 0x6F, 0x6E, 0x2E, 0x70, 0x6E, 0x67,
-0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2F, 0x70, 0x6E, 0x67, 0x22, 0x2F, 0x3E, 0x0D,
-0x0A, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x54, 0x69, 0x6E, 0x79, 0x20, 0x44, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72,
-0x65, 0x73, 0x20, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x68,
-0x65, 0x61, 0x64, 0x3E, 0x0D, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74,
-0x79, 0x6C, 0x65, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x6D, 0x69, 0x6E, 0x28, 0x39, 0x30, 0x25, 0x2C, 0x20,
-0x35, 0x30, 0x30, 0x70, 0x78, 0x29, 0x3B, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x20, 0x61, 0x75, 0x74,
-0x6F, 0x3B, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x20, 0x35, 0x70, 0x78, 0x3B, 0x22, 0x3E, 0x0D,
-0x0A, 0x3C, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E,
-0x67, 0x73, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x65, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x65,
-0x67, 0x65, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
-0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3B, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E,
-0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x20, 0x6D, 0x69, 0x6E, 0x2D, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A,
-0x20, 0x34, 0x35, 0x70, 0x78, 0x3B, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x38, 0x70,
-0x78, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x72, 0x54, 0x22, 0x20, 0x73,
-0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3E, 0x52,
-0x61, 0x69, 0x6C, 0x20, 0x44, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x3C,
-0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x75, 0x73, 0x54, 0x22,
-0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22,
-0x3E, 0x42, 0x75, 0x73, 0x20, 0x44, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x42, 0x6F, 0x61, 0x72, 0x64,
-0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x64,
-0x72, 0x6F, 0x70, 0x64, 0x6F, 0x77, 0x6E, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x70, 0x6F, 0x73, 0x69, 0x74,
-0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x20, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x35,
-0x70, 0x78, 0x3B, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x30, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x62, 0x75, 0x74,
-0x74, 0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x20, 0x62, 0x74, 0x6E, 0x2D, 0x64, 0x65,
-0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x64, 0x72, 0x6F, 0x70, 0x64, 0x6F, 0x77, 0x6E, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65,
-0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6D,
-0x65, 0x6E, 0x75, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C,
-0x65, 0x3D, 0x22, 0x64, 0x72, 0x6F, 0x70, 0x64, 0x6F, 0x77, 0x6E, 0x22, 0x20, 0x61, 0x72, 0x69, 0x61, 0x2D, 0x68, 0x61, 0x73,
-0x70, 0x6F, 0x70, 0x75, 0x70, 0x3D, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x20, 0x61, 0x72, 0x69, 0x61, 0x2D, 0x65, 0x78, 0x70,
-0x61, 0x6E, 0x64, 0x65, 0x64, 0x3D, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x3E, 0x0D, 0x0A, 0x26, 0x23, 0x39, 0x37, 0x37, 0x36,
-0x3B, 0x0D, 0x0A, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x75, 0x6C, 0x20, 0x63, 0x6C, 0x61,
-0x73, 0x73, 0x3D, 0x22, 0x64, 0x72, 0x6F, 0x70, 0x64, 0x6F, 0x77, 0x6E, 0x2D, 0x6D, 0x65, 0x6E, 0x75, 0x20, 0x64, 0x72, 0x6F,
-0x70, 0x64, 0x6F, 0x77, 0x6E, 0x2D, 0x6D, 0x65, 0x6E, 0x75, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x61, 0x72, 0x69,
-0x61, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x6C, 0x65, 0x64, 0x62, 0x79, 0x3D, 0x22, 0x6D, 0x65, 0x6E, 0x75, 0x42, 0x75, 0x74,
-0x74, 0x6F, 0x6E, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x69, 0x3E, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23,
-0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x68, 0x65, 0x63,
-0x6B, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x28, 0x29, 0x22, 0x3E, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x66, 0x6F, 0x72,
-0x20, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x3C, 0x2F, 0x61, 0x3E, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C,
-0x69, 0x3E, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x2F, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0x68, 0x74, 0x6D, 0x22,
-0x3E, 0x45, 0x64, 0x69, 0x74, 0x20, 0x41, 0x50, 0x49, 0x20, 0x4B, 0x65, 0x79, 0x73, 0x3C, 0x2F, 0x61, 0x3E, 0x3C, 0x2F, 0x6C,
-0x69, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x69, 0x3E, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x22, 0x20, 0x6F,
-0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x57, 0x69,
-0x66, 0x69, 0x28, 0x29, 0x22, 0x3E, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x53, 0x65, 0x74, 0x74,
-0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x61, 0x3E, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x69, 0x3E, 0x3C, 0x61,
-0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x68, 0x61,
-0x6E, 0x64, 0x6C, 0x65, 0x53, 0x68, 0x6F, 0x77, 0x54, 0x65, 0x73, 0x74, 0x43, 0x61, 0x72, 0x64, 0x28, 0x29, 0x22, 0x3E, 0x44,
-0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x41, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x3C, 0x2F, 0x61, 0x3E, 0x3C,
-0x2F, 0x6C, 0x69, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x69, 0x3E, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x22,
-0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x52, 0x65, 0x73, 0x74, 0x61,
-0x72, 0x74, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x53,
-0x79, 0x73, 0x74, 0x65, 0x6D, 0x3C, 0x2F, 0x61, 0x3E, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x75, 0x6C, 0x3E,
-0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3E, 0x0D, 0x0A,
-0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x20, 0x4D, 0x6F, 0x64, 0x65, 0x20, 0x53, 0x65, 0x6C, 0x65, 0x63,
-0x74, 0x6F, 0x72, 0x20, 0x2D, 0x2D, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6D, 0x6F, 0x64, 0x65, 0x53,
-0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61,
-0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x3E, 0x42, 0x6F,
-0x61, 0x72, 0x64, 0x20, 0x4D, 0x6F, 0x64, 0x65, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69,
-0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x20, 0x62, 0x74,
-0x6E, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x2D, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x69, 0x65, 0x64, 0x22, 0x20, 0x64, 0x61,
-0x74, 0x61, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x3D, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x22, 0x3E, 0x0D,
-0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x52, 0x61, 0x69, 0x6C, 0x22, 0x20,
-0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x20, 0x62, 0x74, 0x6E, 0x2D, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
-0x74, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x72, 0x61, 0x64,
-0x69, 0x6F, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x6D, 0x6F, 0x64, 0x65, 0x22, 0x20,
-0x69, 0x64, 0x3D, 0x22, 0x6D, 0x6F, 0x64, 0x65, 0x52, 0x61, 0x69, 0x6C, 0x22, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22,
-0x30, 0x22, 0x3E, 0x20, 0x52, 0x61, 0x69, 0x6C, 0x0D, 0x0A, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C,
-0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x42, 0x75, 0x73, 0x22, 0x20, 0x63, 0x6C, 0x61,
-0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x20, 0x62, 0x74, 0x6E, 0x2D, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x22, 0x3E,
-0x0D, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6F, 0x22,
-0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x6D, 0x6F, 0x64, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3D,
-0x22, 0x6D, 0x6F, 0x64, 0x65, 0x42, 0x75, 0x73, 0x22, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x31, 0x22, 0x3E, 0x20,
-0x42, 0x75, 0x73, 0x0D, 0x0A, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
-0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x72, 0x53, 0x65,
-0x61, 0x72, 0x63, 0x68, 0x42, 0x6F, 0x78, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C,
-0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61,
-0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x20, 0x66, 0x6F,
-0x72, 0x3D, 0x22, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x22, 0x3E, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F,
-0x6E, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3D,
-0x22, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65,
-0x78, 0x74, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x54, 0x79, 0x70, 0x65,
-0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x22, 0x20, 0x63, 0x6C,
-0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x70,
-0x75, 0x74, 0x2D, 0x6D, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x61, 0x68, 0x65, 0x61, 0x64, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F,
-0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72,
-0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x42,
-0x6F, 0x78, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F,
-0x6E, 0x65, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63,
-0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x62, 0x75,
-0x73, 0x41, 0x74, 0x63, 0x6F, 0x22, 0x3E, 0x42, 0x75, 0x73, 0x20, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x41, 0x54, 0x43, 0x4F, 0x20,
-0x63, 0x6F, 0x64, 0x65, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74,
-0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x20, 0x67,
-0x61, 0x70, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79,
-0x6C, 0x65, 0x3D, 0x22, 0x66, 0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75,
-0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22,
-0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E,
-0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x54, 0x43, 0x4F, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x61, 0x6E, 0x64,
-0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x6D,
-0x64, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x30, 0x30, 0x25, 0x3B,
-0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6C,
-0x65, 0x3D, 0x22, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x73, 0x68, 0x72, 0x69, 0x6E, 0x6B, 0x3A, 0x20, 0x30, 0x3B, 0x22, 0x3E, 0x0D,
-0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x41, 0x74,
-0x63, 0x6F, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x41, 0x74, 0x63, 0x6F, 0x22,
-0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x62, 0x75,
-0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x3E, 0x56, 0x65, 0x72, 0x69, 0x66, 0x79,
-0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F,
-0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65,
-0x6C, 0x70, 0x2D, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F,
-0x4C, 0x6F, 0x6E, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x64,
-0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x42, 0x6F, 0x78, 0x22, 0x20,
-0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A,
-0x31, 0x30, 0x70, 0x78, 0x3B, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3E, 0x0D,
-0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F,
-0x6C, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74,
-0x65, 0x72, 0x22, 0x3E, 0x4F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x42,
-0x75, 0x73, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A,
-0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x22,
-0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x6D, 0x61, 0x78, 0x6C, 0x65, 0x6E, 0x67, 0x74,
-0x68, 0x3D, 0x22, 0x32, 0x34, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45,
-0x6E, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20,
-0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x6C,
-0x61, 0x6E, 0x6B, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66,
-0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x6D, 0x64, 0x22,
-0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62,
-0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D,
-0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62,
-0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72,
-0x79, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x3E, 0x52, 0x65, 0x63, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66,
-0x69, 0x65, 0x64, 0x20, 0x41, 0x54, 0x43, 0x4F, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x73, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C,
-0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61,
-0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x22, 0x3E,
-0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31,
-0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x75, 0x73, 0x41,
-0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x73,
-0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20,
-0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x73, 0x68, 0x72, 0x69, 0x6E, 0x6B, 0x3A, 0x20, 0x30,
-0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x6C, 0x65, 0x61,
-0x72, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x63, 0x6C, 0x65, 0x61, 0x72,
-0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x22, 0x20,
-0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x3E, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x48,
-0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69,
-0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C,
-0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65,
-0x6C, 0x70, 0x2D, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x3E, 0x46, 0x69, 0x6E, 0x64, 0x20, 0x62, 0x75, 0x73, 0x20, 0x73, 0x74,
-0x6F, 0x70, 0x20, 0x41, 0x54, 0x43, 0x4F, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x73, 0x20, 0x61, 0x74, 0x20, 0x3C, 0x61, 0x20, 0x68,
-0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x62, 0x75, 0x73, 0x74, 0x69, 0x6D, 0x65, 0x73,
-0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x22, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x22,
-0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x3E, 0x62, 0x75, 0x73, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x2E, 0x6F, 0x72, 0x67, 0x3C,
-0x2F, 0x61, 0x3E, 0x2E, 0x20, 0x54, 0x61, 0x70, 0x20, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74,
-0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x67, 0x61, 0x64, 0x65, 0x63,
-0x2D, 0x75, 0x6B, 0x2F, 0x74, 0x69, 0x6E, 0x79, 0x2D, 0x64, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2D, 0x62,
-0x6F, 0x61, 0x72, 0x64, 0x2F, 0x23, 0x62, 0x75, 0x73, 0x2D, 0x73, 0x74, 0x6F, 0x70, 0x2D, 0x61, 0x74, 0x63, 0x6F, 0x2D, 0x63,
-0x6F, 0x64, 0x65, 0x73, 0x22, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22,
-0x3E, 0x68, 0x65, 0x72, 0x65, 0x3C, 0x2F, 0x61, 0x3E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x20, 0x69, 0x6E,
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C,
-0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
-0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x20, 0x69, 0x64, 0x3D,
-0x22, 0x6E, 0x72, 0x43, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x42, 0x6F, 0x78, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D,
-0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62,
-0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2D, 0x6C, 0x61, 0x62,
-0x65, 0x6C, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69,
-0x6F, 0x6E, 0x22, 0x3E, 0x4F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65,
-0x73, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x74, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D,
-0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A,
-0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x22, 0x3E, 0x0D, 0x0A,
-0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x3B, 0x22,
-0x3E, 0x0D, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67,
-0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20,
-0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x20, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x20, 0x66,
-0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73,
-0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74,
-0x2D, 0x6D, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x61, 0x68, 0x65, 0x61, 0x64, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D,
-0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x73,
-0x68, 0x72, 0x69, 0x6E, 0x6B, 0x3A, 0x20, 0x30, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20,
-0x69, 0x64, 0x3D, 0x22, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65,
-0x3D, 0x22, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-0x22, 0x62, 0x74, 0x6E, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x3E, 0x43,
-0x6C, 0x65, 0x61, 0x72, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
-0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x6C,
-0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x42, 0x6F, 0x78, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C,
-0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x22, 0x3E,
-0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72,
-0x6F, 0x6C, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F,
-0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x22, 0x3E, 0x4F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74,
-0x68, 0x65, 0x73, 0x65, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C,
-0x3E, 0x0D, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72,
-0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20,
-0x6D, 0x61, 0x78, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3D, 0x22, 0x32, 0x34, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68,
-0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x20, 0x73, 0x65,
-0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6E, 0x75, 0x6D, 0x62,
-0x65, 0x72, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x22,
-0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20,
-0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x6D, 0x64, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C,
-0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F,
-0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C,
-0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x20, 0x66,
-0x6F, 0x72, 0x3D, 0x22, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x22, 0x3E, 0x42, 0x72, 0x69, 0x67, 0x68,
-0x74, 0x6E, 0x65, 0x73, 0x73, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74,
-0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x70, 0x78, 0x3B,
-0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x20, 0x6D, 0x69, 0x6E, 0x3D, 0x22, 0x31,
-0x22, 0x20, 0x6D, 0x61, 0x78, 0x3D, 0x22, 0x32, 0x35, 0x35, 0x22, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x35, 0x30,
-0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C,
-0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x22, 0x3E, 0x0D, 0x0A, 0x3C,
-0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x6C, 0x70, 0x2D, 0x62, 0x6C, 0x6F, 0x63,
-0x6B, 0x22, 0x3E, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x72, 0x69, 0x67, 0x68,
-0x74, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x68, 0x65, 0x6C, 0x70, 0x20, 0x70, 0x72, 0x65, 0x76, 0x65,
-0x6E, 0x74, 0x20, 0x62, 0x75, 0x72, 0x6E, 0x2D, 0x69, 0x6E, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C,
-0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F,
-0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C,
-0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x3E, 0x4F,
-0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20,
-0x69, 0x64, 0x3D, 0x22, 0x6F, 0x70, 0x74, 0x42, 0x75, 0x73, 0x65, 0x73, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70,
-0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69,
-0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20,
-0x69, 0x64, 0x3D, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x42, 0x75, 0x73, 0x65, 0x73, 0x22, 0x3E, 0x20, 0x49, 0x6E, 0x63,
-0x6C, 0x75, 0x64, 0x65, 0x20, 0x62, 0x75, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
-0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64,
-0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6F, 0x70, 0x74, 0x57, 0x65, 0x61, 0x74,
-0x68, 0x65, 0x72, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22,
-0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22,
-0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65,
-0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C,
-0x65, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x22, 0x3E, 0x20, 0x49, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x63, 0x75,
-0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x61,
-0x74, 0x69, 0x6F, 0x6E, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D,
-0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6F, 0x70, 0x74, 0x46, 0x61, 0x73, 0x74, 0x52, 0x65, 0x66, 0x72,
-0x65, 0x73, 0x68, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22,
-0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22,
-0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65,
-0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C,
-0x65, 0x46, 0x61, 0x73, 0x74, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x22, 0x3E, 0x20, 0x49, 0x6E, 0x63, 0x72, 0x65, 0x61,
-0x73, 0x65, 0x20, 0x41, 0x50, 0x49, 0x20, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x20, 0x72, 0x61, 0x74, 0x65, 0x3C, 0x2F,
-0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20,
-0x69, 0x64, 0x3D, 0x22, 0x6F, 0x70, 0x74, 0x4E, 0x6F, 0x53, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73,
-0x73, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64,
-0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C,
-0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F,
-0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x6F, 0x53, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x22, 0x3E, 0x20,
-0x53, 0x75, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x74, 0x20, 0x2F,
-0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x73,
-0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69,
-0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x3E, 0x0D, 0x0A,
-0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63,
-0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6F, 0x70, 0x74, 0x46, 0x6C, 0x69, 0x70, 0x22,
-0x3E, 0x20, 0x46, 0x6C, 0x69, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x31, 0x38,
-0x30, 0x26, 0x64, 0x65, 0x67, 0x3B, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62,
-0x6F, 0x78, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74,
-0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6F, 0x70,
-0x74, 0x48, 0x6F, 0x73, 0x74, 0x22, 0x3E, 0x20, 0x53, 0x65, 0x74, 0x20, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x20, 0x68, 0x6F,
-0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 0x6F, 0x61, 0x72, 0x64,
-0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69,
-0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x62, 0x6F, 0x78, 0x22, 0x20,
-0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x22,
-0x3E, 0x0D, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48,
-0x6F, 0x73, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x6D, 0x61, 0x78, 0x6C,
-0x65, 0x6E, 0x67, 0x74, 0x68, 0x3D, 0x22, 0x33, 0x32, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65,
-0x72, 0x3D, 0x22, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65,
-0x20, 0x6F, 0x72, 0x20, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x20, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74,
-0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F,
-0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x6D, 0x64, 0x22, 0x3E,
-0x0D, 0x0A, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x6C, 0x70, 0x2D, 0x62,
-0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x3E, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x68,
-0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 0x6F, 0x61, 0x72,
-0x64, 0x20, 0x28, 0x6C, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x2C, 0x20,
-0x68, 0x79, 0x70, 0x68, 0x65, 0x6E, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x29, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E,
-0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C,
-0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22,
-0x20, 0x69, 0x64, 0x3D, 0x22, 0x6F, 0x70, 0x74, 0x54, 0x5A, 0x22, 0x3E, 0x20, 0x43, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x20, 0x28,
-0x6E, 0x6F, 0x6E, 0x2D, 0x55, 0x4B, 0x29, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x7A, 0x6F, 0x6E, 0x65, 0x20, 0x28, 0x6F, 0x6E,
-0x6C, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x29,
-0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69,
-0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x73, 0x74,
-0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x22, 0x3E, 0x0D,
-0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x22,
-0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x6D, 0x61, 0x78, 0x6C, 0x65, 0x6E, 0x67, 0x74,
-0x68, 0x3D, 0x22, 0x32, 0x34, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x3D, 0x22, 0x45,
-0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x4F, 0x53, 0x49, 0x58, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x7A,
-0x6F, 0x6E, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x20, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x20, 0x62,
-0x6C, 0x61, 0x6E, 0x6B, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x55, 0x4B, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66,
-0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x6D, 0x64, 0x22,
-0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x6C, 0x70, 0x2D,
-0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x3E, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x61, 0x63,
-0x74, 0x20, 0x50, 0x4F, 0x53, 0x49, 0x58, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x7A, 0x6F, 0x6E, 0x65, 0x2E, 0x20, 0x54, 0x61,
-0x70, 0x20, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x67, 0x69,
-0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x67, 0x61, 0x64, 0x65, 0x63, 0x2D, 0x75, 0x6B, 0x2F, 0x74, 0x69, 0x6E,
-0x79, 0x2D, 0x64, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2D, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2F, 0x23, 0x63,
-0x75, 0x73, 0x74, 0x6F, 0x6D, 0x2D, 0x74, 0x69, 0x6D, 0x65, 0x2D, 0x7A, 0x6F, 0x6E, 0x65, 0x73, 0x22, 0x20, 0x74, 0x61, 0x72,
-0x67, 0x65, 0x74, 0x3D, 0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x3E, 0x68, 0x65, 0x72, 0x65, 0x3C, 0x2F, 0x61, 0x3E,
-0x20, 0x66, 0x6F, 0x72, 0x20, 0x68, 0x65, 0x6C, 0x70, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F,
-0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x68, 0x65,
-0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75,
-0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D,
-0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x22, 0x3E, 0x20, 0x45, 0x6E, 0x61,
-0x62, 0x6C, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x20, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72,
-0x65, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70, 0x3C,
-0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69,
-0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D,
-0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C,
-0x69, 0x67, 0x6E, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74,
-0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x61, 0x76, 0x65, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x73, 0x61,
-0x76, 0x65, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x20, 0x62, 0x74, 0x6E, 0x2D, 0x70, 0x72,
-0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x22, 0x3E,
-0x53, 0x61, 0x76, 0x65, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E,
-0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22,
-0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x30, 0x70, 0x78, 0x3B, 0x22, 0x3E, 0x0D, 0x0A,
-0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20,
-0x66, 0x6C, 0x65, 0x78, 0x3B, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
-0x3A, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x3B, 0x20, 0x61, 0x6C, 0x69, 0x67,
-0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C,
-0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x3B, 0x20, 0x74,
-0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x3A, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C,
-0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x6C, 0x70, 0x2D, 0x62, 0x6C, 0x6F, 0x63,
-0x6B, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x66, 0x77, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D,
-0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x3B, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0D,
-0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x72, 0x41,
-0x74, 0x74, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F,
-0x6E, 0x65, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A,
-0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x72, 0x61, 0x69, 0x6C, 0x2E, 0x63, 0x6F,
-0x2E, 0x75, 0x6B, 0x22, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x3E,
-0x3C, 0x69, 0x6D, 0x67, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x2F, 0x6E, 0x72, 0x65, 0x6C, 0x6F, 0x67, 0x6F, 0x2E, 0x77, 0x65,
-0x62, 0x70, 0x22, 0x20, 0x61, 0x6C, 0x74, 0x3D, 0x22, 0x4C, 0x6F, 0x67, 0x6F, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D,
-0x22, 0x6D, 0x61, 0x78, 0x2D, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x34, 0x30, 0x70, 0x78, 0x3B, 0x22, 0x3E, 0x3C,
-0x2F, 0x61, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D,
-0x22, 0x62, 0x74, 0x41, 0x74, 0x74, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61,
-0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74,
-0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x62, 0x75, 0x73, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x22, 0x20,
-0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x3E, 0x3C, 0x69, 0x6D, 0x67, 0x20,
-0x73, 0x72, 0x63, 0x3D, 0x22, 0x2F, 0x62, 0x74, 0x6C, 0x6F, 0x67, 0x6F, 0x2E, 0x77, 0x65, 0x62, 0x70, 0x22, 0x20, 0x61, 0x6C,
-0x74, 0x3D, 0x22, 0x4C, 0x6F, 0x67, 0x6F, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x78, 0x2D, 0x68,
-0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x34, 0x30, 0x70, 0x78, 0x3B, 0x22, 0x3E, 0x3C, 0x2F, 0x61, 0x3E, 0x0D, 0x0A, 0x3C,
-0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x68, 0x72, 0x20, 0x73, 0x74,
-0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x3B, 0x22,
-0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x6C, 0x70, 0x2D,
-0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x3E, 0x26, 0x63,
-0x6F, 0x70, 0x79, 0x3B, 0x20, 0x32, 0x30, 0x32, 0x36, 0x20, 0x47, 0x61, 0x64, 0x65, 0x63, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77,
-0x61, 0x72, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x69, 0x63,
-0x65, 0x6E, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22,
-0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x63, 0x6F, 0x6D, 0x6D, 0x6F,
-0x6E, 0x73, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x73, 0x2F, 0x62, 0x79, 0x2D, 0x6E, 0x63,
-0x2D, 0x73, 0x61, 0x2F, 0x34, 0x2E, 0x30, 0x2F, 0x22, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x22, 0x5F, 0x62, 0x6C,
-0x61, 0x6E, 0x6B, 0x22, 0x3E, 0x43, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x43, 0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x73,
-0x20, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x2D, 0x4E, 0x6F, 0x6E, 0x43, 0x6F, 0x6D, 0x6D, 0x65,
-0x72, 0x63, 0x69, 0x61, 0x6C, 0x2D, 0x53, 0x68, 0x61, 0x72, 0x65, 0x41, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x34, 0x2E, 0x30, 0x3C,
-0x2F, 0x61, 0x3E, 0x2E, 0x20, 0x41, 0x6E, 0x79, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x72, 0x63, 0x69, 0x61, 0x6C, 0x20, 0x75,
-0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x2C, 0x20, 0x69, 0x6E, 0x63, 0x6C,
-0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x73, 0x65, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x6B, 0x69,
-0x74, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2C, 0x20,
-0x69, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x68, 0x69, 0x62, 0x69, 0x74, 0x65, 0x64, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E,
-0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x65, 0x74, 0x3E,
-0x0D, 0x0A, 0x3C, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x73,
-0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74,
-0x65, 0x20, 0x3D, 0x20, 0x7B, 0x0D, 0x0A, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65,
-0x64, 0x3A, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x0D, 0x0A, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D,
-0x65, 0x3A, 0x20, 0x22, 0x22, 0x2C, 0x0D, 0x0A, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x43, 0x52, 0x53, 0x3A, 0x20, 0x22,
-0x22, 0x2C, 0x0D, 0x0A, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3A, 0x20,
-0x30, 0x2C, 0x0D, 0x0A, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3A,
-0x20, 0x30, 0x2C, 0x0D, 0x0A, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x20,
-0x22, 0x22, 0x2C, 0x0D, 0x0A, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x4F, 0x4B,
-0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x22, 0x22, 0x2C,
-0x0D, 0x0A, 0x62, 0x75, 0x73, 0x49, 0x64, 0x3A, 0x20, 0x22, 0x22, 0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x4C, 0x61, 0x74, 0x3A,
-0x20, 0x30, 0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x3A, 0x20, 0x30, 0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x49,
-0x64, 0x4F, 0x4B, 0x3A, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65,
-0x72, 0x3A, 0x20, 0x22, 0x22, 0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x4F, 0x4B, 0x3A, 0x20,
-0x74, 0x72, 0x75, 0x65, 0x2C, 0x0D, 0x0A, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65, 0x3A, 0x20, 0x30, 0x2C, 0x20,
-0x2F, 0x2F, 0x30, 0x3D, 0x52, 0x61, 0x69, 0x6C, 0x2C, 0x20, 0x31, 0x3D, 0x42, 0x75, 0x73, 0x0D, 0x0A, 0x73, 0x74, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x4C, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3A, 0x20, 0x30, 0x2C, 0x0D, 0x0A, 0x73, 0x74, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3A, 0x20, 0x30, 0x2C, 0x0D, 0x0A, 0x63, 0x61, 0x6C,
-0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3A, 0x20,
-0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x0D, 0x0A, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F,
-0x6E, 0x3A, 0x20, 0x22, 0x22, 0x2C, 0x0D, 0x0A, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x3A, 0x20, 0x22,
-0x22, 0x2C, 0x0D, 0x0A, 0x74, 0x7A, 0x4F, 0x4B, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0D, 0x0A, 0x68, 0x6F, 0x73, 0x74,
-0x6E, 0x61, 0x6D, 0x65, 0x4F, 0x4B, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0D, 0x0A, 0x6E, 0x65, 0x65, 0x64, 0x52, 0x65,
-0x73, 0x74, 0x61, 0x72, 0x74, 0x3A, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x0D, 0x0A, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61,
-0x72, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x22, 0x22, 0x2C, 0x0D, 0x0A, 0x6A, 0x73, 0x6F, 0x6E, 0x53,
-0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3A, 0x20, 0x7B, 0x7D, 0x2C, 0x0D, 0x0A, 0x61, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73,
-0x74, 0x6F, 0x72, 0x79, 0x3A, 0x20, 0x5B, 0x5D, 0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x65,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x0D, 0x0A, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x64, 0x6F,
-0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
-0x28, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x73, 0x65,
-0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4E,
-0x61, 0x6D, 0x65, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F,
-0x6E, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x20,
-0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-0x49, 0x64, 0x28, 0x22, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x22, 0x29, 0x2C,
-0x0D, 0x0A, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x62, 0x72, 0x69,
-0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F,
-0x6E, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x73, 0x61, 0x76, 0x65, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x63, 0x6C, 0x65, 0x61, 0x72,
-0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x46, 0x69, 0x6C, 0x74,
-0x65, 0x72, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x66, 0x77, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x66, 0x77,
-0x69, 0x6E, 0x66, 0x6F, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x41, 0x74, 0x63, 0x6F, 0x42, 0x75,
-0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
-0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x41, 0x74, 0x63, 0x6F, 0x22,
-0x29, 0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x62, 0x75, 0x73, 0x41,
-0x74, 0x63, 0x6F, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x20,
-0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-0x49, 0x64, 0x28, 0x22, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x4C, 0x6F, 0x6E, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x22, 0x29,
-0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x62, 0x75, 0x73,
-0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x48, 0x69, 0x73, 0x74, 0x6F,
-0x72, 0x79, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x48, 0x69,
-0x73, 0x74, 0x6F, 0x72, 0x79, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74,
-0x6F, 0x72, 0x79, 0x4C, 0x69, 0x73, 0x74, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x48,
-0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x6F, 0x70, 0x74, 0x46, 0x6C, 0x69,
-0x70, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x46, 0x6C, 0x69, 0x70, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x6F, 0x70,
-0x74, 0x54, 0x5A, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D,
-0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x54, 0x5A, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x63, 0x75,
-0x73, 0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x22,
-0x29, 0x2C, 0x0D, 0x0A, 0x6F, 0x70, 0x74, 0x48, 0x6F, 0x73, 0x74, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x48,
-0x6F, 0x73, 0x74, 0x22, 0x29, 0x2C, 0x0D, 0x0A, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x3A, 0x20, 0x64,
-0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
-0x64, 0x28, 0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x22, 0x29, 0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A,
-0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20,
-0x3D, 0x20, 0x22, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C,
-0x69, 0x64, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x75, 0x73, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63,
-0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x6C,
-0x65, 0x61, 0x76, 0x65, 0x20, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x65,
-0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x2E, 0x22, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x70, 0x6C, 0x61, 0x74,
-0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x22, 0x50, 0x6C,
-0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x6C, 0x69,
-0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x69,
-0x6C, 0x74, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x20, 0x62, 0x6C, 0x61,
-0x6E, 0x6B, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x2E, 0x22,
-0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x7A, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x22, 0x50,
-0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x50,
-0x4F, 0x53, 0x49, 0x58, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x20,
-0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x20, 0x75, 0x6E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65,
-0x20, 0x5C, 0x22, 0x43, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x5C, 0x22, 0x20,
-0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 0x20, 0x55, 0x4B, 0x20, 0x74, 0x69, 0x6D, 0x65,
-0x2E, 0x22, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x45, 0x72,
-0x72, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x22, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61,
-0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x75, 0x6E,
-0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x5C, 0x22, 0x43, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x20, 0x68, 0x6F,
-0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x5C, 0x22, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73,
-0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x5C, 0x22, 0x54, 0x69, 0x6E, 0x79, 0x44,
-0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x5C, 0x22, 0x2E, 0x22, 0x3B, 0x0D, 0x0A,
-0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x4D, 0x41, 0x58, 0x5F, 0x42, 0x55, 0x53, 0x5F, 0x41, 0x54, 0x43, 0x4F, 0x53, 0x20, 0x3D,
-0x20, 0x31, 0x30, 0x3B, 0x0D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-0x66, 0x65, 0x74, 0x63, 0x68, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x28, 0x29, 0x20, 0x7B, 0x0D,
-0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73,
-0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x74, 0x63,
-0x6F, 0x2D, 0x68, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66,
-0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x72, 0x65,
-0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x61, 0x74,
-0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x3D, 0x20, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65,
-0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x6E, 0x64, 0x65,
-0x72, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x20, 0x63, 0x61,
-0x74, 0x63, 0x68, 0x20, 0x7B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D,
-0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x61, 0x76, 0x65, 0x52,
-0x65, 0x63, 0x65, 0x6E, 0x74, 0x42, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x28, 0x61, 0x74, 0x63, 0x6F, 0x2C, 0x20, 0x6E, 0x61,
-0x6D, 0x65, 0x2C, 0x20, 0x6C, 0x61, 0x74, 0x2C, 0x20, 0x6C, 0x6F, 0x6E, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73,
-0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x61, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E,
-0x73, 0x74, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x75,
-0x72, 0x72, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x73, 0x6F, 0x6D, 0x65, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D,
-0x3E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x61, 0x74, 0x63, 0x6F, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x61, 0x74, 0x63, 0x6F, 0x29,
-0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x29,
-0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x5B, 0x2E, 0x2E, 0x2E,
-0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x5D, 0x3B, 0x0D, 0x0A, 0x6C, 0x69, 0x73, 0x74, 0x2E, 0x75,
-0x6E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x7B, 0x20, 0x61, 0x74, 0x63, 0x6F, 0x2C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20,
-0x6C, 0x61, 0x74, 0x2C, 0x20, 0x6C, 0x6F, 0x6E, 0x20, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3D, 0x20,
-0x6C, 0x69, 0x73, 0x74, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x20, 0x4D, 0x41, 0x58, 0x5F, 0x42, 0x55, 0x53,
-0x5F, 0x41, 0x54, 0x43, 0x4F, 0x53, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x61, 0x74,
-0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x3D, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x3B, 0x0D, 0x0A, 0x74, 0x72,
-0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x6C, 0x6F, 0x62, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77,
-0x20, 0x42, 0x6C, 0x6F, 0x62, 0x28, 0x0D, 0x0A, 0x5B, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69,
-0x66, 0x79, 0x28, 0x6C, 0x69, 0x73, 0x74, 0x2C, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x20, 0x32, 0x29, 0x5D, 0x2C, 0x0D, 0x0A,
-0x7B, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F,
-0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20, 0x7D, 0x0D, 0x0A, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x66, 0x6F,
-0x72, 0x6D, 0x44, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x46, 0x6F, 0x72, 0x6D, 0x44, 0x61, 0x74, 0x61,
-0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x66, 0x6F, 0x72, 0x6D, 0x44, 0x61, 0x74, 0x61, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28,
-0x27, 0x66, 0x69, 0x6C, 0x65, 0x27, 0x2C, 0x20, 0x62, 0x6C, 0x6F, 0x62, 0x2C, 0x20, 0x27, 0x61, 0x74, 0x63, 0x6F, 0x2D, 0x68,
-0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74,
-0x63, 0x68, 0x28, 0x27, 0x2F, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x27, 0x2C, 0x20, 0x7B, 0x0D, 0x0A, 0x6D, 0x65, 0x74, 0x68,
-0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0D, 0x0A, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x66, 0x6F,
-0x72, 0x6D, 0x44, 0x61, 0x74, 0x61, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73,
-0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x46,
-0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x41, 0x54, 0x43, 0x4F, 0x20, 0x68, 0x69,
-0x73, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x72,
-0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65,
-0x72, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20,
-0x74, 0x6F, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x41, 0x54, 0x43, 0x4F, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6F, 0x72,
-0x79, 0x3A, 0x20, 0x22, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x3B, 0x0D,
-0x0A, 0x7D, 0x0D, 0x0A, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79,
-0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6E, 0x64,
-0x53, 0x61, 0x76, 0x65, 0x64, 0x42, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x28, 0x61, 0x74, 0x63, 0x6F, 0x29, 0x20, 0x7B, 0x0D,
-0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74,
-0x65, 0x2E, 0x61, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72,
-0x6E, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x69,
-0x74, 0x65, 0x6D, 0x2E, 0x61, 0x74, 0x63, 0x6F, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x61, 0x74, 0x63, 0x6F, 0x29, 0x20, 0x7C, 0x7C,
-0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-0x65, 0x6E, 0x64, 0x65, 0x72, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x28, 0x29, 0x20, 0x7B, 0x0D,
-0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74,
-0x65, 0x2E, 0x61, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21,
-0x6C, 0x69, 0x73, 0x74, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28,
-0x22, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x22, 0x2C, 0x66, 0x61, 0x6C, 0x73,
-0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73,
-0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x62, 0x75, 0x73, 0x41,
-0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x64, 0x61,
-0x74, 0x61, 0x6C, 0x69, 0x73, 0x74, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x22,
-0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63,
-0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22,
-0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x76, 0x61, 0x6C,
-0x75, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x6C, 0x61, 0x62, 0x65,
-0x6C, 0x20, 0x3D, 0x20, 0x22, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x61, 0x20, 0x72, 0x65, 0x63, 0x65, 0x6E, 0x74, 0x20,
-0x41, 0x54, 0x43, 0x4F, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x2E, 0x2E, 0x2E, 0x22, 0x3B, 0x0D, 0x0A, 0x64, 0x61, 0x74, 0x61, 0x6C,
-0x69, 0x73, 0x74, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-0x6E, 0x29, 0x3B, 0x0D, 0x0A, 0x6C, 0x69, 0x73, 0x74, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x69, 0x74, 0x65,
-0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D,
-0x65, 0x6E, 0x74, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x61, 0x74, 0x63, 0x6F, 0x3B, 0x0D,
-0x0A, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E,
-0x6E, 0x61, 0x6D, 0x65, 0x20, 0x2B, 0x20, 0x22, 0x20, 0x28, 0x22, 0x20, 0x2B, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x61, 0x74,
-0x63, 0x6F, 0x20, 0x2B, 0x20, 0x22, 0x29, 0x22, 0x3B, 0x0D, 0x0A, 0x64, 0x61, 0x74, 0x61, 0x6C, 0x69, 0x73, 0x74, 0x2E, 0x61,
-0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x3B, 0x0D, 0x0A,
-0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73,
-0x74, 0x6F, 0x72, 0x79, 0x22, 0x2C, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63,
-0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72,
-0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x61, 0x74,
-0x63, 0x6F, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F,
-0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x63,
-0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x53, 0x61, 0x76, 0x65,
-0x64, 0x42, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x28, 0x61, 0x74, 0x63, 0x6F, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28,
-0x21, 0x73, 0x61, 0x76, 0x65, 0x64, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D,
-0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20,
-0x73, 0x61, 0x76, 0x65, 0x64, 0x2E, 0x61, 0x74, 0x63, 0x6F, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
-0x2E, 0x62, 0x75, 0x73, 0x49, 0x64, 0x20, 0x3D, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x2E, 0x61, 0x74, 0x63, 0x6F, 0x3B, 0x0D,
-0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x73,
-0x61, 0x76, 0x65, 0x64, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E,
-0x62, 0x75, 0x73, 0x4C, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x2E, 0x6C, 0x61, 0x74, 0x3B, 0x0D, 0x0A,
-0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x73, 0x61, 0x76,
-0x65, 0x64, 0x2E, 0x6C, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73,
-0x49, 0x64, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-0x73, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54,
-0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x4C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x3C, 0x62, 0x3E, 0x22, 0x20,
-0x2B, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x2B, 0x20, 0x22, 0x3C, 0x2F, 0x62, 0x3E, 0x22,
-0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F,
-0x6E, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69,
-0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x42, 0x75, 0x73, 0x46,
-0x69, 0x6C, 0x74, 0x65, 0x72, 0x42, 0x6F, 0x78, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63,
-0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x65, 0x61, 0x72,
-0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x63,
-0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74,
-0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x64, 0x65, 0x6C, 0x3F, 0x66, 0x3D, 0x2F, 0x61, 0x74, 0x63, 0x6F, 0x2D,
-0x68, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x20, 0x63, 0x61,
-0x74, 0x63, 0x68, 0x20, 0x7B, 0x7D, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x61, 0x74, 0x63, 0x6F,
-0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72,
-0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75,
-0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x43, 0x53, 0x56, 0x46, 0x69, 0x6C,
-0x74, 0x65, 0x72, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x4D, 0x65, 0x73, 0x73, 0x61, 0x67,
-0x65, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x72, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x20, 0x3D,
-0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21,
-0x74, 0x72, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x72, 0x65,
-0x74, 0x75, 0x72, 0x6E, 0x20, 0x7B, 0x0D, 0x0A, 0x6F, 0x6B, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0D, 0x0A, 0x76, 0x61,
-0x6C, 0x75, 0x65, 0x3A, 0x20, 0x22, 0x22, 0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x74,
-0x72, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x2E, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x73, 0x28, 0x27, 0x22, 0x27, 0x29, 0x29,
-0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x44, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x20, 0x71, 0x75, 0x6F,
-0x74, 0x65, 0x73, 0x20, 0x28, 0x22, 0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77,
-0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x2F, 0x62, 0x75,
-0x73, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x73, 0x2E, 0x27, 0x29, 0x3B,
-0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x7B, 0x0D, 0x0A, 0x6F, 0x6B, 0x3A, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65,
-0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x73, 0x76, 0x52, 0x65, 0x67,
-0x65, 0x78, 0x20, 0x3D, 0x20, 0x2F, 0x5E, 0x5B, 0x5E, 0x2C, 0x5C, 0x73, 0x5D, 0x2B, 0x28, 0x5C, 0x73, 0x2A, 0x2C, 0x5C, 0x73,
-0x2A, 0x5B, 0x5E, 0x2C, 0x5C, 0x73, 0x5D, 0x2B, 0x29, 0x2A, 0x24, 0x2F, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x63,
-0x73, 0x76, 0x52, 0x65, 0x67, 0x65, 0x78, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x74, 0x72, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x29,
-0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x4D, 0x65, 0x73, 0x73, 0x61,
-0x67, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x7B, 0x0D, 0x0A, 0x6F, 0x6B, 0x3A, 0x20, 0x66,
-0x61, 0x6C, 0x73, 0x65, 0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x7B,
-0x0D, 0x0A, 0x6F, 0x6B, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0D, 0x0A, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x20, 0x74,
-0x72, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x50, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69,
-0x6C, 0x74, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74,
-0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46,
-0x69, 0x6C, 0x74, 0x65, 0x72, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72,
-0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x43, 0x53, 0x56, 0x46, 0x69,
-0x6C, 0x74, 0x65, 0x72, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69,
-0x6C, 0x74, 0x65, 0x72, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73,
-0x75, 0x6C, 0x74, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x70, 0x6C, 0x61, 0x74,
-0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B,
-0x0D, 0x0A, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x70, 0x6C,
-0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65,
-0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46,
-0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B,
-0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x69,
-0x64, 0x61, 0x74, 0x65, 0x42, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F,
-0x6E, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
-0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E,
-0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x43,
-0x53, 0x56, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C,
-0x74, 0x65, 0x72, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x75,
-0x6C, 0x74, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x46, 0x69,
-0x6C, 0x74, 0x65, 0x72, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x73, 0x65,
-0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65,
-0x72, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
-0x2E, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 0x76,
-0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x54, 0x5A, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73,
-0x74, 0x20, 0x72, 0x65, 0x67, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x2F, 0x5E, 0x28, 0x5B, 0x41, 0x2D, 0x5A, 0x61, 0x2D, 0x7A, 0x5D,
-0x7B, 0x33, 0x2C, 0x7D, 0x29, 0x28, 0x5B, 0x2B, 0x2D, 0x5D, 0x3F, 0x28, 0x3F, 0x3A, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x7C, 0x31,
-0x5B, 0x30, 0x2D, 0x34, 0x5D, 0x29, 0x28, 0x3F, 0x3A, 0x3A, 0x5B, 0x30, 0x2D, 0x35, 0x5D, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x29,
-0x3F, 0x28, 0x3F, 0x3A, 0x3A, 0x5B, 0x30, 0x2D, 0x35, 0x5D, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x29, 0x3F, 0x29, 0x3F, 0x28, 0x5B,
-0x41, 0x2D, 0x5A, 0x61, 0x2D, 0x7A, 0x5D, 0x7B, 0x33, 0x2C, 0x7D, 0x29, 0x3F, 0x28, 0x3F, 0x3A, 0x2C, 0x4D, 0x28, 0x30, 0x3F,
-0x5B, 0x31, 0x2D, 0x39, 0x5D, 0x7C, 0x31, 0x5B, 0x30, 0x2D, 0x32, 0x5D, 0x29, 0x5C, 0x2E, 0x28, 0x3F, 0x3A, 0x5B, 0x31, 0x2D,
-0x34, 0x5D, 0x7C, 0x35, 0x29, 0x5C, 0x2E, 0x5B, 0x30, 0x2D, 0x36, 0x5D, 0x28, 0x3F, 0x3A, 0x5C, 0x2F, 0x28, 0x3F, 0x3A, 0x5B,
-0x30, 0x2D, 0x39, 0x5D, 0x7C, 0x31, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x7C, 0x32, 0x5B, 0x30, 0x2D, 0x34, 0x5D, 0x29, 0x29, 0x3F,
-0x2C, 0x4D, 0x28, 0x30, 0x3F, 0x5B, 0x31, 0x2D, 0x39, 0x5D, 0x7C, 0x31, 0x5B, 0x30, 0x2D, 0x32, 0x5D, 0x29, 0x5C, 0x2E, 0x28,
-0x3F, 0x3A, 0x5B, 0x31, 0x2D, 0x34, 0x5D, 0x7C, 0x35, 0x29, 0x5C, 0x2E, 0x5B, 0x30, 0x2D, 0x36, 0x5D, 0x28, 0x3F, 0x3A, 0x5C,
-0x2F, 0x28, 0x3F, 0x3A, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x7C, 0x31, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x7C, 0x32, 0x5B, 0x30, 0x2D,
-0x34, 0x5D, 0x29, 0x29, 0x3F, 0x29, 0x3F, 0x24, 0x2F, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C,
-0x75, 0x65, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x54,
-0x5A, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53,
-0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x7A, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x69, 0x66,
-0x20, 0x28, 0x21, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75,
-0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x67, 0x65, 0x78, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x76,
-0x61, 0x6C, 0x75, 0x65, 0x29, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x74, 0x7A, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x6C,
-0x65, 0x72, 0x74, 0x28, 0x74, 0x7A, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x48, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D,
-0x65, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x67, 0x65, 0x78, 0x20, 0x3D, 0x20,
-0x2F, 0x5E, 0x28, 0x3F, 0x21, 0x2D, 0x29, 0x5B, 0x41, 0x2D, 0x5A, 0x61, 0x2D, 0x7A, 0x30, 0x2D, 0x39, 0x5D, 0x28, 0x3F, 0x3A,
-0x5B, 0x41, 0x2D, 0x5A, 0x61, 0x2D, 0x7A, 0x30, 0x2D, 0x39, 0x2D, 0x5D, 0x7B, 0x30, 0x2C, 0x36, 0x31, 0x7D, 0x5B, 0x41, 0x2D,
-0x5A, 0x61, 0x2D, 0x7A, 0x30, 0x2D, 0x39, 0x5D, 0x29, 0x3F, 0x24, 0x2F, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74,
-0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0D,
-0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x4F, 0x4B, 0x20,
-0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x6C,
-0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x72,
-0x65, 0x67, 0x65, 0x78, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x29, 0x20, 0x72, 0x65, 0x74,
-0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61,
-0x6D, 0x65, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28,
-0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x63,
-0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x4D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x72,
-0x20, 0x3D, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x28, 0x71,
-0x2C, 0x20, 0x63, 0x62, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x71, 0x2E, 0x6C, 0x65, 0x6E,
-0x67, 0x74, 0x68, 0x20, 0x3E, 0x20, 0x32, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x24, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x28, 0x7B, 0x0D,
-0x0A, 0x75, 0x72, 0x6C, 0x3A, 0x20, 0x27, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72,
-0x3F, 0x71, 0x3D, 0x27, 0x20, 0x2B, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x55, 0x52, 0x49, 0x43, 0x6F, 0x6D, 0x70, 0x6F,
-0x6E, 0x65, 0x6E, 0x74, 0x28, 0x71, 0x29, 0x2C, 0x0D, 0x0A, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45,
-0x54, 0x27, 0x2C, 0x0D, 0x0A, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-0x6E, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x2E, 0x73,
-0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x73, 0x20, 0x3D, 0x3E, 0x20, 0x73,
-0x2E, 0x6B, 0x62, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x21, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x62, 0x28,
-0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x2C, 0x0D, 0x0A, 0x65, 0x72, 0x72, 0x6F, 0x72,
-0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x78, 0x68, 0x72, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75,
-0x73, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E,
-0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x60, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20,
-0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x3A, 0x20, 0x24, 0x7B, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7D, 0x20, 0x2D, 0x20, 0x24,
-0x7B, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x7D, 0x60, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x62, 0x28, 0x5B, 0x5D, 0x29, 0x3B, 0x0D, 0x0A,
-0x7D, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x62, 0x28,
-0x5B, 0x5D, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A, 0x24, 0x28, 0x65, 0x6C,
-0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x2E, 0x74, 0x79,
-0x70, 0x65, 0x61, 0x68, 0x65, 0x61, 0x64, 0x28, 0x7B, 0x0D, 0x0A, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x27, 0x73, 0x74, 0x61,
-0x74, 0x69, 0x6F, 0x6E, 0x73, 0x27, 0x2C, 0x0D, 0x0A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x3A, 0x20, 0x73, 0x75, 0x62, 0x73,
-0x74, 0x72, 0x69, 0x6E, 0x67, 0x4D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x72, 0x28, 0x29, 0x2C, 0x0D, 0x0A, 0x75, 0x70, 0x64, 0x61,
-0x74, 0x65, 0x72, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x7B,
-0x0D, 0x0A, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74,
-0x65, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x74, 0x65,
-0x6D, 0x3B, 0x0D, 0x0A, 0x7D, 0x2C, 0x0D, 0x0A, 0x68, 0x69, 0x67, 0x68, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x3A, 0x20,
-0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x72, 0x65, 0x74,
-0x75, 0x72, 0x6E, 0x20, 0x27, 0x3C, 0x69, 0x6D, 0x67, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x2F, 0x6E, 0x72, 0x2E, 0x77, 0x65,
-0x62, 0x70, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x72, 0x69, 0x67,
-0x68, 0x74, 0x3A, 0x36, 0x70, 0x78, 0x22, 0x3E, 0x27, 0x20, 0x2B, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D,
-0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x24, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C,
-0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x61, 0x68, 0x65, 0x61, 0x64,
-0x28, 0x7B, 0x0D, 0x0A, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x27, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x27, 0x2C,
-0x0D, 0x0A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x3A, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x4D, 0x61,
-0x74, 0x63, 0x68, 0x65, 0x72, 0x28, 0x29, 0x2C, 0x0D, 0x0A, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x72, 0x3A, 0x20, 0x66, 0x75,
-0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x68, 0x61, 0x6E, 0x64, 0x6C,
-0x65, 0x43, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74,
-0x65, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x74, 0x65,
-0x6D, 0x3B, 0x0D, 0x0A, 0x7D, 0x2C, 0x0D, 0x0A, 0x68, 0x69, 0x67, 0x68, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x3A, 0x20,
-0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x72, 0x65, 0x74,
-0x75, 0x72, 0x6E, 0x20, 0x27, 0x3C, 0x69, 0x6D, 0x67, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x2F, 0x6E, 0x72, 0x2E, 0x77, 0x65,
-0x62, 0x70, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x72, 0x69, 0x67,
-0x68, 0x74, 0x3A, 0x36, 0x70, 0x78, 0x22, 0x3E, 0x27, 0x20, 0x2B, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D,
-0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x2F, 0x2F, 0x20, 0x50, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x64, 0x65, 0x66, 0x61,
-0x75, 0x6C, 0x74, 0x20, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x68,
-0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x61, 0x76, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x0D, 0x0A,
-0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E,
-0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x22, 0x2C, 0x20, 0x66,
-0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x65, 0x2E, 0x70, 0x72, 0x65, 0x76,
-0x65, 0x6E, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61,
-0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x4F, 0x4B, 0x29, 0x20,
-0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x29,
-0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
-0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x4F, 0x4B, 0x29, 0x20, 0x61, 0x6C,
-0x65, 0x72, 0x74, 0x28, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x45, 0x72, 0x72,
-0x6F, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x74, 0x7A, 0x4F, 0x4B, 0x29, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x74, 0x7A, 0x45, 0x72, 0x72,
-0x6F, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x4F, 0x4B, 0x29, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74,
-0x28, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x73,
-0x65, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x61, 0x76, 0x65, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D,
-0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x2E,
-0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x66, 0x6F, 0x63,
-0x75, 0x73, 0x22, 0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73,
-0x65, 0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x28, 0x29, 0x29, 0x3B, 0x0D,
-0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x2E,
-0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x62, 0x6C, 0x75,
-0x72, 0x22, 0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28,
-0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x73, 0x74, 0x46, 0x6F, 0x63, 0x75,
-0x73, 0x2C, 0x20, 0x35, 0x30, 0x30, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63,
-0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E,
-0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x22, 0x2C, 0x20, 0x28, 0x29,
-0x20, 0x3D, 0x3E, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53,
-0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x28, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C,
-0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x62, 0x6C,
-0x75, 0x72, 0x22, 0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74,
-0x28, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-0x4C, 0x6F, 0x73, 0x74, 0x46, 0x6F, 0x63, 0x75, 0x73, 0x2C, 0x20, 0x35, 0x30, 0x30, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C,
-0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72,
-0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x62, 0x6C,
-0x75, 0x72, 0x22, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x50, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D,
-0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x72,
-0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74,
-0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
-0x42, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x43, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x65,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x61,
-0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6C, 0x69, 0x63,
-0x6B, 0x22, 0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72,
-0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x41, 0x74,
-0x63, 0x6F, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74,
-0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x22, 0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x56,
-0x65, 0x72, 0x69, 0x66, 0x79, 0x41, 0x74, 0x63, 0x6F, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
-0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x61,
-0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6C, 0x69, 0x63,
-0x6B, 0x22, 0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72,
-0x79, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F,
-0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C,
-0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x27, 0x2C, 0x20, 0x68, 0x61, 0x6E,
-0x64, 0x6C, 0x65, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x29,
-0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72,
-0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x62, 0x6C,
-0x75, 0x72, 0x22, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x42, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65,
-0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6F, 0x70, 0x74, 0x54, 0x5A, 0x2E, 0x61,
-0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6E,
-0x67, 0x65, 0x22, 0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x63, 0x75, 0x73,
-0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x62, 0x6F, 0x78, 0x22, 0x2C, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22,
-0x6F, 0x70, 0x74, 0x54, 0x5A, 0x22, 0x29, 0x29, 0x3B, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63,
-0x6B, 0x65, 0x64, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x54, 0x5A, 0x22, 0x29, 0x29, 0x20, 0x7B, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x22,
-0x22, 0x3B, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x7A, 0x4F, 0x4B, 0x3D, 0x74, 0x72, 0x75, 0x65,
-0x3B, 0x7D, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F,
-0x6D, 0x54, 0x5A, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28,
-0x22, 0x62, 0x6C, 0x75, 0x72, 0x22, 0x2C, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x54, 0x5A, 0x29, 0x3B, 0x0D, 0x0A,
-0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6F, 0x70, 0x74, 0x48, 0x6F, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x45,
-0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22,
-0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D,
-0x48, 0x6F, 0x73, 0x74, 0x62, 0x6F, 0x78, 0x22, 0x2C, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x6F,
-0x70, 0x74, 0x48, 0x6F, 0x73, 0x74, 0x22, 0x29, 0x29, 0x3B, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x69, 0x73, 0x43, 0x68, 0x65,
-0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x48, 0x6F, 0x73, 0x74, 0x22, 0x29, 0x29, 0x20, 0x7B, 0x65, 0x6C, 0x65,
-0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-0x65, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x68, 0x6F, 0x73, 0x74,
-0x6E, 0x61, 0x6D, 0x65, 0x4F, 0x4B, 0x3D, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x7D, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65,
-0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x45,
-0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x62, 0x6C, 0x75, 0x72, 0x22, 0x2C, 0x76,
-0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x48, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x64, 0x6F,
-0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E,
-0x65, 0x72, 0x28, 0x22, 0x44, 0x4F, 0x4D, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x22,
-0x2C, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x77, 0x61, 0x69,
-0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x77, 0x61,
-0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x28, 0x29, 0x3B, 0x0D, 0x0A,
-0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x41, 0x70, 0x69, 0x4B, 0x65, 0x79, 0x73, 0x28, 0x29, 0x3B,
-0x0D, 0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74,
-0x6F, 0x72, 0x79, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x24, 0x28, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74,
-0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x6D, 0x6F, 0x64, 0x65, 0x5D, 0x22, 0x29, 0x2E, 0x6F, 0x6E,
-0x28, 0x22, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29,
-0x7B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65,
-0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65, 0x28, 0x29,
-0x3B, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x74, 0x72,
-0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D,
-0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67,
-0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E,
-0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F,
-0x72, 0x28, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x63, 0x6F,
-0x6E, 0x66, 0x69, 0x67, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6A, 0x73,
-0x6F, 0x6E, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65,
-0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x6C, 0x6F, 0x61, 0x64, 0x53,
-0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28,
-0x65, 0x72, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x60, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20,
-0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x3A, 0x20, 0x24, 0x7B, 0x65, 0x72, 0x72,
-0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x61,
-0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x46, 0x69,
-0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F,
-0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
-0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x27, 0x29, 0x3B, 0x0D, 0x0A,
-0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x72, 0x65, 0x74,
-0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x54, 0x79,
-0x70, 0x65, 0x20, 0x3D, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
-0x2E, 0x67, 0x65, 0x74, 0x28, 0x22, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x22, 0x29, 0x3B,
-0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D, 0x3D,
-0x20, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x29, 0x20,
-0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6A, 0x73, 0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x20, 0x3D, 0x20, 0x61,
-0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B,
-0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x56, 0x65,
-0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x6A, 0x73, 0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x2E, 0x66, 0x69, 0x72, 0x6D,
-0x77, 0x61, 0x72, 0x65, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
-0x2E, 0x66, 0x77, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x27,
-0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x67, 0x69, 0x74, 0x68,
-0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x67, 0x61, 0x64, 0x65, 0x63, 0x2D, 0x75, 0x6B, 0x2F, 0x74, 0x69, 0x6E, 0x79, 0x2D,
-0x64, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2D, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x23, 0x72, 0x65, 0x61, 0x64,
-0x6D, 0x65, 0x22, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x3E, 0x46,
-0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
-0x2E, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x2B, 0x20, 0x27, 0x3C,
-0x2F, 0x61, 0x3E, 0x27, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72,
-0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22,
-0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A,
-0x22, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63,
-0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x41, 0x70, 0x69, 0x4B, 0x65, 0x79,
-0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72,
-0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68,
-0x28, 0x27, 0x2F, 0x61, 0x70, 0x69, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x29, 0x3B, 0x0D, 0x0A, 0x63,
-0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73,
-0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x64,
-0x61, 0x74, 0x61, 0x2E, 0x6F, 0x77, 0x6D, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x24, 0x28, 0x27, 0x23,
-0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x27, 0x29, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x28,
-0x27, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x2E, 0x70, 0x72, 0x6F,
-0x70, 0x28, 0x27, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x3B, 0x0D,
-0x0A, 0x7D, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6E, 0x72, 0x54, 0x6F, 0x6B, 0x65, 0x6E,
-0x20, 0x7C, 0x7C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6E, 0x72, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x2E, 0x6C, 0x65, 0x6E, 0x67,
-0x74, 0x68, 0x21, 0x3D, 0x33, 0x36, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x6D, 0x6F, 0x64, 0x65,
-0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x22, 0x2C, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x70,
-0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x3B,
-0x0D, 0x0A, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65, 0x28, 0x29, 0x3B, 0x0D, 0x0A,
-0x7D, 0x0D, 0x0A, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63,
-0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x77, 0x61, 0x72, 0x6E, 0x28, 0x22, 0x43, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F,
-0x74, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x61, 0x70, 0x69, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A,
-0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-0x67, 0x65, 0x74, 0x42, 0x75, 0x73, 0x53, 0x74, 0x6F, 0x70, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x62, 0x75, 0x73, 0x49, 0x64, 0x29,
-0x20, 0x7B, 0x0D, 0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70,
-0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x60, 0x68,
-0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x62, 0x75, 0x73, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x61,
-0x70, 0x69, 0x2F, 0x73, 0x74, 0x6F, 0x70, 0x73, 0x2F, 0x24, 0x7B, 0x62, 0x75, 0x73, 0x49, 0x64, 0x7D, 0x60, 0x29, 0x3B, 0x0D,
-0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0D,
-0x0A, 0x2F, 0x2F, 0x20, 0x48, 0x54, 0x54, 0x50, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
-0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x41, 0x74, 0x63, 0x6F, 0x0D,
-0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x22,
-0x22, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x61, 0x74, 0x20, 0x3D,
-0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x20,
-0x3D, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A,
-0x7D, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74,
-0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x70,
-0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61,
-0x2E, 0x6C, 0x6F, 0x6E, 0x67, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x3F, 0x3F, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x69, 0x66,
-0x20, 0x28, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2E,
-0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x26, 0x26, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6C, 0x6F, 0x63,
-0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x32, 0x29, 0x20, 0x7B,
-0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x64,
-0x61, 0x74, 0x61, 0x2E, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5B, 0x30, 0x5D, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70,
-0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6C,
-0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5B, 0x31, 0x5D, 0x3B, 0x0D, 0x0A, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B,
-0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x30,
-0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x20, 0x3D, 0x20,
-0x30, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A,
-0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x2F, 0x2F,
-0x20, 0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x6F, 0x72, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x65, 0x74,
-0x63, 0x68, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72,
-0x6F, 0x72, 0x28, 0x22, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x75,
-0x73, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x20, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x22, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29,
-0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D,
-0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x61, 0x74,
-0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F,
-0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B,
-0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x56, 0x65, 0x72, 0x69, 0x66, 0x79, 0x41, 0x74, 0x63, 0x6F, 0x28, 0x29, 0x20,
-0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x72, 0x41, 0x74, 0x63, 0x6F, 0x20, 0x3D, 0x20, 0x65,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
-0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65,
-0x73, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x42, 0x75, 0x73, 0x53, 0x74, 0x6F, 0x70,
-0x4E, 0x61, 0x6D, 0x65, 0x28, 0x75, 0x73, 0x65, 0x72, 0x41, 0x74, 0x63, 0x6F, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28,
-0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E,
-0x62, 0x75, 0x73, 0x49, 0x64, 0x20, 0x3D, 0x20, 0x75, 0x73, 0x65, 0x72, 0x41, 0x74, 0x63, 0x6F, 0x3B, 0x0D, 0x0A, 0x61, 0x70,
-0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x49, 0x64, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65,
-0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x67, 0x4E, 0x61,
-0x6D, 0x65, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x4C, 0x6F, 0x63, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x3C, 0x62, 0x3E, 0x22, 0x20, 0x2B, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E,
-0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x2B, 0x20, 0x22, 0x3C, 0x2F, 0x62, 0x3E, 0x22, 0x3B, 0x0D, 0x0A, 0x73, 0x61,
-0x76, 0x65, 0x52, 0x65, 0x63, 0x65, 0x6E, 0x74, 0x42, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x28, 0x75, 0x73, 0x65, 0x72, 0x41,
-0x74, 0x63, 0x6F, 0x2C, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-0x2C, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x61, 0x74, 0x2C, 0x20, 0x61, 0x70,
-0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D,
-0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76,
-0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22,
-0x29, 0x3B, 0x0D, 0x0A, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x42, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x42, 0x6F,
-0x78, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65,
-0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74,
-0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x2C, 0x20, 0x74, 0x72,
-0x75, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E,
-0x67, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B,
-0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x49, 0x64, 0x4F, 0x4B, 0x20, 0x3D, 0x20,
-0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x42, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74,
-0x65, 0x72, 0x42, 0x6F, 0x78, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x54, 0x68, 0x65, 0x20,
-0x42, 0x75, 0x73, 0x20, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x41, 0x54, 0x43, 0x4F, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x79, 0x6F,
-0x75, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62,
-0x65, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75,
-0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x42, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65,
-0x72, 0x42, 0x6F, 0x78, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x62, 0x75, 0x73, 0x46, 0x69,
-0x6C, 0x74, 0x65, 0x72, 0x42, 0x6F, 0x78, 0x22, 0x2C, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73,
-0x49, 0x64, 0x4F, 0x4B, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61,
-0x70, 0x70, 0x6C, 0x79, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F,
-0x6E, 0x73, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62,
-0x6F, 0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x61, 0x69, 0x6C,
-0x20, 0x3D, 0x20, 0x28, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E,
-0x73, 0x74, 0x20, 0x62, 0x75, 0x73, 0x20, 0x20, 0x3D, 0x20, 0x28, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x31,
-0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x6E, 0x72, 0x54, 0x22, 0x2C, 0x20, 0x72, 0x61, 0x69, 0x6C, 0x29,
-0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x6E, 0x72, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x42, 0x6F, 0x78, 0x22,
-0x2C, 0x20, 0x72, 0x61, 0x69, 0x6C, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x6E, 0x72, 0x43, 0x61, 0x6C,
-0x6C, 0x69, 0x6E, 0x67, 0x42, 0x6F, 0x78, 0x22, 0x2C, 0x20, 0x72, 0x61, 0x69, 0x6C, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F,
-0x77, 0x28, 0x22, 0x6E, 0x72, 0x41, 0x74, 0x74, 0x22, 0x2C, 0x20, 0x72, 0x61, 0x69, 0x6C, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68,
-0x6F, 0x77, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x42, 0x75, 0x73, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x72, 0x61, 0x69, 0x6C, 0x29, 0x3B,
-0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x22, 0x2C, 0x20,
-0x72, 0x61, 0x69, 0x6C, 0x20, 0x7C, 0x7C, 0x20, 0x62, 0x75, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22,
-0x6F, 0x70, 0x74, 0x46, 0x61, 0x73, 0x74, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x22, 0x2C, 0x20, 0x72, 0x61, 0x69, 0x6C,
-0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x4E, 0x6F, 0x53, 0x63, 0x72, 0x6F, 0x6C, 0x6C,
-0x22, 0x2C, 0x20, 0x72, 0x61, 0x69, 0x6C, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x62, 0x75, 0x73, 0x54,
-0x22, 0x2C, 0x20, 0x62, 0x75, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x62, 0x75, 0x73, 0x41, 0x74,
-0x63, 0x6F, 0x42, 0x6F, 0x78, 0x22, 0x2C, 0x20, 0x62, 0x75, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22,
-0x62, 0x74, 0x41, 0x74, 0x74, 0x22, 0x2C, 0x62, 0x75, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x62, 0x75, 0x73,
-0x29, 0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x41, 0x74, 0x63, 0x6F, 0x48, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x28, 0x29,
-0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x0D, 0x0A, 0x28, 0x72, 0x61, 0x69, 0x6C, 0x20, 0x26, 0x26, 0x20, 0x61, 0x70, 0x70,
-0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x20, 0x7C, 0x7C,
-0x0D, 0x0A, 0x28, 0x62, 0x75, 0x73, 0x20, 0x26, 0x26, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75,
-0x73, 0x49, 0x64, 0x4F, 0x4B, 0x29, 0x0D, 0x0A, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
-0x2E, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74,
-0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x3B, 0x0D, 0x0A,
-0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61,
-0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x2C, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3B, 0x0D, 0x0A,
-0x7D, 0x0D, 0x0A, 0x68, 0x69, 0x67, 0x68, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x4D, 0x6F, 0x64, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F,
-0x6E, 0x73, 0x28, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-0x6E, 0x20, 0x68, 0x69, 0x67, 0x68, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x4D, 0x6F, 0x64, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E,
-0x73, 0x28, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x7B, 0x0D, 0x0A, 0x24, 0x28, 0x22, 0x23, 0x62, 0x74, 0x6E, 0x52, 0x61, 0x69, 0x6C,
-0x22, 0x29, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x22, 0x61, 0x63, 0x74, 0x69, 0x76,
-0x65, 0x22, 0x2C, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x3D, 0x3D, 0x3D, 0x30, 0x29, 0x3B, 0x0D, 0x0A, 0x24, 0x28, 0x22, 0x23, 0x62,
-0x74, 0x6E, 0x42, 0x75, 0x73, 0x22, 0x29, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x22,
-0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x2C, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x3D, 0x3D, 0x3D, 0x31, 0x29, 0x3B, 0x0D, 0x0A,
-0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x41,
-0x74, 0x63, 0x6F, 0x46, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-0x61, 0x74, 0x63, 0x6F, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x3D, 0x20, 0x2F, 0x5E, 0x5C, 0x64, 0x7B, 0x33, 0x7D,
-0x30, 0x2E, 0x7B, 0x31, 0x2C, 0x7D, 0x24, 0x2F, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x61, 0x74, 0x63, 0x6F,
-0x56, 0x61, 0x6C, 0x20, 0x20, 0x3D, 0x20, 0x24, 0x28, 0x27, 0x23, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x27, 0x29, 0x2E,
-0x76, 0x61, 0x6C, 0x28, 0x29, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-0x61, 0x74, 0x63, 0x6F, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x20, 0x3D, 0x20, 0x61, 0x74, 0x63, 0x6F, 0x56, 0x61,
-0x6C, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3E, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-0x61, 0x74, 0x63, 0x6F, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x20, 0x3D, 0x20, 0x21, 0x61, 0x74, 0x63, 0x6F, 0x45, 0x6E, 0x74,
-0x65, 0x72, 0x65, 0x64, 0x20, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x74, 0x63, 0x6F, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x2E,
-0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x74, 0x63, 0x6F, 0x56, 0x61, 0x6C, 0x29, 0x3B, 0x0D, 0x0A, 0x24, 0x28, 0x27, 0x23, 0x76,
-0x65, 0x72, 0x69, 0x66, 0x79, 0x41, 0x74, 0x63, 0x6F, 0x27, 0x29, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x28, 0x27, 0x64, 0x69, 0x73,
-0x61, 0x62, 0x6C, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x21, 0x61, 0x74, 0x63, 0x6F, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x29, 0x3B, 0x0D,
-0x0A, 0x7D, 0x0D, 0x0A, 0x24, 0x28, 0x27, 0x23, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F, 0x27, 0x29, 0x2E, 0x6F, 0x6E, 0x28,
-0x27, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x27, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x29, 0x20,
-0x7B, 0x0D, 0x0A, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x41, 0x74, 0x63, 0x6F, 0x46, 0x6F, 0x72, 0x6D, 0x61, 0x74,
-0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74,
-0x74, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73,
-0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x2C, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65,
-0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72,
-0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75,
-0x73, 0x49, 0x64, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x74, 0x6F, 0x67, 0x67, 0x6C,
-0x65, 0x42, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x42, 0x6F, 0x78, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x29, 0x3B,
-0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E,
-0x67, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70,
-0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3B, 0x0D, 0x0A,
-0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x20,
-0x3D, 0x20, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x61,
-0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x43, 0x52, 0x53, 0x20, 0x3D, 0x20,
-0x73, 0x2E, 0x63, 0x72, 0x73, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74,
-0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x73,
-0x2E, 0x6C, 0x61, 0x74, 0x20, 0x7C, 0x7C, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E,
-0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x2E,
-0x6C, 0x6F, 0x6E, 0x20, 0x7C, 0x7C, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63,
-0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x63, 0x61, 0x6C,
-0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x61,
-0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x20, 0x3D, 0x20,
-0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A,
-0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74,
-0x65, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72,
-0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73,
-0x49, 0x64, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x49, 0x64, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A,
-0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x2E,
-0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x61, 0x74,
-0x20, 0x7C, 0x7C, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C,
-0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x20, 0x7C, 0x7C, 0x20, 0x30, 0x3B, 0x0D, 0x0A,
-0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x49, 0x64, 0x4F, 0x4B, 0x20, 0x3D, 0x20, 0x61, 0x70,
-0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x49, 0x64, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3E,
-0x20, 0x30, 0x20, 0x26, 0x26, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D,
-0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3E, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61,
-0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x46,
-0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74,
-0x65, 0x2E, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x6D, 0x6F, 0x64, 0x65, 0x20,
-0x3F, 0x3F, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x68, 0x69, 0x67, 0x68, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x4D, 0x6F, 0x64, 0x65, 0x42,
-0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x28, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x6F, 0x61, 0x72, 0x64,
-0x4D, 0x6F, 0x64, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64,
-0x65, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
-0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
-0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x76, 0x61, 0x6C,
-0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67,
-0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x70, 0x6C,
-0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20,
-0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74,
-0x65, 0x72, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x41, 0x74, 0x63, 0x6F,
-0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73,
-0x49, 0x64, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74,
-0x65, 0x72, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62,
-0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62,
-0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x62,
-0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x7C, 0x7C, 0x20, 0x35, 0x30, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E,
-0x73, 0x74, 0x20, 0x70, 0x63, 0x74, 0x20, 0x3D, 0x20, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x72,
-0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2F, 0x32, 0x35, 0x35, 0x29, 0x2A, 0x31,
-0x30, 0x30, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E,
-0x65, 0x73, 0x73, 0x2E, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x6F, 0x75, 0x6E,
-0x64, 0x28, 0x70, 0x63, 0x74, 0x29, 0x20, 0x2B, 0x20, 0x22, 0x25, 0x22, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x61, 0x70,
-0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
-0x29, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x67, 0x4E, 0x61, 0x6D,
-0x65, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x4C, 0x6F, 0x63, 0x61, 0x74, 0x69,
-0x6F, 0x6E, 0x3A, 0x20, 0x3C, 0x62, 0x3E, 0x22, 0x20, 0x2B, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62,
-0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x2B, 0x20, 0x22, 0x3C, 0x2F, 0x62, 0x3E, 0x22, 0x3B, 0x0D, 0x0A, 0x74, 0x6F, 0x67,
-0x67, 0x6C, 0x65, 0x42, 0x75, 0x73, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x42, 0x6F, 0x78, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x65,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-0x65, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x54, 0x5A, 0x20, 0x7C, 0x7C, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x73, 0x65, 0x74, 0x43,
-0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x54, 0x5A, 0x22, 0x2C, 0x20, 0x65, 0x6C, 0x65, 0x6D,
-0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x6C,
-0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D,
-0x54, 0x5A, 0x62, 0x6F, 0x78, 0x22, 0x2C, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74,
-0x6F, 0x6D, 0x54, 0x5A, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x3B, 0x0D, 0x0A,
-0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x2E, 0x76,
-0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x2E, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x7C, 0x7C, 0x20,
-0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x6F, 0x70, 0x74,
-0x48, 0x6F, 0x73, 0x74, 0x22, 0x2C, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F,
-0x6D, 0x48, 0x6F, 0x73, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x3B, 0x0D,
-0x0A, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x62, 0x6F, 0x78, 0x22,
-0x2C, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74,
-0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x65, 0x74, 0x43,
-0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x42, 0x75, 0x73, 0x65, 0x73, 0x22,
-0x2C, 0x20, 0x73, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x42, 0x75, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65,
-0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65,
-0x22, 0x2C, 0x20, 0x73, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65,
-0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x22,
-0x2C, 0x20, 0x73, 0x2E, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65,
-0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x61, 0x73, 0x74, 0x52, 0x65, 0x66, 0x72,
-0x65, 0x73, 0x68, 0x22, 0x2C, 0x20, 0x73, 0x2E, 0x66, 0x61, 0x73, 0x74, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x29, 0x3B,
-0x0D, 0x0A, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x6E, 0x6F, 0x53, 0x63, 0x72, 0x6F,
-0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x20, 0x73, 0x2E, 0x6E, 0x6F, 0x53, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x29, 0x3B, 0x0D,
-0x0A, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x46, 0x6C, 0x69, 0x70,
-0x22, 0x2C, 0x20, 0x73, 0x2E, 0x66, 0x6C, 0x69, 0x70, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74,
-0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x69, 0x64, 0x2C, 0x20, 0x76,
-0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B,
-0x65, 0x64, 0x20, 0x3D, 0x20, 0x21, 0x21, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65,
-0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D,
-0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D,
-0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x43, 0x52, 0x53, 0x20,
-0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x63, 0x72, 0x73, 0x43, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53,
-0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x20,
-0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70,
-0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64,
-0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B, 0x0D, 0x0A,
-0x69, 0x66, 0x20, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x22, 0x4C, 0x4F, 0x4E, 0x44, 0x4F, 0x4E, 0x5F, 0x55, 0x4E, 0x44, 0x45, 0x52, 0x47,
-0x52, 0x4F, 0x55, 0x4E, 0x44, 0x22, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73,
-0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x2C, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3B, 0x0D,
-0x0A, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73,
-0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69,
-0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D,
-0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61,
-0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28,
-0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C,
-0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D,
-0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C,
-0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D,
-0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43,
-0x72, 0x73, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x63, 0x72, 0x73, 0x43, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x7D,
-0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x73, 0x74, 0x46, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x69, 0x66, 0x20,
-0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C,
-0x65, 0x63, 0x74, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x65,
-0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53,
-0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x7D, 0x20,
-0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D,
-0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C,
-0x65, 0x43, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x73, 0x74, 0x46, 0x6F,
-0x63, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74,
-0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63,
-0x74, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C,
-0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70,
-0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-0x3B, 0x0D, 0x0A, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
-0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74,
-0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75,
-0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x46, 0x69, 0x6C,
-0x74, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C,
-0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61,
-0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x22,
-0x22, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53,
-0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73,
-0x65, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53,
-0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61,
-0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A, 0x7D,
-0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x42, 0x72, 0x69, 0x67,
-0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x43, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E,
-0x73, 0x74, 0x20, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E,
-0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E,
-0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x3D,
-0x20, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x3B, 0x0D, 0x0A, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x60,
-0x2F, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x3F, 0x62, 0x3D, 0x24, 0x7B, 0x62, 0x72, 0x69, 0x67, 0x68,
-0x74, 0x6E, 0x65, 0x73, 0x73, 0x7D, 0x60, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x70, 0x63, 0x74, 0x20,
-0x3D, 0x20, 0x28, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x2F, 0x32, 0x35, 0x35, 0x29, 0x2A, 0x31, 0x30,
-0x30, 0x3B, 0x0D, 0x0A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x4D, 0x61, 0x74, 0x68,
-0x2E, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x28, 0x70, 0x63, 0x74, 0x29, 0x20, 0x2B, 0x20, 0x22, 0x25, 0x22, 0x3B, 0x0D, 0x0A, 0x7D,
-0x0D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64,
-0x6C, 0x65, 0x53, 0x61, 0x76, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x20, 0x3D,
-0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67,
-0x73, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x28, 0x73, 0x2E, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x7C,
-0x7C, 0x20, 0x22, 0x22, 0x29, 0x20, 0x21, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73,
-0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x29,
-0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65, 0x65, 0x64, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74,
-0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D,
-0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65,
-0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x63, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73,
-0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x43, 0x52, 0x53, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x6C, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x61,
-0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x61, 0x74, 0x69, 0x74, 0x75,
-0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x6C, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
-0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x73,
-0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70,
-0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3B,
-0x0D, 0x0A, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53,
-0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x70,
-0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3B, 0x0D, 0x0A,
-0x73, 0x2E, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x6F, 0x61,
-0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73,
-0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73,
-0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x42, 0x75, 0x73, 0x20, 0x3D,
-0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x42, 0x75, 0x73,
-0x65, 0x73, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43,
-0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72,
-0x65, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43,
-0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72,
-0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x66, 0x61, 0x73, 0x74, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x20, 0x3D, 0x20,
-0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x61, 0x73, 0x74,
-0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x6E, 0x6F, 0x53, 0x63, 0x72, 0x6F, 0x6C,
-0x6C, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x6E, 0x6F, 0x53, 0x63, 0x72, 0x6F,
-0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x66, 0x6C, 0x69, 0x70, 0x20, 0x3D, 0x20, 0x69, 0x73,
-0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x46, 0x6C, 0x69, 0x70, 0x22, 0x29, 0x3B, 0x0D, 0x0A,
-0x69, 0x66, 0x20, 0x28, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x49, 0x64, 0x4F, 0x4B, 0x29,
-0x20, 0x7B, 0x0D, 0x0A, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x49, 0x64,
-0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x49, 0x64, 0x3B, 0x0D, 0x0A, 0x73,
-0x2E, 0x62, 0x75, 0x73, 0x4C, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75,
-0x73, 0x4C, 0x61, 0x74, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70,
-0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x4C, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A, 0x73, 0x2E, 0x62, 0x75, 0x73, 0x46,
-0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x62, 0x75, 0x73, 0x46,
-0x69, 0x6C, 0x74, 0x65, 0x72, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63,
-0x6B, 0x65, 0x64, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x54, 0x5A, 0x22, 0x29, 0x20, 0x26, 0x26, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
-0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x74, 0x72,
-0x69, 0x6D, 0x28, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x20, 0x73, 0x2E, 0x54, 0x5A, 0x20, 0x3D, 0x20, 0x65,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x54, 0x5A, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-0x65, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65,
-0x20, 0x73, 0x2E, 0x54, 0x5A, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64,
-0x28, 0x22, 0x6F, 0x70, 0x74, 0x48, 0x6F, 0x73, 0x74, 0x22, 0x29, 0x20, 0x26, 0x26, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x48, 0x6F, 0x73, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x74,
-0x72, 0x69, 0x6D, 0x28, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x20, 0x73, 0x2E, 0x68, 0x6F, 0x73, 0x74, 0x6E,
-0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D,
-0x48, 0x6F, 0x73, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x20, 0x65, 0x6C,
-0x73, 0x65, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x73, 0x2E, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x3B,
-0x0D, 0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E,
-0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x60, 0x2F, 0x73, 0x61,
-0x76, 0x65, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x24, 0x7B, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E,
-0x6E, 0x65, 0x65, 0x64, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3F, 0x20, 0x27, 0x3F, 0x72, 0x65, 0x62, 0x6F, 0x6F,
-0x74, 0x3D, 0x31, 0x27, 0x20, 0x3A, 0x20, 0x27, 0x27, 0x7D, 0x60, 0x2C, 0x20, 0x7B, 0x0D, 0x0A, 0x6D, 0x65, 0x74, 0x68, 0x6F,
-0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0D, 0x0A, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20,
-0x7B, 0x20, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70,
-0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20, 0x7D, 0x2C, 0x0D, 0x0A, 0x62,
-0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x73,
-0x29, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20,
-0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
-0x3B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x20, 0x63, 0x61,
-0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x60, 0x46,
-0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67,
-0x73, 0x3A, 0x20, 0x24, 0x7B, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60, 0x29, 0x3B, 0x0D,
-0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65,
-0x63, 0x6B, 0x65, 0x64, 0x28, 0x69, 0x64, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x6F,
-0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
-0x28, 0x69, 0x64, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x69, 0x64, 0x2C, 0x73, 0x68, 0x6F, 0x77, 0x6D, 0x65, 0x29,
-0x20, 0x7B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x73, 0x68, 0x6F, 0x77, 0x6D, 0x65, 0x29, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64,
-0x29, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x22, 0x62, 0x6C,
-0x6F, 0x63, 0x6B, 0x22, 0x3B, 0x0D, 0x0A, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
-0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x2E, 0x73, 0x74,
-0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3B,
-0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x2F, 0x2F, 0x20, 0x4D, 0x65, 0x6E, 0x75, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73,
-0x0D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64,
-0x6C, 0x65, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x74,
-0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20,
-0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A,
-0x2F, 0x2F, 0x61, 0x70, 0x69, 0x2E, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x72, 0x65, 0x70, 0x6F,
-0x73, 0x2F, 0x67, 0x61, 0x64, 0x65, 0x63, 0x2D, 0x75, 0x6B, 0x2F, 0x74, 0x69, 0x6E, 0x79, 0x2D, 0x64, 0x65, 0x70, 0x61, 0x72,
-0x74, 0x75, 0x72, 0x65, 0x73, 0x2D, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x2F,
-0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6F,
-0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72,
-0x6F, 0x72, 0x28, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x74,
-0x68, 0x65, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x69, 0x6E, 0x66,
-0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x47, 0x69, 0x74, 0x48, 0x75, 0x62, 0x2E,
-0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61,
-0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0D, 0x0A,
-0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74,
-0x61, 0x2E, 0x74, 0x61, 0x67, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x75,
-0x72, 0x72, 0x65, 0x6E, 0x74, 0x54, 0x61, 0x67, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x66,
-0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73,
-0x74, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x44, 0x65, 0x73, 0x63, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6E,
-0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x20,
-0x7C, 0x7C, 0x20, 0x21, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x54, 0x61, 0x67, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C,
-0x65, 0x72, 0x74, 0x28, 0x22, 0x43, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72,
-0x65, 0x20, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x22,
-0x29, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x28, 0x73, 0x74, 0x72, 0x29,
-0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x3D, 0x20,
-0x73, 0x74, 0x72, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x2F, 0x42, 0x28, 0x5C, 0x64, 0x2B, 0x29, 0x5C, 0x2E, 0x28, 0x5C,
-0x64, 0x2B, 0x29, 0x2D, 0x57, 0x28, 0x5C, 0x64, 0x2B, 0x29, 0x5C, 0x2E, 0x28, 0x5C, 0x64, 0x2B, 0x29, 0x2F, 0x29, 0x3B, 0x0D,
-0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x0D, 0x0A, 0x3F, 0x20, 0x7B, 0x0D, 0x0A, 0x42,
-0x3A, 0x20, 0x7B, 0x20, 0x6D, 0x61, 0x6A, 0x6F, 0x72, 0x3A, 0x20, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x28, 0x6D, 0x61, 0x74,
-0x63, 0x68, 0x5B, 0x31, 0x5D, 0x29, 0x2C, 0x20, 0x6D, 0x69, 0x6E, 0x6F, 0x72, 0x3A, 0x20, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72,
-0x28, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x5B, 0x32, 0x5D, 0x29, 0x20, 0x7D, 0x2C, 0x0D, 0x0A, 0x57, 0x3A, 0x20, 0x7B, 0x20, 0x6D,
-0x61, 0x6A, 0x6F, 0x72, 0x3A, 0x20, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x28, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x5B, 0x33, 0x5D,
-0x29, 0x2C, 0x20, 0x6D, 0x69, 0x6E, 0x6F, 0x72, 0x3A, 0x20, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x28, 0x6D, 0x61, 0x74, 0x63,
-0x68, 0x5B, 0x34, 0x5D, 0x29, 0x20, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x3A, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x0D, 0x0A,
-0x7D, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x69, 0x73, 0x4E, 0x65, 0x77, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x28,
-0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2C, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B,
-0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2E, 0x6D, 0x61, 0x6A, 0x6F, 0x72, 0x20, 0x21, 0x3D,
-0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2E, 0x6D, 0x61, 0x6A, 0x6F, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x72,
-0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2E, 0x6D, 0x61, 0x6A, 0x6F, 0x72, 0x20, 0x3E, 0x20,
-0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2E, 0x6D, 0x61, 0x6A, 0x6F, 0x72, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x72, 0x65,
-0x74, 0x75, 0x72, 0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2E, 0x6D, 0x69, 0x6E, 0x6F, 0x72, 0x20, 0x3E, 0x20, 0x63,
-0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2E, 0x6D, 0x69, 0x6E, 0x6F, 0x72, 0x3B, 0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A, 0x63, 0x6F,
-0x6E, 0x73, 0x74, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x56, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x28, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E,
-0x73, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x56, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x54, 0x61, 0x67, 0x29, 0x3B, 0x0D, 0x0A, 0x69, 0x66,
-0x20, 0x28, 0x21, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x7C, 0x7C, 0x20, 0x21, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
-0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x20,
-0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69,
-0x64, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x69, 0x66,
-0x20, 0x28, 0x69, 0x73, 0x4E, 0x65, 0x77, 0x65, 0x72, 0x28, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2E, 0x42, 0x2C, 0x20, 0x63,
-0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2E, 0x42, 0x29, 0x20, 0x7C, 0x7C, 0x20, 0x69, 0x73, 0x4E, 0x65, 0x77, 0x65, 0x72, 0x28,
-0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2E, 0x57, 0x2C, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2E, 0x57, 0x29, 0x29,
-0x20, 0x7B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x28, 0x60, 0x41, 0x6E, 0x20, 0x75,
-0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x24, 0x7B, 0x6C, 0x61,
-0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x7D, 0x20, 0x69, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65,
-0x2E, 0x5C, 0x6E, 0x5C, 0x6E, 0x42, 0x72, 0x69, 0x65, 0x66, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F,
-0x6E, 0x3A, 0x20, 0x22, 0x24, 0x7B, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x44, 0x65, 0x73, 0x63, 0x7D, 0x22, 0x2E, 0x5C, 0x6E,
-0x5C, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x5C, 0x27, 0x4F, 0x4B, 0x5C, 0x27, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x73,
-0x74, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x6E, 0x6F, 0x77, 0x20, 0x6F,
-0x72, 0x20, 0x5C, 0x27, 0x43, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x5C, 0x27, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74,
-0x2E, 0x60, 0x29, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6F, 0x74, 0x61, 0x27, 0x2C,
-0x20, 0x7B, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D, 0x29, 0x0D, 0x0A,
-0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x3E, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74,
-0x28, 0x29, 0x29, 0x0D, 0x0A, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65,
-0x72, 0x74, 0x28, 0x6D, 0x73, 0x67, 0x29, 0x29, 0x0D, 0x0A, 0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x20,
-0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69,
-0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72,
-0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x20, 0x65, 0x6C, 0x73,
-0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x4E, 0x6F, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
-0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x61, 0x72, 0x65, 0x20,
-0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73,
-0x69, 0x6F, 0x6E, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28,
-0x65, 0x72, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72,
-0x28, 0x65, 0x72, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20,
-0x63, 0x68, 0x65, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x3A,
-0x20, 0x22, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x7D,
-0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43,
-0x6C, 0x65, 0x61, 0x72, 0x57, 0x69, 0x66, 0x69, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6E,
-0x66, 0x69, 0x72, 0x6D, 0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x79, 0x6F,
-0x75, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20,
-0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3F, 0x27, 0x29, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x66, 0x65, 0x74, 0x63, 0x68,
-0x28, 0x27, 0x2F, 0x65, 0x72, 0x61, 0x73, 0x65, 0x77, 0x69, 0x66, 0x69, 0x27, 0x2C, 0x20, 0x7B, 0x20, 0x6D, 0x65, 0x74, 0x68,
-0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D, 0x29, 0x0D, 0x0A, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72,
-0x65, 0x73, 0x20, 0x3D, 0x3E, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x29, 0x0D, 0x0A, 0x2E, 0x74,
-0x68, 0x65, 0x6E, 0x28, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x6D, 0x73, 0x67, 0x29,
-0x29, 0x0D, 0x0A, 0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72,
-0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x57, 0x69, 0x46,
-0x69, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x29, 0x3B,
-0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64,
-0x6C, 0x65, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A,
-0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20,
-0x73, 0x75, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x74,
-0x61, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x3F, 0x27, 0x29, 0x29, 0x20, 0x7B, 0x0D,
-0x0A, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x27, 0x2C, 0x20, 0x7B, 0x20, 0x6D,
-0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D, 0x29, 0x0D, 0x0A, 0x2E, 0x74, 0x68, 0x65,
-0x6E, 0x28, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x3E, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x29, 0x0D,
-0x0A, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x6D,
-0x73, 0x67, 0x29, 0x29, 0x0D, 0x0A, 0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x61,
-0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E,
-0x67, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73,
-0x73, 0x61, 0x67, 0x65, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x68, 0x6F, 0x77, 0x54, 0x65, 0x73, 0x74, 0x43, 0x61, 0x72, 0x64,
-0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x74, 0x65, 0x73, 0x74, 0x63, 0x61, 0x72,
-0x64, 0x27, 0x2C, 0x20, 0x7B, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D,
-0x29, 0x0D, 0x0A, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x3E, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x74,
-0x65, 0x78, 0x74, 0x28, 0x29, 0x29, 0x0D, 0x0A, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 0x20,
-0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x6D, 0x73, 0x67, 0x29, 0x29, 0x0D, 0x0A, 0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65,
-0x72, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x61, 0x63,
-0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x61,
-0x74, 0x74, 0x65, 0x72, 0x6E, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67,
-0x65, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0D, 0x0A, 0x3C,
-0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0D, 0x0A
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xC5, 0x3D, 0x69, 0x77, 0xD3, 0xC8, 0xB2, 0xDF, 0x39, 0x87, 0xFF,
+0xD0, 0x08, 0xEE, 0x58, 0x1A, 0x6C, 0xD9, 0x61, 0xBB, 0x4C, 0x82, 0x93, 0x97, 0x04, 0x18, 0xB8, 0x90, 0x84, 0x43, 0x02, 0xCC,
+0x00, 0x79, 0x83, 0x2C, 0x75, 0x6C, 0x11, 0x59, 0x12, 0x5A, 0x92, 0x98, 0x4C, 0xFE, 0xFB, 0xAB, 0xEA, 0x45, 0xEA, 0xD6, 0x16,
+0x07, 0x32, 0xF7, 0x7D, 0x00, 0x4B, 0xBD, 0x54, 0x57, 0x57, 0x57, 0xD7, 0xDA, 0xAD, 0x3C, 0xB9, 0xF5, 0x74, 0x6F, 0xFB, 0xE0,
+0xCF, 0x37, 0xCF, 0xC8, 0x2C, 0x9B, 0x07, 0xEB, 0x37, 0x6F, 0x3C, 0xC1, 0x5F, 0x12, 0x38, 0xE1, 0x74, 0x6C, 0xD0, 0xD0, 0x60,
+0x25, 0xD4, 0xF1, 0xF0, 0x37, 0xF0, 0xC3, 0x63, 0x92, 0xD0, 0x60, 0x6C, 0xA4, 0xD9, 0x22, 0xA0, 0xE9, 0x8C, 0xD2, 0xCC, 0x20,
+0xB3, 0x84, 0x1E, 0x8D, 0x8D, 0x59, 0x96, 0xC5, 0xE9, 0xEA, 0x70, 0xE8, 0x7A, 0xA1, 0xFD, 0x35, 0xF5, 0x68, 0xE0, 0x9F, 0x24,
+0x76, 0x48, 0xB3, 0x61, 0x18, 0xCF, 0x87, 0x93, 0x28, 0xCA, 0xD2, 0x2C, 0x71, 0xE2, 0xFF, 0xB9, 0x6F, 0x3F, 0xB0, 0x57, 0x86,
+0x9E, 0x9F, 0x66, 0x43, 0x37, 0x4D, 0xCB, 0x0A, 0x7B, 0xEE, 0x87, 0x36, 0x94, 0x18, 0xC4, 0x0F, 0x33, 0x3A, 0x4D, 0xFC, 0x6C,
+0x01, 0xA3, 0xCC, 0x9C, 0xFB, 0x8F, 0x1F, 0x0C, 0x5E, 0xEC, 0xEF, 0x9C, 0xB9, 0x6F, 0x0F, 0xDE, 0x9E, 0x85, 0xBB, 0x77, 0xB7,
+0xBC, 0xE9, 0xE8, 0x3F, 0xDE, 0xE4, 0xEC, 0xCF, 0x57, 0xC9, 0xC1, 0x8C, 0xBA, 0x7B, 0xAF, 0xF2, 0x17, 0x0F, 0xBF, 0x6F, 0xFF,
+0x19, 0x65, 0xC1, 0xFE, 0xA6, 0x1B, 0xAF, 0xDC, 0x75, 0x1F, 0x9F, 0xCD, 0x17, 0x07, 0xF4, 0xB7, 0xDF, 0xFF, 0x9C, 0xAE, 0x04,
+0xBF, 0x39, 0x8F, 0x7E, 0x8B, 0xD3, 0xDC, 0x20, 0x6E, 0x12, 0xA5, 0x69, 0x94, 0xF8, 0x53, 0x3F, 0x1C, 0x1B, 0x4E, 0x18, 0x85,
+0x8B, 0x79, 0x94, 0xA7, 0x6C, 0x6E, 0xA9, 0x9B, 0xF8, 0x71, 0x46, 0xD2, 0xC4, 0x2D, 0xE7, 0xE0, 0x7C, 0x75, 0xCE, 0xEC, 0x69,
+0x14, 0x4D, 0x03, 0xEA, 0xC4, 0x7E, 0x6A, 0xBB, 0xD1, 0x9C, 0x95, 0x0D, 0x03, 0x7F, 0x92, 0x0E, 0xBF, 0x7E, 0xCB, 0x69, 0xB2,
+0x18, 0xDE, 0xB7, 0xFF, 0x0D, 0x33, 0xE1, 0x2F, 0x0C, 0xFB, 0xAF, 0x00, 0xF0, 0xC9, 0x90, 0xC3, 0x6B, 0x83, 0xBC, 0x3C, 0x75,
+0xBE, 0x56, 0x89, 0xF3, 0xB5, 0x91, 0x36, 0xCE, 0x7F, 0xEE, 0xAD, 0xEC, 0x7D, 0x0D, 0x76, 0xFE, 0xD8, 0x7D, 0xFD, 0xF0, 0xDD,
+0xE2, 0x65, 0x30, 0xFC, 0x63, 0xF7, 0xF4, 0x60, 0xE7, 0xDB, 0xC9, 0x77, 0xFA, 0x76, 0xE7, 0xE3, 0x8B, 0x7B, 0xA7, 0x8F, 0xDD,
+0x87, 0xEE, 0xDB, 0xF7, 0xF1, 0xF7, 0xF8, 0xDD, 0xE3, 0x3F, 0x1F, 0x4E, 0x36, 0xE3, 0x83, 0x38, 0xDE, 0xCF, 0xDF, 0x1D, 0xCF,
+0x3E, 0xFE, 0xB1, 0x3B, 0x7A, 0x7F, 0xF6, 0xC2, 0x6B, 0xA7, 0xCD, 0x12, 0x53, 0xF9, 0x0A, 0xA4, 0x09, 0xA2, 0xDC, 0x3B, 0x0A,
+0x9C, 0x84, 0x56, 0xA8, 0x54, 0x20, 0x3F, 0xB8, 0x3F, 0xC8, 0x16, 0x31, 0x75, 0x90, 0x89, 0x86, 0x0F, 0xEC, 0x91, 0x7D, 0xAF,
+0xAC, 0x53, 0xAA, 0x1A, 0x49, 0x38, 0xA7, 0x99, 0x43, 0xDC, 0x99, 0x93, 0xA4, 0x34, 0x1B, 0x1B, 0xEF, 0x0E, 0x9E, 0x0F, 0x1E,
+0x1B, 0x45, 0x79, 0xE8, 0xCC, 0xE9, 0xD8, 0x38, 0xF1, 0xE9, 0x69, 0x1C, 0x25, 0xC0, 0x87, 0x6E, 0x04, 0xD4, 0x09, 0xA1, 0x5D,
+0x9E, 0xD2, 0x64, 0x90, 0xBA, 0x4E, 0xE0, 0x4C, 0x02, 0x3A, 0x0E, 0xA3, 0x3E, 0xD0, 0xCD, 0xCF, 0x7C, 0x27, 0x60, 0x85, 0x74,
+0xBC, 0xD2, 0x27, 0x73, 0xE7, 0xCC, 0x9F, 0xE7, 0x73, 0xA5, 0x00, 0x9A, 0x68, 0x05, 0xA7, 0xBE, 0x97, 0xCD, 0xC6, 0x1E, 0x3D,
+0xF1, 0x5D, 0x3A, 0x60, 0x2F, 0xD5, 0x91, 0x9D, 0x38, 0x0E, 0xE8, 0x60, 0x1E, 0x4D, 0x7C, 0xF8, 0x39, 0xA5, 0x93, 0x01, 0x14,
+0x0C, 0x5C, 0x27, 0xC6, 0x51, 0x15, 0x6C, 0x16, 0x34, 0x35, 0x86, 0xCB, 0x74, 0x4D, 0x33, 0x27, 0xCB, 0xD3, 0xC1, 0xC4, 0x01,
+0xE4, 0x71, 0x7B, 0x29, 0x30, 0x3C, 0x7A, 0xE4, 0xE4, 0x41, 0xC6, 0xE1, 0x94, 0xBB, 0x90, 0x83, 0xC9, 0xA2, 0xDC, 0x9D, 0x0D,
+0x7C, 0x68, 0x2C, 0xF7, 0xE2, 0x91, 0x73, 0x82, 0xAF, 0x76, 0x1C, 0x4E, 0x0D, 0xBD, 0x47, 0x5B, 0x2B, 0x82, 0xEB, 0x00, 0xD5,
+0x73, 0x67, 0x4A, 0x87, 0x58, 0xC0, 0x46, 0xCA, 0xFC, 0x2C, 0xA0, 0xEB, 0x07, 0x7E, 0xB8, 0x20, 0x4F, 0x69, 0xEC, 0x24, 0x59,
+0x9E, 0xD0, 0x94, 0x6C, 0x45, 0x4E, 0xE2, 0x3D, 0x19, 0xF2, 0x4A, 0x68, 0x35, 0x94, 0xE2, 0x61, 0x12, 0x79, 0x0B, 0xFC, 0xF5,
+0xFC, 0x13, 0xC2, 0x66, 0x30, 0x36, 0x18, 0xE1, 0x56, 0x91, 0xBA, 0xE6, 0x6F, 0xA3, 0x7F, 0xF5, 0xC9, 0xC3, 0xD1, 0x28, 0x3E,
+0xB3, 0xD6, 0x80, 0xFE, 0x09, 0xF0, 0xDB, 0x2A, 0x19, 0x11, 0x27, 0xCF, 0xA2, 0x35, 0x12, 0x3B, 0x9E, 0xE7, 0x87, 0x53, 0x2C,
+0x78, 0x18, 0x9F, 0xAD, 0x31, 0xAC, 0x8F, 0xA2, 0x64, 0x4E, 0x7C, 0x0F, 0x10, 0x85, 0x07, 0x60, 0x80, 0x0C, 0x1A, 0xF0, 0x3D,
+0x7B, 0xE4, 0xD3, 0xC0, 0x83, 0x12, 0x36, 0x37, 0x3A, 0xA5, 0xA1, 0x27, 0xC7, 0x8B, 0xA3, 0x14, 0x56, 0x3A, 0x02, 0xC8, 0x30,
+0x5D, 0x27, 0xF3, 0x4F, 0xE8, 0x1A, 0xC9, 0xE8, 0x59, 0x36, 0x70, 0x02, 0x7F, 0x0A, 0xA5, 0x2E, 0x90, 0x93, 0x26, 0x6B, 0x88,
+0xD0, 0x60, 0x46, 0xFD, 0xE9, 0x2C, 0x5B, 0x25, 0x0F, 0x70, 0x44, 0x89, 0x01, 0x50, 0x33, 0x5E, 0x7D, 0x2C, 0x51, 0xC0, 0x99,
+0x20, 0x06, 0x61, 0x72, 0x60, 0xC8, 0x21, 0x60, 0x77, 0xC6, 0x81, 0xB3, 0x58, 0x85, 0x9D, 0x42, 0x8D, 0xF5, 0xB7, 0x8E, 0x1F,
+0x34, 0x10, 0x07, 0x3A, 0xAA, 0xFD, 0x27, 0x79, 0xDA, 0x06, 0x60, 0x2B, 0x4F, 0xBB, 0xFB, 0xBB, 0x81, 0x93, 0xA6, 0xD0, 0x2B,
+0x89, 0x62, 0x2F, 0x3A, 0x0D, 0x8D, 0xFA, 0x54, 0x9D, 0x49, 0x1A, 0x05, 0x79, 0x86, 0x53, 0x05, 0xE4, 0x19, 0x01, 0x49, 0xC2,
+0xE7, 0x36, 0xE2, 0xF3, 0x98, 0xE4, 0x59, 0x16, 0x85, 0x12, 0xD4, 0x24, 0x0B, 0x09, 0xFC, 0x1B, 0x08, 0xAE, 0x22, 0x12, 0x34,
+0xCC, 0x7D, 0x3A, 0x45, 0xBE, 0xE3, 0xCC, 0xC0, 0x3B, 0x19, 0x6C, 0x02, 0x73, 0x1A, 0xE6, 0x5B, 0xE2, 0xDD, 0x73, 0x32, 0x47,
+0x34, 0x55, 0xD1, 0x72, 0x12, 0xDF, 0x19, 0xCC, 0x9C, 0x34, 0x8E, 0xE2, 0x3C, 0x1E, 0x1B, 0x59, 0x92, 0x53, 0x51, 0x48, 0xCF,
+0x62, 0x27, 0xF4, 0xA8, 0x27, 0x0A, 0x01, 0xA1, 0x5F, 0x6E, 0xFF, 0xF6, 0xEF, 0x7F, 0x3F, 0x5A, 0x43, 0xE6, 0xE1, 0xA3, 0x20,
+0x92, 0x79, 0x50, 0x9D, 0xEB, 0x00, 0x87, 0x25, 0xDA, 0xDB, 0x80, 0x4D, 0x4C, 0x00, 0x86, 0x0D, 0x4E, 0x83, 0x80, 0x7A, 0x93,
+0x85, 0x86, 0x21, 0x67, 0xF9, 0xF5, 0x27, 0x8E, 0x60, 0xF4, 0xDB, 0x06, 0x89, 0x42, 0x37, 0xF0, 0xDD, 0x63, 0x90, 0x5E, 0x80,
+0x49, 0x40, 0xB7, 0x41, 0x75, 0x1C, 0xBF, 0x8B, 0x61, 0x26, 0x34, 0x35, 0x2D, 0x63, 0x9D, 0xBD, 0x13, 0xE0, 0x33, 0x22, 0x0A,
+0x9F, 0x0C, 0x1D, 0x10, 0x44, 0x00, 0xA4, 0x02, 0x6A, 0x78, 0x4C, 0x17, 0xA9, 0x0D, 0x1A, 0xD2, 0x58, 0x7F, 0xE6, 0xF9, 0x19,
+0xD9, 0x7C, 0xF3, 0x92, 0xBC, 0x82, 0xA2, 0xB6, 0xF6, 0x0D, 0x43, 0x83, 0x4E, 0x49, 0x3E, 0xF8, 0x47, 0x3E, 0x1B, 0x17, 0x5F,
+0xC8, 0x07, 0xFF, 0xB9, 0x4F, 0xF6, 0x05, 0x83, 0x2F, 0x0F, 0x69, 0x7F, 0x16, 0x9D, 0x1E, 0xD0, 0x34, 0xDB, 0x06, 0x8E, 0x41,
+0x60, 0x4F, 0x39, 0x5F, 0x91, 0x4D, 0x64, 0x75, 0x20, 0x47, 0xB6, 0x3C, 0xA8, 0xB7, 0x00, 0x06, 0x38, 0x70, 0x7F, 0x91, 0x66,
+0x74, 0x8E, 0xB0, 0x44, 0x01, 0xE1, 0x25, 0x2A, 0xA0, 0x61, 0xCE, 0x8C, 0x04, 0xC9, 0xA1, 0x43, 0xBE, 0xFF, 0xF0, 0xF1, 0xD6,
+0x60, 0xC0, 0xD9, 0x97, 0xEC, 0x44, 0x1E, 0x85, 0x09, 0x05, 0xD4, 0xCD, 0x80, 0xA4, 0x83, 0x41, 0x85, 0x95, 0x71, 0x3F, 0x0F,
+0xA6, 0x49, 0x94, 0xC7, 0x82, 0xB9, 0xA0, 0xB9, 0x6C, 0xCD, 0x17, 0x0F, 0xD7, 0x55, 0xB6, 0x46, 0x21, 0x98, 0x44, 0x01, 0x5F,
+0x6C, 0xD8, 0x2F, 0xC5, 0x08, 0x30, 0x36, 0x16, 0x55, 0x80, 0x23, 0x63, 0x33, 0xD8, 0xA4, 0x78, 0x1A, 0x7C, 0xCD, 0xD3, 0x0C,
+0x28, 0x4E, 0xBD, 0x0A, 0xF3, 0x72, 0xDE, 0x4B, 0x95, 0x31, 0xD9, 0x66, 0xCD, 0x42, 0xDC, 0xD5, 0x46, 0xCB, 0x76, 0x61, 0xAD,
+0xFD, 0x30, 0xCE, 0x33, 0xB1, 0x4F, 0x12, 0xC7, 0xF3, 0x23, 0x43, 0x48, 0xF6, 0x09, 0xA2, 0x87, 0x13, 0x2A, 0xA7, 0xC6, 0x81,
+0x9D, 0x38, 0x41, 0x0E, 0xF5, 0x23, 0x63, 0x9D, 0x60, 0x01, 0x23, 0x9D, 0x44, 0x5F, 0x1B, 0x1B, 0x04, 0xC2, 0xB5, 0x0D, 0xCD,
+0x60, 0x89, 0x91, 0x57, 0x60, 0x64, 0x78, 0xD7, 0x06, 0x2E, 0x56, 0xB1, 0x2E, 0x6F, 0xAA, 0x8B, 0x14, 0x26, 0xFB, 0xC0, 0xAB,
+0xEE, 0x6C, 0x2B, 0x3A, 0x6B, 0x91, 0x64, 0xDD, 0x0B, 0x87, 0xBB, 0x0B, 0xAC, 0x16, 0x06, 0x63, 0x17, 0xF0, 0x35, 0xD6, 0xF7,
+0x41, 0xDF, 0x81, 0xFC, 0x52, 0xD0, 0xE1, 0x53, 0xC3, 0xD1, 0x94, 0x76, 0x62, 0xAA, 0x28, 0xC5, 0x0D, 0x02, 0xC3, 0xB9, 0x74,
+0x16, 0x05, 0x1E, 0x05, 0x60, 0x07, 0x50, 0x41, 0xB2, 0x19, 0x25, 0x29, 0x87, 0xC4, 0xE8, 0x60, 0x68, 0x13, 0x10, 0x38, 0x10,
+0x06, 0x79, 0x30, 0xF7, 0x48, 0x61, 0x6F, 0x18, 0x4B, 0xCE, 0x1B, 0x44, 0xF7, 0x66, 0xE6, 0x46, 0x3F, 0x37, 0x6D, 0x01, 0x84,
+0x4B, 0xFB, 0x7D, 0x90, 0xD2, 0x64, 0xF3, 0x60, 0x7B, 0x0F, 0xF4, 0x7B, 0x8D, 0x8B, 0x2B, 0x43, 0x90, 0xA3, 0x80, 0x82, 0x34,
+0x9F, 0x3A, 0x20, 0xD7, 0x57, 0x46, 0xAA, 0x5A, 0x12, 0x0D, 0xB1, 0x1E, 0xAA, 0xD6, 0x0C, 0x9D, 0x7E, 0x72, 0xC0, 0x76, 0xE2,
+0x3D, 0x43, 0x45, 0xC8, 0xA8, 0x57, 0xA0, 0x42, 0x40, 0x16, 0x90, 0x18, 0xB4, 0x50, 0x4A, 0x4E, 0x68, 0xE2, 0x1F, 0x2D, 0xBA,
+0x69, 0x69, 0xE8, 0x4A, 0x7E, 0x65, 0x34, 0xFA, 0xD7, 0x5A, 0x8D, 0xAA, 0x0A, 0x9A, 0x83, 0x74, 0x96, 0x80, 0x21, 0x52, 0x55,
+0x4A, 0x88, 0x2E, 0x1F, 0x8E, 0x63, 0x2C, 0xCC, 0x3A, 0xA5, 0xA4, 0xDC, 0x0C, 0x55, 0xD5, 0x04, 0x64, 0x42, 0x6B, 0xCB, 0x5B,
+0x7F, 0xCF, 0x9A, 0xAB, 0xDA, 0xA4, 0xCA, 0xDA, 0x29, 0xE8, 0x20, 0x09, 0x69, 0x46, 0x83, 0x78, 0x30, 0x09, 0x22, 0xF7, 0x58,
+0x5B, 0xE3, 0xD7, 0x51, 0x38, 0xE5, 0xAC, 0x09, 0x36, 0x28, 0x34, 0xAF, 0x68, 0xF0, 0xE7, 0x7E, 0x00, 0x24, 0x53, 0x19, 0x81,
+0x5B, 0x31, 0x83, 0x49, 0x04, 0x83, 0xCE, 0x57, 0xD9, 0xFA, 0x90, 0x1F, 0x62, 0x0E, 0x0E, 0xDA, 0x58, 0xDF, 0x0B, 0x83, 0x05,
+0x49, 0x41, 0xAE, 0xE3, 0xC2, 0xA4, 0x14, 0xF7, 0x2B, 0x01, 0x63, 0x16, 0x6D, 0xD0, 0xB4, 0x71, 0x9F, 0x94, 0x7D, 0xB5, 0x95,
+0x06, 0xF3, 0x36, 0xA0, 0xE1, 0x14, 0x0C, 0x58, 0xE3, 0xDE, 0x83, 0xC6, 0x85, 0x07, 0x63, 0x7D, 0xEE, 0x00, 0x6C, 0x30, 0x3C,
+0x40, 0xDF, 0x79, 0x72, 0x14, 0x12, 0xE6, 0xF3, 0x09, 0x4D, 0x52, 0x02, 0x72, 0x7B, 0x02, 0x3E, 0x20, 0x57, 0x8A, 0x4E, 0x10,
+0x5C, 0xC2, 0x0A, 0xD5, 0x65, 0x57, 0xA8, 0xFA, 0x02, 0xBC, 0x99, 0x28, 0x59, 0x5C, 0xB6, 0x7B, 0xD4, 0x7D, 0x22, 0xBA, 0xBC,
+0x86, 0x1F, 0x54, 0x45, 0x68, 0xB4, 0x01, 0x5D, 0x18, 0x4B, 0x80, 0x10, 0x2F, 0x19, 0x36, 0xBD, 0xCE, 0xCD, 0x93, 0x32, 0x0D,
+0xD4, 0x80, 0x39, 0x43, 0xA3, 0x69, 0xFA, 0x7C, 0xD6, 0xBC, 0xDF, 0x8F, 0xF1, 0xBD, 0x8B, 0xFA, 0xBF, 0x20, 0x10, 0xE7, 0x7C,
+0xBD, 0xAC, 0x95, 0xF7, 0x85, 0xED, 0x20, 0x1A, 0x76, 0x71, 0xBE, 0x82, 0x56, 0xC7, 0x46, 0x58, 0x7F, 0xEE, 0xC3, 0xEE, 0x9F,
+0x20, 0xC3, 0x69, 0xF2, 0x29, 0x25, 0x4E, 0x46, 0x0A, 0xD3, 0x41, 0x3A, 0x7F, 0x13, 0xD4, 0xA8, 0x73, 0x9A, 0xDA, 0x51, 0x32,
+0x1D, 0x72, 0x61, 0x0D, 0xF8, 0xC1, 0x76, 0x40, 0x3F, 0xED, 0x2F, 0xC6, 0x39, 0xC6, 0xBA, 0xDA, 0x08, 0x4D, 0x08, 0x9B, 0x1C,
+0x38, 0x71, 0x1D, 0xD6, 0xD4, 0xCF, 0x66, 0xF9, 0x84, 0xB9, 0x8F, 0x53, 0xC7, 0xA3, 0xEE, 0x20, 0x3F, 0x06, 0xE7, 0x22, 0x5C,
+0x80, 0xD6, 0x93, 0x66, 0xF1, 0x80, 0xE9, 0xB6, 0xE1, 0x6D, 0x80, 0x38, 0x40, 0xF4, 0x06, 0x0E, 0x2C, 0xCF, 0x80, 0xA1, 0x57,
+0x1F, 0x76, 0x46, 0x13, 0x8A, 0xC3, 0x31, 0xD6, 0x3D, 0xCA, 0x03, 0x64, 0x53, 0xF0, 0x36, 0x73, 0x17, 0x75, 0x44, 0x6A, 0x97,
+0x7B, 0xFB, 0x4A, 0xDA, 0x6F, 0x1B, 0x36, 0x01, 0xD8, 0x67, 0x3F, 0xA7, 0x07, 0x5C, 0x0E, 0x44, 0x68, 0x3E, 0x75, 0xBF, 0xCB,
+0x5D, 0x4E, 0x44, 0x13, 0xA0, 0xFA, 0x3F, 0xA3, 0x19, 0x2A, 0x28, 0xB4, 0x2B, 0x88, 0x7D, 0x45, 0xA9, 0xA2, 0x38, 0x00, 0x76,
+0x3B, 0xA1, 0xBA, 0x50, 0x28, 0xB0, 0x5E, 0x5A, 0xE9, 0x5E, 0x9F, 0xCA, 0x60, 0xDB, 0x44, 0xCA, 0x3E, 0x65, 0xE7, 0xC8, 0xA2,
+0x4B, 0x36, 0x4E, 0xD7, 0x86, 0x91, 0x02, 0x0C, 0xC8, 0x91, 0xE1, 0x84, 0x5A, 0x05, 0x3F, 0xBA, 0x5B, 0x25, 0xED, 0x2F, 0x5D,
+0x7D, 0x1D, 0x5E, 0x5D, 0xDA, 0xCB, 0xFA, 0x66, 0x51, 0x5F, 0xE9, 0xFD, 0x93, 0xF2, 0x5E, 0x42, 0xBB, 0x0E, 0x81, 0xDF, 0xBD,
+0x7F, 0x96, 0xD3, 0x81, 0xCC, 0xAD, 0x0B, 0xC1, 0xF4, 0x00, 0x1B, 0xA9, 0x78, 0xAE, 0xD1, 0x41, 0xBA, 0xBE, 0x45, 0xB4, 0x00,
+0x69, 0x5F, 0xD8, 0xC2, 0xE1, 0x14, 0xAC, 0xBF, 0x39, 0x86, 0xB1, 0x56, 0x18, 0x49, 0x80, 0x18, 0x0F, 0x1F, 0x16, 0xF6, 0xEF,
+0xC3, 0x51, 0xB3, 0x10, 0xE7, 0x12, 0x5F, 0x19, 0xBF, 0x43, 0x46, 0xBE, 0x8E, 0x4E, 0x41, 0x09, 0xC1, 0xEE, 0x44, 0xBB, 0xA9,
+0xEC, 0x43, 0x4E, 0x7D, 0xD8, 0x0C, 0xD8, 0x10, 0xCD, 0xA7, 0x13, 0x50, 0x57, 0x20, 0x48, 0x93, 0x70, 0xE0, 0x87, 0x0D, 0xD2,
+0xE6, 0x87, 0xA8, 0xB4, 0xBE, 0x17, 0x33, 0xE9, 0x55, 0x91, 0x09, 0x88, 0x7A, 0x14, 0x67, 0x60, 0x26, 0x28, 0x7B, 0xD0, 0x45,
+0x67, 0x76, 0x72, 0xA9, 0x9C, 0x5A, 0xD7, 0x3C, 0x89, 0xB2, 0x13, 0xC2, 0xA4, 0x21, 0x9A, 0x55, 0x1C, 0xEC, 0x3A, 0x79, 0x09,
+0xCE, 0x62, 0x0E, 0xE6, 0x21, 0x2A, 0x87, 0x84, 0x32, 0xE6, 0x42, 0xF7, 0xB2, 0xC9, 0x32, 0xA9, 0x6E, 0x21, 0x40, 0xEE, 0x03,
+0x75, 0x80, 0x5A, 0xC9, 0xF5, 0xA3, 0x27, 0x01, 0x97, 0x08, 0xBA, 0x79, 0x92, 0x20, 0x62, 0xA7, 0xBC, 0x06, 0x35, 0x17, 0xAC,
+0x5B, 0xD5, 0xCB, 0x68, 0xC0, 0xF1, 0xB9, 0x93, 0x66, 0x6F, 0xE9, 0x11, 0x68, 0x9A, 0xD9, 0xF5, 0xE3, 0xA9, 0x02, 0x67, 0xB8,
+0x26, 0xD4, 0x81, 0xDD, 0x8E, 0xA1, 0x83, 0x84, 0x17, 0x13, 0xDC, 0x93, 0xDD, 0x18, 0xEE, 0x46, 0xFB, 0x2E, 0xB0, 0x43, 0x70,
+0x9D, 0xE8, 0x85, 0x02, 0xA6, 0x8F, 0x61, 0x42, 0xB2, 0x9F, 0xC7, 0xDC, 0xF6, 0x2F, 0x35, 0x10, 0x19, 0xC2, 0x86, 0x47, 0x26,
+0xE5, 0x9A, 0x00, 0x54, 0x79, 0xEA, 0x4C, 0x5B, 0xD7, 0xBB, 0x8A, 0xD8, 0x52, 0x38, 0x20, 0xF1, 0x03, 0x1F, 0xF8, 0x9F, 0xE0,
+0x0F, 0xDB, 0x57, 0x62, 0x22, 0x64, 0xE5, 0xF1, 0xE8, 0x17, 0x8F, 0x4E, 0xD7, 0xAE, 0x79, 0xB8, 0x17, 0x11, 0x5A, 0x95, 0x18,
+0x6F, 0x01, 0x7E, 0x01, 0x63, 0x62, 0x4E, 0x66, 0x50, 0xC2, 0xB4, 0x1C, 0x8A, 0xBE, 0x6C, 0xE6, 0xA7, 0x64, 0xC2, 0xA3, 0x70,
+0xAD, 0x0B, 0xC2, 0x3B, 0x22, 0xA4, 0xB6, 0x15, 0xA8, 0xA9, 0xDD, 0xA2, 0x47, 0xAB, 0xE4, 0xBE, 0x7F, 0xAF, 0xD5, 0x45, 0x2B,
+0x30, 0x6C, 0xD0, 0xC3, 0x8C, 0x64, 0x22, 0x3E, 0x70, 0xB9, 0xCC, 0x6E, 0x93, 0x6C, 0xE5, 0x58, 0x21, 0x3D, 0x6D, 0xA3, 0x08,
+0x31, 0x03, 0x9A, 0x41, 0xBB, 0xB4, 0x2F, 0xD5, 0x46, 0x9F, 0xCC, 0x16, 0xF1, 0x8C, 0x86, 0xA0, 0x3F, 0x40, 0x99, 0x59, 0xDD,
+0xE2, 0xEE, 0xCA, 0x4B, 0x75, 0xF0, 0x11, 0x16, 0x6A, 0x9B, 0x2F, 0x92, 0x09, 0x54, 0x1D, 0xBC, 0x7B, 0x65, 0x11, 0x34, 0x29,
+0xC9, 0x77, 0x20, 0x31, 0x31, 0x71, 0x4C, 0x86, 0xA2, 0x8B, 0x93, 0x90, 0x8C, 0x63, 0x5D, 0xBA, 0x70, 0x07, 0x1F, 0xAF, 0xB6,
+0x6C, 0x80, 0xC7, 0x15, 0xD5, 0x2D, 0x12, 0xF2, 0xCD, 0xDE, 0xFE, 0xCB, 0x3F, 0x14, 0x74, 0xC1, 0x06, 0xC5, 0x6D, 0xD5, 0xB0,
+0x84, 0xEF, 0x5E, 0x5D, 0xCB, 0xCA, 0xD1, 0x33, 0x07, 0x1C, 0x98, 0xCA, 0xB0, 0x3F, 0x6F, 0x74, 0x73, 0x1A, 0x0C, 0x10, 0xE2,
+0x00, 0x21, 0x5E, 0x66, 0x72, 0x23, 0x72, 0xD7, 0xC9, 0x08, 0x42, 0x8A, 0xFA, 0xC9, 0xFC, 0xD4, 0x49, 0x40, 0xB4, 0x91, 0x67,
+0xAC, 0x80, 0x65, 0x0E, 0x50, 0x32, 0xB9, 0xE4, 0x48, 0xD4, 0x91, 0x9C, 0x47, 0x6F, 0x51, 0x74, 0xB1, 0xF8, 0x65, 0x1E, 0x5F,
+0x3D, 0xD8, 0x25, 0xB8, 0xA2, 0x21, 0x6B, 0x50, 0x35, 0x41, 0x53, 0x58, 0x45, 0x69, 0x7B, 0xF2, 0xE7, 0x4A, 0xD8, 0x2E, 0x4E,
+0x7C, 0xB0, 0x14, 0x17, 0x92, 0x79, 0xD2, 0x7C, 0x32, 0xF7, 0x41, 0xF6, 0xEC, 0xE3, 0xEA, 0x97, 0xF1, 0xDE, 0xBA, 0x21, 0xDA,
+0x8D, 0x99, 0x9A, 0xA9, 0x20, 0x4D, 0x96, 0x7F, 0xC5, 0x45, 0xE0, 0xD1, 0xCF, 0xC5, 0x40, 0x64, 0x93, 0x56, 0x09, 0xAC, 0x8C,
+0x4B, 0x07, 0x13, 0x9A, 0x9D, 0x52, 0x1A, 0xAE, 0x11, 0x36, 0xC9, 0x81, 0x9F, 0xD1, 0x79, 0xAA, 0x4F, 0xB5, 0xC1, 0x99, 0xD0,
+0x92, 0x29, 0x01, 0x3D, 0xCA, 0xD6, 0x8C, 0xCB, 0x82, 0x2B, 0x47, 0xA7, 0xA8, 0x43, 0x2A, 0xA6, 0x33, 0xB7, 0xE8, 0x9B, 0x99,
+0x84, 0xFB, 0x5B, 0x9B, 0x59, 0xD6, 0xAE, 0xDA, 0xAA, 0xDC, 0x7C, 0x7A, 0x7A, 0x6A, 0x87, 0x4C, 0x49, 0x39, 0x41, 0xE2, 0xF8,
+0x01, 0xF0, 0xB5, 0x9D, 0x1F, 0xD7, 0xF9, 0xF4, 0x89, 0x3F, 0x9F, 0xF2, 0x2C, 0xE6, 0x30, 0x4C, 0x68, 0x10, 0x4D, 0x23, 0xFB,
+0x94, 0x4E, 0x80, 0xB4, 0x4E, 0x00, 0xAD, 0x5E, 0xC3, 0xBB, 0x82, 0xE7, 0x59, 0x99, 0x21, 0xE2, 0x54, 0x46, 0x0E, 0x6F, 0x8A,
+0x73, 0x64, 0x57, 0xC2, 0x55, 0x73, 0x9D, 0x3B, 0x51, 0x9C, 0x64, 0x3F, 0x89, 0xA1, 0xFC, 0x9D, 0x25, 0x55, 0xEA, 0xA3, 0xD7,
+0x22, 0x9D, 0xAA, 0xE6, 0xC5, 0xE3, 0x2B, 0xCD, 0xD9, 0xC1, 0x58, 0xFF, 0xC5, 0x8D, 0xE2, 0xC5, 0x1A, 0xB9, 0x37, 0xBA, 0xF7,
+0x88, 0xFC, 0x8E, 0xF2, 0x82, 0xEC, 0x47, 0x47, 0x19, 0xEE, 0x39, 0x90, 0x2F, 0xA8, 0x1F, 0x4E, 0xA3, 0xE4, 0x98, 0xC0, 0x6F,
+0x00, 0x06, 0x61, 0x98, 0x82, 0x83, 0x91, 0x87, 0x20, 0x0E, 0xEB, 0x72, 0x07, 0x8D, 0x1F, 0x4C, 0xCB, 0xA1, 0x3F, 0x82, 0xDE,
+0x38, 0x12, 0x41, 0xF4, 0x49, 0x87, 0x93, 0xC5, 0x20, 0x74, 0x07, 0xA9, 0x83, 0x69, 0xE2, 0x06, 0xD2, 0x6C, 0x8B, 0xBE, 0x64,
+0x9B, 0x77, 0x26, 0x40, 0xF7, 0xC4, 0x87, 0xED, 0x03, 0xEB, 0x3E, 0xD8, 0x8D, 0x42, 0x2C, 0xA6, 0x89, 0x8B, 0x89, 0xDE, 0xFD,
+0x19, 0xA0, 0xB6, 0x19, 0xF8, 0xC7, 0x94, 0x00, 0x2C, 0x1E, 0x7C, 0xD8, 0x0C, 0x17, 0xCC, 0x0D, 0xE2, 0x4D, 0x08, 0x18, 0xB7,
+0x24, 0x3A, 0xE2, 0xDA, 0x0D, 0xB1, 0xC7, 0x2C, 0x31, 0x9A, 0x91, 0x28, 0xA3, 0x41, 0xFA, 0x51, 0x6E, 0x04, 0xF9, 0x21, 0x39,
+0xF6, 0x33, 0x14, 0xDA, 0x40, 0x1F, 0x3A, 0xC7, 0x60, 0x23, 0x0A, 0xB9, 0x79, 0x1F, 0x27, 0x1B, 0x27, 0xD1, 0xCC, 0x9F, 0xC0,
+0xCE, 0xF1, 0x9A, 0xA2, 0x0A, 0x6A, 0x96, 0x72, 0x88, 0x7D, 0xB4, 0x70, 0xA4, 0xCC, 0x71, 0xC3, 0xAE, 0x4C, 0x33, 0xE2, 0xC4,
+0x31, 0xFA, 0xDB, 0x94, 0x8C, 0xC9, 0xF9, 0xCD, 0x1B, 0x22, 0x9E, 0xCD, 0x73, 0x22, 0xD4, 0x83, 0x8D, 0xEC, 0x04, 0x29, 0xED,
+0x17, 0x15, 0x18, 0xA4, 0x5C, 0x25, 0x86, 0x51, 0x96, 0x6C, 0xBF, 0xDD, 0xD7, 0x0B, 0x5E, 0xC3, 0xFF, 0x19, 0xD8, 0xC4, 0xB0,
+0xD1, 0x94, 0xC2, 0x28, 0x9C, 0x2A, 0xA5, 0xBA, 0x47, 0x29, 0xFA, 0xEB, 0x85, 0x7B, 0xAF, 0x56, 0x09, 0x26, 0xED, 0xA0, 0x02,
+0xF8, 0x56, 0x19, 0x17, 0xDE, 0x5E, 0x7A, 0xE5, 0x33, 0x0C, 0xC7, 0x61, 0xE2, 0x33, 0xE6, 0x24, 0x47, 0xB2, 0x0D, 0x42, 0x90,
+0xE8, 0x17, 0xD1, 0xCA, 0xB2, 0x63, 0x7D, 0x18, 0x54, 0x3A, 0x98, 0xDE, 0x41, 0x18, 0x64, 0x38, 0x1C, 0x8D, 0x31, 0x5D, 0xD2,
+0x27, 0x2B, 0x63, 0x96, 0xBC, 0xB8, 0xC2, 0xF4, 0xF4, 0x48, 0x47, 0x9D, 0x98, 0x7A, 0xBD, 0x40, 0x49, 0x14, 0x6E, 0x27, 0xA9,
+0x28, 0xC8, 0xBE, 0x2B, 0xC8, 0x49, 0xBB, 0x48, 0x29, 0x0A, 0x29, 0xF5, 0x44, 0xB6, 0xAC, 0x04, 0x2D, 0x15, 0xD2, 0x7B, 0x30,
+0x91, 0x4A, 0xD8, 0x5F, 0x53, 0x44, 0x83, 0x8B, 0xFD, 0x55, 0x72, 0x7E, 0x01, 0x45, 0x4E, 0x19, 0x66, 0x5C, 0x25, 0x9F, 0x0E,
+0x6F, 0xDE, 0xB8, 0x58, 0x93, 0x2C, 0x01, 0xF8, 0xA2, 0x97, 0x95, 0x72, 0x96, 0xC0, 0x25, 0x59, 0x25, 0x5E, 0xE4, 0xE6, 0x58,
+0x68, 0xC3, 0xBE, 0x78, 0xC6, 0xEB, 0xB7, 0x16, 0x2F, 0x3D, 0x53, 0x4F, 0x91, 0x5B, 0x48, 0x92, 0x22, 0x81, 0xD2, 0xD1, 0x4B,
+0xC9, 0xB2, 0x58, 0x0D, 0x04, 0x69, 0xED, 0x57, 0x89, 0x21, 0x59, 0x0D, 0xBC, 0xD4, 0xDA, 0xB7, 0x12, 0xC6, 0xC0, 0xBE, 0xA5,
+0x23, 0xDD, 0xD1, 0x4F, 0xF1, 0xD0, 0xD9, 0xFC, 0x40, 0x87, 0xF2, 0x74, 0x6F, 0xD7, 0xFC, 0x50, 0x29, 0xB3, 0x99, 0x61, 0xC8,
+0xE7, 0xD2, 0xE6, 0x6A, 0xFC, 0x08, 0x7B, 0x71, 0xCD, 0xD5, 0x45, 0x75, 0xAE, 0xDA, 0xB0, 0x6D, 0x99, 0xAF, 0xB8, 0x74, 0x18,
+0x25, 0xB5, 0x61, 0xF1, 0x4D, 0x80, 0xCF, 0x5D, 0x53, 0x17, 0xC9, 0x1C, 0xAB, 0xD8, 0x5F, 0xD3, 0x4B, 0x16, 0xB6, 0x9A, 0xD0,
+0xB0, 0xF4, 0xCD, 0xD7, 0xD5, 0x4F, 0x99, 0xBF, 0x1A, 0x89, 0x5E, 0x8E, 0x78, 0x32, 0x6C, 0xAD, 0xCC, 0x4B, 0x09, 0xA2, 0x5F,
+0x8E, 0xB0, 0x1A, 0x71, 0x47, 0x18, 0xC2, 0x3B, 0xEC, 0xE8, 0x28, 0xFD, 0x47, 0xD1, 0xFA, 0xE0, 0x63, 0x77, 0x5B, 0xB0, 0xE4,
+0xD9, 0xCC, 0x84, 0x59, 0xDF, 0x35, 0x1F, 0x69, 0xF9, 0x0B, 0xC8, 0xE8, 0xBA, 0x75, 0xC3, 0x66, 0xCE, 0x5D, 0x09, 0xFD, 0x92,
+0x0E, 0x8A, 0x43, 0x68, 0xA9, 0xDB, 0xBE, 0x58, 0x82, 0x67, 0x49, 0x02, 0x5A, 0x67, 0x4C, 0x8C, 0x37, 0x01, 0x8B, 0x17, 0x30,
+0x4D, 0x4C, 0x1C, 0x0C, 0x67, 0xF9, 0x1E, 0xE8, 0x59, 0x68, 0x0B, 0xEA, 0x6B, 0xA2, 0x64, 0x88, 0x48, 0x16, 0x81, 0x29, 0x8C,
+0x7D, 0xC1, 0x1B, 0xEB, 0x5F, 0x16, 0xB3, 0xB5, 0x8D, 0x62, 0x4C, 0x7D, 0x4F, 0x2E, 0x37, 0x70, 0x11, 0xAC, 0xFC, 0xE1, 0x51,
+0xB3, 0xEF, 0xDD, 0x23, 0x71, 0x47, 0x86, 0x87, 0x1F, 0x98, 0x3F, 0x53, 0xF1, 0xA2, 0xF2, 0x90, 0xF9, 0x09, 0xCC, 0xF5, 0xF9,
+0x6C, 0x08, 0x37, 0x51, 0xB6, 0xFB, 0x6C, 0x90, 0x88, 0x85, 0xCC, 0x10, 0x3D, 0x54, 0xF5, 0xEF, 0x5E, 0xB1, 0x3A, 0x65, 0x7C,
+0x29, 0xCC, 0xBB, 0xB1, 0x50, 0x5D, 0xEF, 0xC6, 0x11, 0x65, 0x83, 0xDA, 0x88, 0x8A, 0x63, 0x0E, 0xAD, 0xF1, 0x14, 0x55, 0x79,
+0xCE, 0x87, 0x9D, 0x62, 0xF8, 0x6C, 0x28, 0xD8, 0xEC, 0x6C, 0xFE, 0xF1, 0xD7, 0xD6, 0xBB, 0xFD, 0xBF, 0x30, 0xF1, 0xB2, 0x0F,
+0xD8, 0xAC, 0x8C, 0xA0, 0xCA, 0x49, 0x17, 0x21, 0xB8, 0x37, 0x30, 0x2E, 0x03, 0x7C, 0x44, 0x33, 0x77, 0xA6, 0xEC, 0x13, 0xD3,
+0x42, 0xD5, 0x90, 0x25, 0x0B, 0xFC, 0xE1, 0x60, 0x00, 0x76, 0x0C, 0x0F, 0x68, 0x48, 0x38, 0xA7, 0x0E, 0x58, 0x2E, 0xAC, 0x8F,
+0xD9, 0x1B, 0xB2, 0x8C, 0xC9, 0x8C, 0xF7, 0xB3, 0x51, 0x13, 0xF5, 0x2C, 0x18, 0xC0, 0x3F, 0x22, 0xE6, 0x2D, 0xD9, 0xC7, 0x8E,
+0x8E, 0x19, 0xC0, 0x84, 0x02, 0x8E, 0x21, 0xD4, 0x5E, 0x00, 0x06, 0xC2, 0x30, 0xB1, 0x15, 0x4D, 0x05, 0xB0, 0x05, 0xF0, 0xA2,
+0x27, 0x02, 0x34, 0x11, 0x60, 0x42, 0xD1, 0xEE, 0xD3, 0x70, 0x44, 0x40, 0xC4, 0x85, 0xFE, 0xB3, 0x2A, 0xF0, 0x8B, 0xDA, 0x0C,
+0x51, 0x62, 0xF3, 0x84, 0xDF, 0x16, 0x97, 0x08, 0x26, 0x8E, 0xDB, 0x67, 0x4E, 0x56, 0x9F, 0x00, 0xCB, 0xC1, 0x7F, 0x51, 0x68,
+0x95, 0xF3, 0x15, 0x21, 0x3F, 0x94, 0x18, 0x38, 0xE5, 0x06, 0x6C, 0x0B, 0x0A, 0x83, 0x6B, 0x40, 0x1D, 0x6F, 0xF1, 0xEC, 0x0C,
+0xCA, 0x51, 0xAB, 0x2A, 0x5D, 0xED, 0x34, 0x9A, 0x53, 0x13, 0x5D, 0x20, 0x32, 0x5E, 0x27, 0xF8, 0xCB, 0x20, 0x90, 0xF1, 0x18,
+0x60, 0xC2, 0x83, 0x24, 0x95, 0x06, 0xC2, 0x22, 0xC5, 0x5C, 0x02, 0x3E, 0xFC, 0x27, 0xDB, 0xB6, 0x15, 0xA8, 0x87, 0xA2, 0xC6,
+0xCE, 0xC3, 0x74, 0xE6, 0x1F, 0x65, 0xE6, 0x39, 0x69, 0x9A, 0x0D, 0xB9, 0xB0, 0x4A, 0x10, 0xAC, 0x7D, 0x8A, 0x16, 0xB1, 0x09,
+0xE6, 0x8F, 0xC6, 0x14, 0xD8, 0xAA, 0x65, 0x39, 0xB0, 0xD7, 0x5A, 0x85, 0x13, 0xC0, 0x8A, 0x9F, 0x40, 0x15, 0x86, 0x73, 0xB6,
+0xE0, 0xD1, 0xBC, 0x79, 0xE3, 0xD3, 0x7F, 0xF6, 0xF7, 0x76, 0x6D, 0xBE, 0x81, 0x40, 0x03, 0x99, 0xD8, 0x0B, 0x23, 0x39, 0x01,
+0x98, 0x57, 0xF7, 0xAC, 0x43, 0x90, 0x5C, 0xE7, 0xCC, 0x53, 0x5D, 0x25, 0x3D, 0x3C, 0x59, 0xE8, 0xF3, 0xC8, 0xE9, 0x90, 0x31,
+0x0B, 0x81, 0xB5, 0xB2, 0x0A, 0x52, 0xE2, 0xA6, 0x7C, 0xEA, 0x64, 0x8E, 0x80, 0xFF, 0x5C, 0xBC, 0xB2, 0xB5, 0x96, 0x75, 0x36,
+0xC0, 0x00, 0x66, 0x30, 0x7B, 0x20, 0x1C, 0x68, 0xAF, 0xCF, 0xF0, 0xE9, 0x03, 0xE4, 0x46, 0x3E, 0xBC, 0x84, 0x79, 0xF3, 0x38,
+0x88, 0x1C, 0x0F, 0x80, 0xC0, 0xEC, 0xE6, 0x34, 0x9B, 0x45, 0x60, 0xC6, 0xF5, 0x40, 0x3E, 0x1C, 0xF4, 0x98, 0xC5, 0xE8, 0xA1,
+0xAF, 0x2B, 0x86, 0x05, 0xAE, 0x6A, 0x65, 0x6C, 0x27, 0xA0, 0x49, 0x66, 0x1A, 0xCF, 0xC1, 0xA0, 0x04, 0x33, 0x1E, 0xB6, 0x29,
+0xB2, 0x1B, 0x4F, 0x75, 0x0A, 0x8C, 0xB0, 0x90, 0x59, 0xA0, 0xB6, 0xC1, 0xB9, 0x59, 0x61, 0x56, 0xC1, 0xC3, 0x26, 0x4D, 0x92,
+0x66, 0x68, 0x1C, 0x4B, 0x0D, 0x1E, 0x58, 0x7E, 0xE4, 0x2E, 0x81, 0x1E, 0xB6, 0x08, 0x9E, 0x5A, 0x1C, 0x58, 0xCB, 0x36, 0x01,
+0xEA, 0x15, 0x7B, 0xDD, 0x0F, 0x3D, 0x0C, 0x14, 0x78, 0xEA, 0x46, 0x50, 0x18, 0x3F, 0xE8, 0xE4, 0x78, 0x8E, 0x38, 0xE7, 0x26,
+0x84, 0xD4, 0xC5, 0xDB, 0xE4, 0xEF, 0xBF, 0x19, 0x13, 0x54, 0x10, 0x68, 0x40, 0x71, 0xD9, 0xD1, 0x19, 0xF1, 0xD9, 0xD8, 0x3C,
+0x4C, 0xC6, 0x3A, 0x62, 0xA2, 0xAB, 0xAA, 0xE8, 0x8D, 0x3E, 0xB3, 0x98, 0xAB, 0xA4, 0xE6, 0x63, 0xE0, 0x51, 0x2D, 0x31, 0xCE,
+0x95, 0xEC, 0x06, 0x80, 0x21, 0xBB, 0xDA, 0x7E, 0x18, 0xD2, 0xE4, 0xC5, 0xC1, 0xCE, 0x6B, 0x94, 0xEF, 0xA5, 0xB0, 0x15, 0x82,
+0x5A, 0x01, 0xCC, 0xFC, 0x52, 0x2A, 0x60, 0x33, 0x75, 0xCE, 0x2C, 0xDB, 0x35, 0xA6, 0xFB, 0xE1, 0xD1, 0x66, 0x59, 0x24, 0x09,
+0x45, 0x94, 0xF1, 0x84, 0x0D, 0x94, 0x71, 0xE7, 0x02, 0x74, 0x46, 0xC2, 0x64, 0x57, 0x99, 0x3D, 0x07, 0x81, 0x60, 0xA8, 0xF8,
+0xF0, 0x3D, 0xB1, 0x3D, 0xF3, 0x03, 0xCF, 0xE4, 0x40, 0xE4, 0xDE, 0xB7, 0x81, 0x81, 0x9F, 0x39, 0xC0, 0xED, 0x72, 0xA5, 0xCE,
+0xAF, 0x01, 0xD9, 0x62, 0xB5, 0xEB, 0x38, 0xB3, 0x2A, 0xA6, 0xD8, 0xEE, 0x02, 0x8F, 0x9A, 0xC8, 0xA6, 0x25, 0x6F, 0x40, 0x91,
+0xB5, 0x04, 0xDE, 0x6C, 0xA7, 0x35, 0xAF, 0x2B, 0x7A, 0x47, 0x55, 0x96, 0xE6, 0x67, 0x0D, 0x95, 0x66, 0x9C, 0x6C, 0x2A, 0x5F,
+0x71, 0xCE, 0x2C, 0x7C, 0x1F, 0xBB, 0xBE, 0xBE, 0x7C, 0x6E, 0xC5, 0x4A, 0xE2, 0x0E, 0xF6, 0xA0, 0x47, 0xF3, 0x76, 0x91, 0xBC,
+0xC8, 0x5A, 0x29, 0xF2, 0xBA, 0x0A, 0xBF, 0x20, 0x18, 0x6B, 0x28, 0x29, 0x56, 0x70, 0x37, 0x73, 0x64, 0xBB, 0x6A, 0xD1, 0xC8,
+0x2E, 0xEA, 0x91, 0xA8, 0x95, 0x7A, 0x70, 0x57, 0x8B, 0x6A, 0x10, 0xFB, 0xD5, 0x5A, 0xB6, 0xBA, 0xA2, 0x36, 0x0A, 0x6B, 0x23,
+0xEF, 0xBD, 0x82, 0x6A, 0x24, 0x68, 0x05, 0x73, 0x69, 0xDE, 0xEB, 0x5C, 0xFE, 0x5A, 0x64, 0xBC, 0x56, 0xC9, 0x93, 0xC9, 0x3A,
+0x2E, 0x6B, 0x89, 0x15, 0xAE, 0xEB, 0x93, 0x21, 0x94, 0xAA, 0x80, 0x4A, 0x4F, 0xCA, 0x4E, 0xE8, 0x3C, 0x3A, 0xA1, 0x32, 0xAA,
+0x42, 0x4D, 0x43, 0x9E, 0xAF, 0x62, 0xBC, 0xC5, 0x4F, 0x4D, 0x6E, 0x29, 0x07, 0xA1, 0xA4, 0xD0, 0xAA, 0x28, 0x71, 0xE5, 0xA0,
+0xEB, 0x0F, 0x18, 0x2A, 0x1E, 0x0D, 0x36, 0x8E, 0xC6, 0x2D, 0xF6, 0x4A, 0x61, 0x48, 0xB4, 0x9B, 0x26, 0x9F, 0x0E, 0xD7, 0x96,
+0x91, 0xAF, 0xCC, 0xBA, 0x83, 0xDE, 0xDB, 0xFB, 0xEF, 0xF9, 0x7C, 0x4C, 0x16, 0x81, 0xEE, 0x53, 0xB4, 0x06, 0x77, 0x84, 0xB0,
+0x2E, 0xD1, 0x05, 0x92, 0xCC, 0xE7, 0x8C, 0xD3, 0x58, 0x33, 0x1B, 0xDF, 0xCD, 0x82, 0xBF, 0x44, 0xAD, 0x2A, 0xEE, 0x84, 0x04,
+0x86, 0xA7, 0xE8, 0xB8, 0x08, 0x16, 0x30, 0x36, 0xC3, 0x68, 0x00, 0xB7, 0xF8, 0x2F, 0x78, 0x77, 0xD9, 0x9B, 0xC7, 0x9F, 0x68,
+0x6A, 0xF6, 0x8C, 0x9E, 0xA5, 0xA8, 0x98, 0xDE, 0xD3, 0x28, 0xC7, 0x80, 0xF7, 0xB7, 0x3C, 0xC2, 0xE0, 0xB6, 0x69, 0x58, 0x04,
+0x83, 0xDD, 0x61, 0x84, 0x36, 0x4D, 0x10, 0x9D, 0x02, 0x5A, 0x7E, 0xC8, 0xCC, 0x4D, 0x69, 0x94, 0x0F, 0x15, 0xB7, 0x40, 0x18,
+0xE7, 0xA9, 0xDD, 0x2B, 0xC5, 0xAC, 0x44, 0x8B, 0x49, 0xDF, 0x02, 0x17, 0x61, 0x51, 0xA5, 0x27, 0x6F, 0xE9, 0x94, 0x9E, 0xC1,
+0x54, 0x87, 0xFF, 0xFB, 0xE9, 0x7F, 0xFB, 0x9F, 0xD3, 0xC3, 0xBB, 0xE6, 0xE7, 0xF4, 0x57, 0x78, 0xF8, 0x55, 0xBC, 0x5A, 0xBF,
+0xDE, 0x19, 0xCA, 0xA9, 0xCB, 0xE6, 0x36, 0xA0, 0x96, 0xC9, 0xA9, 0xA8, 0xD8, 0x6B, 0x04, 0xBD, 0x04, 0x83, 0x2E, 0xA2, 0x09,
+0xD0, 0x45, 0xDB, 0xDA, 0x4A, 0xBE, 0xD1, 0xBC, 0x18, 0x55, 0xAA, 0xF0, 0xDC, 0x82, 0x22, 0x56, 0x74, 0x87, 0xA7, 0x22, 0x52,
+0x80, 0x33, 0xD1, 0x64, 0x1F, 0xB7, 0xB2, 0x48, 0x83, 0xBB, 0xA4, 0x9A, 0x1C, 0xD0, 0x99, 0x19, 0x1C, 0x05, 0x7F, 0x56, 0x43,
+0x6A, 0x28, 0xAE, 0x70, 0xDA, 0x6C, 0x17, 0xC2, 0x0E, 0x38, 0x57, 0x78, 0xB9, 0xA1, 0xAD, 0xD8, 0xF9, 0x2D, 0x4D, 0xA0, 0x81,
+0x18, 0x53, 0xCE, 0xE2, 0xA2, 0x99, 0x3C, 0xC5, 0xC6, 0xED, 0xA4, 0x4C, 0xE1, 0x7E, 0x5E, 0x95, 0x28, 0xBA, 0xDF, 0xDA, 0x49,
+0x0F, 0x25, 0xEC, 0xD7, 0x45, 0x0A, 0xBD, 0x59, 0x95, 0x0A, 0x45, 0xED, 0xD2, 0x04, 0x38, 0xF8, 0xA8, 0xCE, 0x3C, 0x29, 0x78,
+0xDC, 0xFC, 0xB4, 0x39, 0xF8, 0xE8, 0x0C, 0xBE, 0x1F, 0x9E, 0xDF, 0xEF, 0x5F, 0x58, 0xE6, 0xA7, 0xBB, 0x83, 0xC3, 0x0D, 0x73,
+0x63, 0xF5, 0xD3, 0x68, 0xF0, 0xDB, 0xE1, 0xDF, 0x2B, 0xF0, 0xF3, 0xE0, 0xD0, 0x82, 0x77, 0x2C, 0x78, 0x78, 0xC8, 0x4A, 0xAD,
+0x8D, 0xEA, 0x3B, 0x94, 0x68, 0x50, 0xB0, 0x41, 0x7F, 0xC7, 0x1C, 0x6D, 0x7C, 0x5A, 0x91, 0x50, 0xEE, 0x1D, 0x5A, 0x9F, 0x6D,
+0x84, 0xBB, 0x02, 0x00, 0xFF, 0x7E, 0x08, 0x2F, 0x50, 0xF8, 0xE8, 0x10, 0x4A, 0x3E, 0x0F, 0xB5, 0xE1, 0xE0, 0xE7, 0x1E, 0x1F,
+0xD5, 0xDA, 0xB8, 0x0E, 0x18, 0xD6, 0x06, 0xDB, 0xAD, 0x7C, 0xDA, 0x52, 0xD1, 0x15, 0x0B, 0x2E, 0xE3, 0x1C, 0x9C, 0x7A, 0xA5,
+0x5C, 0x2B, 0x08, 0x8D, 0x01, 0xD0, 0x92, 0xFE, 0x6C, 0x51, 0x79, 0x53, 0x29, 0xEC, 0x0A, 0xAD, 0x8A, 0x75, 0x49, 0x29, 0x0B,
+0x58, 0x2B, 0x4B, 0xA9, 0xAF, 0x82, 0x94, 0x2B, 0xCF, 0xE5, 0x84, 0x08, 0x07, 0xB4, 0xC9, 0xE9, 0x17, 0xC2, 0xCD, 0x6E, 0x59,
+0xC3, 0x8D, 0x5B, 0x03, 0x4B, 0xAC, 0x00, 0xCE, 0x1E, 0x89, 0x51, 0xBC, 0x0D, 0x0E, 0xCF, 0x47, 0xFD, 0x47, 0x2B, 0x17, 0x4A,
+0xFD, 0x32, 0x34, 0xC1, 0x11, 0x5B, 0xA9, 0x52, 0x46, 0x82, 0xAF, 0x99, 0x36, 0x1A, 0x60, 0x9D, 0x42, 0x5A, 0xC0, 0xC2, 0x52,
+0x65, 0x76, 0x9A, 0x4F, 0xB8, 0x5B, 0xB7, 0x83, 0xDA, 0x91, 0xED, 0x09, 0xA0, 0x13, 0x37, 0x22, 0x85, 0x4C, 0x35, 0xBF, 0xF5,
+0x89, 0x3B, 0x91, 0x85, 0x88, 0xCE, 0x37, 0x81, 0x25, 0x59, 0x07, 0xEF, 0x0F, 0x0B, 0xEF, 0xD8, 0x78, 0x7D, 0xCF, 0x84, 0xA7,
+0x3C, 0x09, 0xC0, 0xC1, 0x1A, 0x8A, 0xB8, 0x7A, 0xEC, 0xBB, 0xC7, 0x34, 0xD9, 0xF8, 0x36, 0xEE, 0xA1, 0x2F, 0x13, 0xA2, 0x5D,
+0xFB, 0xEE, 0xED, 0xCB, 0xED, 0x68, 0x0E, 0x0A, 0x1C, 0x0D, 0xD0, 0x6F, 0x18, 0xF4, 0x2A, 0xDC, 0xB2, 0xDF, 0x9F, 0x31, 0xAF,
+0x2C, 0xCD, 0x5D, 0x97, 0x45, 0x74, 0xE5, 0x4A, 0x9A, 0x68, 0x4C, 0x2A, 0x8B, 0x27, 0x80, 0xA3, 0x27, 0x8E, 0x35, 0x76, 0xEC,
+0x2C, 0xD0, 0x7D, 0xB2, 0x65, 0xB9, 0xCD, 0xF5, 0x96, 0x99, 0x22, 0xCA, 0xA9, 0x7D, 0x3C, 0xE1, 0x09, 0x92, 0x5B, 0xE0, 0xB6,
+0x8C, 0x98, 0xCB, 0x38, 0x31, 0x65, 0x53, 0x46, 0x0B, 0x18, 0x93, 0xA9, 0x1A, 0x65, 0xC4, 0xB3, 0x59, 0xD2, 0x27, 0xFC, 0x5A,
+0x5D, 0x9F, 0xB0, 0xCA, 0x62, 0xFC, 0x28, 0xA0, 0x36, 0x2B, 0x31, 0xBF, 0xC8, 0x83, 0x8E, 0xCC, 0x00, 0x01, 0x92, 0xA3, 0x3B,
+0xB7, 0x4A, 0xEE, 0x9C, 0xF3, 0x8E, 0x17, 0x64, 0x00, 0xCF, 0xAC, 0xE9, 0xC5, 0x17, 0x31, 0xEE, 0xA7, 0x43, 0x41, 0xFD, 0x0B,
+0x6E, 0x93, 0x48, 0xD1, 0xA5, 0x55, 0xAD, 0xF1, 0x7F, 0x77, 0xCC, 0xD2, 0xD2, 0x2A, 0xC2, 0xED, 0x96, 0x5D, 0x1C, 0x89, 0x44,
+0x72, 0x87, 0x2C, 0x9A, 0xDB, 0x93, 0xD3, 0x61, 0xE4, 0x8B, 0xF2, 0xC4, 0x85, 0xC2, 0xEA, 0xCA, 0x9A, 0x48, 0x6B, 0x9E, 0xE6,
+0x56, 0x67, 0x8A, 0xA6, 0x3B, 0x9B, 0x9B, 0xB8, 0x1A, 0xA4, 0xE7, 0x3C, 0x78, 0x75, 0xA9, 0x7B, 0xF1, 0x55, 0x90, 0x6C, 0xE6,
+0x4F, 0x67, 0x01, 0x46, 0xD6, 0x9B, 0xC1, 0x89, 0x0E, 0x3D, 0x2D, 0x71, 0x2A, 0x32, 0x92, 0xFA, 0x59, 0x48, 0x7E, 0xE1, 0xEC,
+0x51, 0x7C, 0x66, 0xAC, 0xF7, 0x84, 0x2F, 0xA1, 0xD0, 0x48, 0xA1, 0x82, 0x9E, 0x3C, 0xF8, 0xA7, 0x29, 0xB1, 0xDD, 0x98, 0x04,
+0xFA, 0xFF, 0x27, 0xC8, 0x70, 0x48, 0xDE, 0x88, 0xA3, 0x82, 0x32, 0x46, 0xC8, 0x8F, 0x07, 0xB0, 0x4B, 0x18, 0x48, 0x23, 0x61,
+0x46, 0xB3, 0xC3, 0x02, 0xEC, 0xA0, 0x4B, 0x14, 0xBA, 0x54, 0xB1, 0xDB, 0xD1, 0x04, 0xB0, 0x1D, 0xCF, 0x7B, 0x76, 0x22, 0xC2,
+0x4D, 0x14, 0x9C, 0x00, 0x53, 0x1E, 0x32, 0xE8, 0x97, 0xE6, 0xB8, 0xC9, 0xED, 0x58, 0x30, 0x1C, 0xF8, 0x80, 0x4F, 0xF9, 0x78,
+0xA5, 0xF5, 0xDA, 0xA4, 0x71, 0x41, 0x5D, 0x33, 0x99, 0x53, 0x57, 0xEB, 0x8C, 0xD9, 0xF5, 0x7E, 0x55, 0xA3, 0x45, 0x76, 0x6E,
+0x31, 0x94, 0x1A, 0x20, 0xA0, 0x46, 0x90, 0xBD, 0x14, 0x45, 0xD0, 0xD0, 0xB2, 0x94, 0x8F, 0xB2, 0x7D, 0x4D, 0x2C, 0xB2, 0x5E,
+0x25, 0xF5, 0xCC, 0xC2, 0x55, 0x6D, 0xD8, 0x89, 0x0D, 0x14, 0x3C, 0x02, 0x37, 0x3B, 0x05, 0x02, 0x72, 0x09, 0xDA, 0xD4, 0x27,
+0x15, 0x7E, 0xEB, 0xF2, 0x30, 0x27, 0x41, 0x9E, 0x14, 0x20, 0x53, 0x9A, 0x1D, 0xF8, 0x73, 0x1A, 0xE5, 0x80, 0xBB, 0xBA, 0x5D,
+0x5F, 0xC3, 0x44, 0x9E, 0xE3, 0xE0, 0xEC, 0x9E, 0xAC, 0x0E, 0x5D, 0xDF, 0x35, 0xCB, 0x63, 0x5D, 0xE9, 0xD7, 0x88, 0xF9, 0xA5,
+0xB0, 0xBB, 0xB1, 0xD7, 0xB7, 0x58, 0xD7, 0x24, 0x2A, 0x66, 0x77, 0xEB, 0x40, 0xCD, 0x16, 0xBD, 0x06, 0xAA, 0x4C, 0x07, 0x36,
+0x80, 0x71, 0x67, 0xEC, 0x2C, 0x70, 0x5F, 0x30, 0x41, 0x79, 0xA0, 0x78, 0x9B, 0x55, 0xE8, 0x93, 0x2F, 0x53, 0x83, 0x4D, 0x90,
+0xF0, 0x96, 0x64, 0x01, 0x68, 0xBB, 0x4C, 0x10, 0x6A, 0x30, 0xAA, 0xC9, 0xBF, 0x4B, 0x01, 0xBD, 0x2F, 0x3A, 0xD4, 0x71, 0xD1,
+0x12, 0x6E, 0xCB, 0xA1, 0x24, 0xBA, 0x58, 0x0D, 0x91, 0x0D, 0x35, 0x72, 0x52, 0x83, 0xD5, 0xE3, 0x84, 0xEA, 0xF5, 0xDB, 0x42,
+0x33, 0x55, 0x88, 0xCB, 0x2E, 0x5C, 0xE1, 0x6B, 0x68, 0x00, 0x58, 0xFE, 0xAD, 0x6B, 0xB9, 0x84, 0xCD, 0xC2, 0x23, 0x4A, 0xEA,
+0x51, 0xBD, 0xBE, 0x9F, 0xB2, 0x2B, 0xBA, 0xB4, 0xCC, 0xE2, 0x59, 0x6B, 0x5C, 0x30, 0x34, 0xD4, 0x90, 0xF3, 0x16, 0xEB, 0x96,
+0x87, 0xEF, 0x88, 0x26, 0x75, 0xC6, 0xCC, 0x78, 0xBB, 0xD0, 0xE5, 0x43, 0xD1, 0xAD, 0x6D, 0xA6, 0xA5, 0x4F, 0x51, 0x9D, 0x21,
+0xB3, 0x1A, 0xAF, 0x36, 0x47, 0x79, 0x8E, 0xB4, 0x32, 0x4B, 0x9E, 0x1B, 0x6C, 0x9E, 0xA7, 0xA8, 0xAB, 0xCD, 0xB4, 0xB4, 0x59,
+0xAB, 0x73, 0x2D, 0xE5, 0x66, 0xC7, 0x8C, 0x5B, 0x90, 0xD7, 0xE7, 0x2C, 0x2D, 0x71, 0x16, 0x68, 0x95, 0x21, 0xC9, 0x7A, 0xA7,
+0xA7, 0x7B, 0x3B, 0xDB, 0xFC, 0xC4, 0xD9, 0x6B, 0x30, 0xEB, 0xA8, 0x07, 0x73, 0xE7, 0x71, 0xA2, 0xC2, 0x32, 0x55, 0xE2, 0x3E,
+0xD0, 0xF2, 0xC8, 0x9F, 0x72, 0x13, 0xBB, 0x2C, 0x95, 0x67, 0xFE, 0xAA, 0xE5, 0x9B, 0xB1, 0x8F, 0x97, 0xAE, 0x6B, 0xC5, 0xD5,
+0x70, 0x0F, 0xB7, 0x3C, 0x0C, 0xE6, 0xA0, 0x7E, 0x62, 0xE7, 0xF4, 0x8A, 0x3B, 0xB2, 0x87, 0x86, 0x65, 0x83, 0x5E, 0x2F, 0xD7,
+0xA5, 0x50, 0xF5, 0x96, 0xE6, 0x83, 0xCA, 0xD3, 0x28, 0x40, 0xCE, 0x18, 0x3F, 0x43, 0xF1, 0x12, 0xEC, 0x5D, 0x3C, 0x32, 0xC4,
+0x89, 0x2C, 0x5C, 0x82, 0x60, 0xB1, 0x25, 0xDB, 0x95, 0x03, 0x37, 0xE5, 0xEE, 0xE4, 0x34, 0x97, 0x8F, 0x86, 0xB9, 0xAC, 0x47,
+0x57, 0xC2, 0x2E, 0x9B, 0x25, 0xD1, 0x29, 0x4B, 0xC3, 0x30, 0x05, 0xA8, 0x26, 0x24, 0xB8, 0x45, 0x2B, 0x40, 0x18, 0x9A, 0xFF,
+0xA2, 0x9E, 0x45, 0x29, 0x06, 0xAD, 0xA7, 0xF3, 0xD0, 0x22, 0x97, 0xCD, 0xB4, 0x4C, 0x5E, 0x25, 0x0B, 0xF2, 0x85, 0x27, 0x51,
+0xB1, 0x39, 0x66, 0x67, 0xF9, 0x90, 0xAB, 0xDC, 0x70, 0x96, 0xA9, 0x0F, 0x6E, 0x3E, 0x37, 0xA6, 0xFD, 0x2A, 0xAB, 0xBD, 0x3C,
+0x79, 0xE4, 0x41, 0x9B, 0x16, 0xDA, 0x14, 0xEE, 0x95, 0x08, 0x6D, 0x71, 0x7E, 0x64, 0xF7, 0x86, 0xC7, 0xE5, 0x6C, 0xD1, 0xF8,
+0xC4, 0x00, 0xD9, 0x94, 0x66, 0xA6, 0x21, 0x78, 0x76, 0x80, 0x8D, 0x0C, 0x09, 0x55, 0xEB, 0x08, 0x0E, 0x88, 0x51, 0xCD, 0x8F,
+0x19, 0x8A, 0x63, 0x83, 0xEF, 0x2F, 0xC3, 0xA3, 0xA8, 0x83, 0xAC, 0xC5, 0x32, 0x54, 0x0E, 0x0A, 0x41, 0x17, 0xD9, 0xBB, 0xA8,
+0xC2, 0xF4, 0x8C, 0xA1, 0x45, 0x6C, 0xF9, 0xB1, 0x13, 0x2D, 0xEA, 0xDB, 0xFB, 0xF1, 0x03, 0xBE, 0xB7, 0x31, 0xA5, 0xC9, 0xEE,
+0x59, 0x57, 0x8E, 0xDB, 0xC9, 0xF5, 0x00, 0x7B, 0x1C, 0xEC, 0xD7, 0x56, 0x94, 0xEF, 0xC2, 0xE0, 0x43, 0x67, 0xBD, 0xD7, 0x92,
+0x25, 0xD3, 0x9D, 0x2D, 0x43, 0x02, 0x15, 0xBC, 0xC9, 0x3D, 0x36, 0x83, 0x79, 0x67, 0xDD, 0xDC, 0x51, 0xEC, 0xF9, 0x2B, 0xA4,
+0xBC, 0x63, 0x9F, 0x7D, 0xAE, 0xA1, 0x92, 0x65, 0xF4, 0x78, 0xE2, 0xB2, 0x6D, 0x6D, 0x18, 0x17, 0x31, 0x8F, 0x34, 0x3A, 0x9D,
+0x1F, 0x44, 0xC7, 0x94, 0xA7, 0x9B, 0xEF, 0x98, 0xBD, 0xDB, 0xDA, 0xBD, 0x93, 0x9E, 0x05, 0x06, 0x75, 0x14, 0x9B, 0x3D, 0x19,
+0x24, 0x07, 0x35, 0xCA, 0xB2, 0x1E, 0xA2, 0xD8, 0xE5, 0xE2, 0x1A, 0x4A, 0x8B, 0x1C, 0xD7, 0x85, 0x0A, 0x3D, 0x4C, 0x18, 0x70,
+0x5C, 0x5E, 0xF5, 0x5D, 0x38, 0xE5, 0xB7, 0xC6, 0xF7, 0x1F, 0x29, 0x69, 0x33, 0xED, 0x13, 0x09, 0x65, 0xD2, 0xAC, 0x51, 0x4E,
+0xAD, 0xB4, 0x08, 0xA5, 0x8E, 0xC5, 0x81, 0x15, 0x09, 0x91, 0xF5, 0xF3, 0xC0, 0x63, 0x61, 0x65, 0x96, 0xC7, 0x04, 0xF2, 0x11,
+0x46, 0x3F, 0xA3, 0x75, 0x65, 0x80, 0x5F, 0x40, 0xD5, 0xE3, 0x85, 0x76, 0xB4, 0x7B, 0x4D, 0x96, 0xAD, 0x58, 0x7A, 0x81, 0xBE,
+0x0C, 0xF1, 0x2A, 0x27, 0xB2, 0xF2, 0x86, 0xEF, 0x8D, 0x41, 0x54, 0xD4, 0x23, 0x0B, 0x1C, 0x20, 0x17, 0x1C, 0x8D, 0x19, 0x5D,
+0x70, 0xA3, 0x5E, 0x1C, 0x1C, 0xBC, 0xE1, 0x7C, 0x24, 0xB6, 0x3B, 0xC8, 0xBE, 0xD3, 0x19, 0x10, 0xD6, 0x0F, 0xF9, 0x09, 0x0E,
+0x54, 0x0B, 0x8D, 0xE9, 0x1A, 0xB6, 0xAB, 0xEA, 0x69, 0x9A, 0x51, 0x63, 0x7A, 0x66, 0x54, 0x7A, 0x8B, 0x32, 0x2A, 0x73, 0xB1,
+0x24, 0x47, 0x35, 0x0C, 0xCD, 0x56, 0x3C, 0x88, 0xC2, 0xE9, 0x5F, 0x2C, 0x2F, 0xB3, 0xB1, 0xC1, 0x91, 0xC1, 0x39, 0x6E, 0x26,
+0x89, 0xB3, 0xB0, 0xFD, 0x94, 0xFD, 0x9A, 0xA2, 0x21, 0x17, 0x35, 0x16, 0xF9, 0xE5, 0x17, 0xA2, 0x95, 0xC8, 0x10, 0x0E, 0x0A,
+0x25, 0x1E, 0xC4, 0xA9, 0x63, 0xAE, 0x75, 0xF8, 0x34, 0x3A, 0x6C, 0x9C, 0xB4, 0xDE, 0x68, 0xE5, 0x50, 0x8B, 0x6B, 0x5C, 0x85,
+0x46, 0x65, 0x14, 0x5F, 0x44, 0xC5, 0x54, 0xA6, 0x13, 0x01, 0x18, 0x58, 0xB5, 0x5D, 0x9A, 0xB1, 0x23, 0xC3, 0xB0, 0x6A, 0x11,
+0xBB, 0xAB, 0xA5, 0xC8, 0x83, 0x9A, 0xD0, 0xE0, 0xCA, 0x85, 0xB5, 0x40, 0xED, 0x52, 0x5C, 0x52, 0x46, 0xA4, 0x85, 0xF0, 0xE0,
+0x9E, 0xDF, 0x3F, 0xB3, 0xC8, 0x6D, 0x19, 0xAE, 0xD2, 0x8A, 0x57, 0x83, 0x92, 0xF8, 0xF5, 0xA9, 0xCD, 0xE6, 0x34, 0x66, 0x35,
+0x9A, 0x28, 0x83, 0x77, 0x2C, 0x52, 0x56, 0x30, 0x50, 0x65, 0x53, 0x49, 0x78, 0x72, 0x0F, 0x88, 0xE6, 0xB5, 0xC5, 0x66, 0x19,
+0x4A, 0xD9, 0xF8, 0xBA, 0x73, 0x88, 0x35, 0xC2, 0x2A, 0x99, 0xC4, 0xFA, 0x99, 0x1D, 0x89, 0x45, 0xBF, 0xD6, 0x4F, 0x2F, 0x79,
+0x8D, 0x27, 0x60, 0x2A, 0xAB, 0x60, 0x5D, 0x6B, 0x6E, 0xB2, 0x60, 0xE1, 0x26, 0x90, 0xE0, 0xC9, 0x36, 0xC1, 0x13, 0x62, 0x7C,
+0x29, 0x42, 0x19, 0xCD, 0x84, 0x96, 0xCC, 0xD3, 0x82, 0x96, 0x38, 0x39, 0x72, 0x30, 0xE3, 0x5F, 0x78, 0xD0, 0x3F, 0x08, 0x42,
+0x16, 0x51, 0xCE, 0xCF, 0xA0, 0x81, 0x20, 0x73, 0x0B, 0x91, 0x3C, 0xC1, 0xCB, 0x58, 0x79, 0xE8, 0xA9, 0xD2, 0xB8, 0xE0, 0xC7,
+0xA6, 0x71, 0xB4, 0x33, 0x17, 0xE5, 0x15, 0xE6, 0x7E, 0x15, 0xDD, 0x6A, 0xC0, 0xBD, 0xAA, 0x3A, 0x4A, 0xCE, 0x9E, 0x73, 0xFD,
+0x52, 0x57, 0x3A, 0x65, 0x96, 0x08, 0xBF, 0x86, 0x35, 0x26, 0x26, 0x6F, 0x59, 0x44, 0x6A, 0xE5, 0xC1, 0x46, 0xA2, 0xD5, 0xAD,
+0x94, 0xA7, 0x07, 0xF0, 0xFB, 0x5A, 0x7D, 0xD6, 0x5B, 0x2D, 0x2B, 0x3F, 0x38, 0x53, 0xAF, 0x53, 0xAE, 0xE3, 0xD7, 0x2B, 0xF1,
+0x3E, 0x46, 0xB5, 0xB4, 0xB8, 0x26, 0xDB, 0x50, 0x21, 0x6F, 0x92, 0xF2, 0x2A, 0xD4, 0xC8, 0x80, 0xAC, 0xD6, 0x42, 0xBD, 0xC3,
+0xD9, 0x00, 0xA0, 0xB8, 0x9D, 0x59, 0xAD, 0x63, 0x1F, 0xFE, 0xEA, 0xEB, 0xE0, 0x94, 0x2F, 0xCA, 0x54, 0x6B, 0xD8, 0x4D, 0x92,
+0xBE, 0x28, 0xC3, 0xCD, 0x8E, 0x8F, 0xA4, 0x39, 0x99, 0x8D, 0xD5, 0x37, 0x6F, 0x98, 0x0C, 0x63, 0x50, 0x0B, 0xC5, 0xAA, 0x28,
+0x77, 0x04, 0xF0, 0x68, 0x0F, 0x34, 0x41, 0xCA, 0xAB, 0x2D, 0xE4, 0xC2, 0xDF, 0xBC, 0x61, 0xB5, 0x6D, 0x8D, 0xEE, 0xDD, 0xF6,
+0x93, 0xDB, 0xEA, 0x42, 0x89, 0xB2, 0xEE, 0xB0, 0xAF, 0x14, 0xB1, 0xCF, 0x30, 0x31, 0xCE, 0xA8, 0x9D, 0x19, 0x69, 0x6D, 0xC8,
+0x6C, 0x32, 0xE3, 0xB6, 0xFC, 0x5A, 0x93, 0x65, 0xF3, 0x4D, 0xB0, 0x8D, 0x17, 0x59, 0x4C, 0xC3, 0x71, 0xF1, 0xA6, 0x08, 0x0C,
+0x8A, 0x6D, 0x81, 0xDB, 0x46, 0xC2, 0x17, 0xBC, 0x2D, 0xBE, 0xB0, 0x74, 0x49, 0xF3, 0x95, 0xB6, 0x34, 0x14, 0xAE, 0xC2, 0x73,
+0x76, 0x24, 0xB5, 0x7A, 0x6C, 0xE5, 0x8D, 0x83, 0x57, 0x23, 0x43, 0x96, 0x8E, 0xFA, 0xEC, 0x9D, 0xDF, 0xBF, 0x18, 0xD9, 0xE7,
+0x2B, 0xFD, 0x0B, 0x25, 0xCF, 0x84, 0xAD, 0xDE, 0x3B, 0x01, 0xEE, 0x02, 0xB4, 0x26, 0x05, 0x1F, 0x80, 0x1D, 0x09, 0xC0, 0x4D,
+0xAB, 0xAA, 0x16, 0xB0, 0xF5, 0x33, 0x21, 0x06, 0xC8, 0x58, 0x76, 0x2E, 0x73, 0x36, 0xA3, 0x2A, 0x5C, 0x9F, 0xB5, 0xBB, 0xA5,
+0xF5, 0x03, 0x56, 0x56, 0x70, 0xE3, 0xB9, 0x27, 0xD1, 0x9C, 0x13, 0xA4, 0x77, 0xBB, 0x0C, 0x5E, 0x35, 0x59, 0xB4, 0xB7, 0x0A,
+0xE0, 0x82, 0x22, 0x3A, 0xE6, 0x60, 0xE1, 0xF4, 0x98, 0x7B, 0xDD, 0x53, 0x03, 0xCE, 0x8C, 0x32, 0x4D, 0x14, 0x5B, 0xFB, 0x47,
+0x04, 0xF1, 0xF8, 0x07, 0xC5, 0x30, 0x73, 0xD3, 0x0B, 0xAC, 0x75, 0x57, 0x57, 0xC9, 0x53, 0xA9, 0x22, 0x4F, 0x75, 0x9B, 0xD5,
+0x31, 0x95, 0x4D, 0x87, 0x47, 0x79, 0xE4, 0x7B, 0xE1, 0xBB, 0x55, 0x1B, 0x6E, 0xBF, 0xDD, 0x67, 0xED, 0xDC, 0x24, 0x6D, 0x6D,
+0x23, 0xEF, 0xB8, 0xB0, 0x86, 0x01, 0x58, 0x2D, 0xD0, 0x70, 0xD4, 0xD4, 0x4E, 0x5E, 0x7B, 0xE1, 0x0D, 0xF9, 0xA8, 0x5A, 0x43,
+0x3D, 0xC0, 0xCB, 0x07, 0xD6, 0x8B, 0x6A, 0x38, 0x94, 0xF7, 0x60, 0xD4, 0xE6, 0xDB, 0x4D, 0xE8, 0xD6, 0xCE, 0x23, 0x54, 0x03,
+0xBD, 0xF5, 0x2E, 0xC5, 0x81, 0x2A, 0xF1, 0xD4, 0xD4, 0xA0, 0xA0, 0xA5, 0x7C, 0x6E, 0x6A, 0x24, 0x0E, 0x56, 0xC9, 0xC7, 0xEA,
+0xC4, 0xCB, 0xC3, 0x55, 0xF2, 0xB1, 0xA1, 0x85, 0x60, 0x16, 0xBD, 0x48, 0xD9, 0x67, 0x55, 0xD9, 0xC9, 0x98, 0x4F, 0xDB, 0x86,
+0x8D, 0x87, 0x12, 0x94, 0x80, 0x69, 0x03, 0xEA, 0x8A, 0xBF, 0x96, 0xDA, 0x4C, 0x25, 0x82, 0x0F, 0x80, 0xB0, 0x1A, 0x05, 0x5E,
+0xBD, 0x5F, 0x4B, 0xE4, 0xA9, 0x29, 0x1B, 0x21, 0xC3, 0x81, 0x4D, 0xCC, 0xDA, 0x91, 0x06, 0xA8, 0x75, 0xD3, 0xEB, 0x3B, 0xE2,
+0xFA, 0xB5, 0x9E, 0x7A, 0x7D, 0xD7, 0xF9, 0x3B, 0x7D, 0x11, 0x9A, 0xA3, 0xCF, 0x4D, 0x6D, 0x1B, 0x20, 0x97, 0x09, 0x82, 0xE2,
+0x70, 0x9F, 0x52, 0x88, 0x4B, 0xF2, 0xB0, 0x14, 0xA1, 0xB1, 0x8B, 0x7C, 0x64, 0xB6, 0xF6, 0x1E, 0xDE, 0x7B, 0xF8, 0xD0, 0xFA,
+0x75, 0x65, 0x34, 0x6A, 0x19, 0x82, 0x7D, 0x0C, 0x15, 0x20, 0xEC, 0x80, 0x21, 0x61, 0x27, 0x68, 0xA7, 0x99, 0x00, 0xD2, 0x42,
+0x33, 0xF9, 0x5F, 0xD2, 0xB1, 0x6B, 0xE1, 0x21, 0x8B, 0x5C, 0xB3, 0x3D, 0xDE, 0x22, 0xED, 0xDA, 0x63, 0xE2, 0xA9, 0x7D, 0xF0,
+0xB1, 0x60, 0x51, 0x90, 0xC5, 0xDB, 0xE2, 0xFA, 0xB5, 0x8C, 0xA8, 0xF7, 0x5B, 0x4F, 0x8B, 0x88, 0x19, 0x14, 0x06, 0x8C, 0x16,
+0xB3, 0x5F, 0xA2, 0x57, 0x57, 0xF4, 0x3A, 0x2D, 0x42, 0xD6, 0xAD, 0xB8, 0xB1, 0x28, 0x78, 0xBF, 0xE3, 0xDC, 0x46, 0x33, 0x7E,
+0x45, 0xBC, 0x7D, 0xB9, 0x9E, 0xEA, 0xA0, 0xEA, 0x87, 0x51, 0xFA, 0x28, 0xE7, 0x01, 0xEC, 0x96, 0x30, 0xE1, 0xEA, 0xED, 0x8A,
+0x3B, 0xEB, 0xD8, 0x94, 0xA7, 0xAA, 0x5B, 0x5A, 0x96, 0x16, 0x68, 0x6A, 0x8B, 0xAF, 0x97, 0xB4, 0xC1, 0xD4, 0x2C, 0xD1, 0xD4,
+0x3E, 0x2A, 0xDF, 0x6B, 0x3D, 0xD4, 0x0F, 0x7C, 0x60, 0x5B, 0xF9, 0x6E, 0x35, 0xD0, 0x92, 0xDD, 0xA2, 0x62, 0x00, 0xE1, 0xA1,
+0x6A, 0xFD, 0xA8, 0x8D, 0x7D, 0xAF, 0xCF, 0x4F, 0xCC, 0x30, 0x1D, 0xD9, 0x76, 0x32, 0x1B, 0xEC, 0x05, 0x5B, 0x44, 0xC0, 0xD0,
+0x28, 0xB9, 0xA5, 0x9C, 0xCD, 0xAA, 0x78, 0xD1, 0x8D, 0xA9, 0x79, 0xCD, 0xB9, 0xAD, 0x5C, 0x87, 0x6D, 0x38, 0x0C, 0xA6, 0xAB,
+0xDF, 0xE2, 0x68, 0x73, 0xAB, 0xE2, 0x65, 0x2D, 0x40, 0xF7, 0x6E, 0x73, 0xE7, 0xA5, 0x43, 0xF3, 0xB2, 0x96, 0x81, 0x78, 0xBF,
+0x44, 0xF9, 0xF2, 0xB6, 0xB2, 0x40, 0xEC, 0x7A, 0x3E, 0x14, 0x5A, 0x99, 0xFE, 0x91, 0x88, 0x18, 0xF3, 0x10, 0xF2, 0xEB, 0xBD,
+0xDD, 0xA7, 0x7B, 0xBB, 0x7F, 0xBD, 0xDB, 0x7D, 0xFA, 0xEC, 0xED, 0xEF, 0x6F, 0xF7, 0xE0, 0xD7, 0xB0, 0x7E, 0xDC, 0xA4, 0xEE,
+0xB4, 0xC8, 0x2F, 0xB1, 0xE6, 0x9B, 0x56, 0xA5, 0xEB, 0xDC, 0x84, 0xB6, 0x38, 0xCD, 0xB7, 0x6C, 0x1B, 0xD6, 0xA8, 0x66, 0x84,
+0x34, 0x2E, 0x93, 0x66, 0x77, 0x54, 0x96, 0xA9, 0x95, 0x77, 0x8A, 0x9C, 0x33, 0xB7, 0xDB, 0xF4, 0x03, 0x03, 0x15, 0xEE, 0xA9,
+0xD0, 0x78, 0x69, 0x35, 0xD9, 0x10, 0x0D, 0xAB, 0xF3, 0xA5, 0x1E, 0x34, 0xEA, 0x24, 0x69, 0x27, 0xCE, 0xCD, 0x44, 0xD5, 0x51,
+0xBF, 0xB2, 0xBA, 0x6E, 0x98, 0x41, 0xEB, 0xE2, 0x75, 0x4F, 0xA4, 0x4C, 0x83, 0x9B, 0x8D, 0xCC, 0xC0, 0x57, 0xAF, 0xD1, 0xA0,
+0x2C, 0x97, 0xBF, 0xAB, 0xBA, 0x01, 0x93, 0x9F, 0x98, 0x77, 0x6D, 0x02, 0xD5, 0x03, 0x01, 0xAA, 0xB9, 0xAF, 0x98, 0x08, 0x63,
+0x52, 0x66, 0xFA, 0xDA, 0x72, 0x67, 0xB6, 0xD6, 0xBE, 0x7C, 0x41, 0xCF, 0x42, 0x44, 0xB9, 0xCB, 0xC2, 0x8D, 0xC9, 0xF8, 0xCE,
+0x79, 0xF9, 0x2A, 0xCE, 0x93, 0xA9, 0x06, 0x48, 0x59, 0xA9, 0x5A, 0x1C, 0x0C, 0x8D, 0xCB, 0x4C, 0x8C, 0xB6, 0x28, 0x25, 0x3F,
+0x02, 0xB3, 0x9C, 0x3F, 0x83, 0x5C, 0x68, 0x56, 0x15, 0xAF, 0x45, 0x6E, 0x5D, 0x7E, 0x36, 0x52, 0x39, 0xDE, 0xAB, 0xDC, 0x88,
+0x2F, 0xC5, 0x40, 0xE9, 0x12, 0xB5, 0xEE, 0x30, 0xEE, 0x0D, 0xD5, 0xAB, 0x41, 0x64, 0xB3, 0xDA, 0xC0, 0xC9, 0x1A, 0x6A, 0x5F,
+0x97, 0xB2, 0x99, 0x3B, 0x3F, 0x0D, 0x4D, 0x14, 0x91, 0x9C, 0xD6, 0x19, 0xB1, 0x9D, 0x73, 0x52, 0x9D, 0xA1, 0x1B, 0xD8, 0x9C,
+0x35, 0xAA, 0x39, 0x40, 0xED, 0x86, 0xAF, 0xB0, 0xF5, 0x5B, 0x82, 0x68, 0x15, 0x6E, 0x6A, 0xB5, 0x46, 0x39, 0x3D, 0xB9, 0xE9,
+0x81, 0x62, 0xB2, 0x3C, 0x1A, 0xA0, 0xDA, 0x27, 0x4C, 0xCB, 0x0B, 0xB3, 0xA3, 0xA9, 0x55, 0x61, 0x9D, 0xF0, 0x86, 0xF2, 0xA3,
+0x69, 0x0D, 0x2D, 0xA5, 0x75, 0xC2, 0x1B, 0x2A, 0x16, 0x47, 0x23, 0x58, 0xC5, 0x40, 0xE1, 0x1D, 0xA4, 0xD9, 0xA1, 0xB7, 0x56,
+0x8D, 0x13, 0x01, 0x18, 0xBF, 0x00, 0xA6, 0xB5, 0x29, 0x6E, 0x77, 0x37, 0x98, 0xD0, 0x2C, 0x84, 0xC5, 0x82, 0x9C, 0x8A, 0xB7,
+0x58, 0xB5, 0x8B, 0xD7, 0x44, 0x35, 0xF3, 0x36, 0x6B, 0xCE, 0x45, 0x5A, 0xBA, 0x90, 0x15, 0xA7, 0xB2, 0xA8, 0xD4, 0x39, 0x84,
+0x97, 0xC8, 0xCA, 0xFA, 0x7A, 0xAB, 0x9E, 0x88, 0x48, 0xF6, 0xD5, 0xCF, 0xA7, 0xA0, 0x3F, 0xD9, 0x7D, 0xFC, 0xBA, 0xF0, 0x0C,
+0x98, 0x65, 0x7E, 0xE9, 0x61, 0x6D, 0x2E, 0xD7, 0x3D, 0x68, 0x05, 0x0B, 0x8D, 0x5D, 0xD6, 0x9A, 0x86, 0xE6, 0x47, 0x46, 0x1A,
+0x06, 0xAF, 0xED, 0x65, 0x65, 0xF8, 0x42, 0x12, 0x2C, 0x71, 0x3A, 0xBA, 0x82, 0x86, 0xEC, 0xBA, 0xB6, 0x74, 0x36, 0x10, 0x04,
+0x95, 0xFC, 0x86, 0xC5, 0x9D, 0xF3, 0x46, 0x71, 0xB2, 0x41, 0x7A, 0x1B, 0x09, 0xC5, 0x3F, 0x1F, 0x32, 0x5E, 0xE9, 0x91, 0x55,
+0xD2, 0xEB, 0x5D, 0x7C, 0x69, 0xBE, 0x14, 0x2A, 0x72, 0xFA, 0xAB, 0xE4, 0x9C, 0xF4, 0xD4, 0x94, 0x7E, 0xAF, 0xF9, 0x72, 0x6B,
+0x71, 0x8D, 0xB4, 0x72, 0x45, 0x36, 0xB5, 0x44, 0x98, 0x48, 0xDC, 0x02, 0xA2, 0x67, 0x59, 0x3D, 0xD1, 0x87, 0xA5, 0x4A, 0x5C,
+0x1F, 0x5F, 0xBB, 0x8E, 0x4A, 0x54, 0xAE, 0x9F, 0xA6, 0xC5, 0x17, 0x41, 0x5A, 0x4F, 0x4B, 0x14, 0x12, 0xBD, 0x5C, 0x51, 0xDF,
+0x53, 0x8F, 0xA3, 0x2E, 0x61, 0x85, 0x57, 0x2D, 0x7A, 0xF4, 0x87, 0xC0, 0x94, 0xC7, 0xDF, 0x39, 0x2D, 0x4C, 0x10, 0xF9, 0xDA,
+0x05, 0x90, 0x1D, 0x73, 0xB5, 0xE5, 0x57, 0xFA, 0x40, 0x91, 0xF3, 0x8F, 0x3D, 0xC9, 0x83, 0x97, 0x57, 0xEA, 0xCA, 0xBE, 0x92,
+0xC4, 0x51, 0x1B, 0x0E, 0xC9, 0x0E, 0xFE, 0xB9, 0x07, 0xAE, 0xB5, 0x92, 0xB4, 0xED, 0x5A, 0x99, 0xF6, 0xA7, 0x1B, 0x96, 0xCD,
+0x35, 0x97, 0x7F, 0xDA, 0x27, 0xF6, 0x6D, 0xE5, 0x68, 0x44, 0x42, 0xE3, 0x28, 0xBD, 0xEC, 0x0B, 0x68, 0x09, 0x65, 0x1F, 0x06,
+0x48, 0x87, 0x01, 0x0E, 0x9A, 0x19, 0x3F, 0x78, 0x0E, 0x07, 0x2F, 0x68, 0x71, 0x08, 0x44, 0x40, 0xD4, 0xBE, 0xAE, 0x78, 0x94,
+0x44, 0x73, 0xF2, 0xBB, 0x9F, 0xBD, 0x00, 0xD4, 0x8C, 0xA5, 0x4F, 0x2B, 0x88, 0xEB, 0xB8, 0x0C, 0xEC, 0x81, 0x33, 0x95, 0x99,
+0xDC, 0xCC, 0xE1, 0x99, 0xE5, 0xB5, 0xCA, 0x3D, 0x79, 0xDE, 0xA4, 0xED, 0x2C, 0x47, 0x05, 0xDE, 0x53, 0x9A, 0xBA, 0x12, 0xA0,
+0x00, 0xC6, 0x6F, 0xF6, 0x16, 0xA3, 0x81, 0x7D, 0x70, 0xAB, 0x84, 0xAC, 0xDE, 0x8A, 0x2E, 0xCF, 0x12, 0x00, 0x99, 0x63, 0x76,
+0xE0, 0x43, 0x9E, 0xFC, 0x38, 0xE1, 0x83, 0xA5, 0xF5, 0x2B, 0xD6, 0xC2, 0x14, 0xC2, 0x73, 0x56, 0xE5, 0x81, 0x18, 0x13, 0x76,
+0xA3, 0xA5, 0x5D, 0x88, 0x9D, 0xB3, 0x6D, 0x35, 0xC6, 0x4F, 0x41, 0xD8, 0xEC, 0xD9, 0x1C, 0x6E, 0x99, 0x9F, 0xBD, 0xBB, 0x78,
+0x37, 0x06, 0x7F, 0x06, 0x1F, 0xD4, 0xB7, 0xA1, 0x72, 0xCE, 0x9B, 0xB5, 0xBE, 0x79, 0x63, 0x03, 0x61, 0x6D, 0xA1, 0x6C, 0x98,
+0x3B, 0x5F, 0xF1, 0xC6, 0xC0, 0x2E, 0xFB, 0x9A, 0xA1, 0xC9, 0xAA, 0x3F, 0xAD, 0x1C, 0x5A, 0xEC, 0xEF, 0x01, 0xD5, 0x2A, 0xEE,
+0x1D, 0x5A, 0x4C, 0x52, 0x7C, 0x68, 0xEB, 0x79, 0xBF, 0xAD, 0xE7, 0x03, 0xEC, 0xC9, 0xA6, 0xB8, 0x5A, 0x5C, 0xB5, 0x2E, 0x88,
+0xED, 0xA7, 0xBB, 0xF4, 0x94, 0xDF, 0xD9, 0xE0, 0x94, 0xED, 0xCB, 0xD5, 0x52, 0x6F, 0x6B, 0xF0, 0x2A, 0x9B, 0x0D, 0xCB, 0x2E,
+0x41, 0x88, 0x36, 0xBC, 0x44, 0x15, 0x06, 0x5A, 0xCB, 0x75, 0xBD, 0x9D, 0x96, 0xA0, 0x97, 0x0D, 0x11, 0x61, 0xB5, 0x21, 0xBE,
+0x6B, 0x18, 0x0A, 0xAE, 0x1D, 0x6B, 0x4B, 0x63, 0x16, 0x6C, 0x60, 0x55, 0xB9, 0xAC, 0xDA, 0x52, 0x61, 0x11, 0x9D, 0x87, 0x54,
+0x06, 0xD2, 0xEE, 0xD4, 0x57, 0x78, 0x45, 0x7E, 0x05, 0x44, 0x1C, 0xE9, 0xA8, 0x73, 0x0E, 0x57, 0x77, 0x8C, 0x8E, 0x92, 0x52,
+0x5B, 0x05, 0x19, 0xED, 0x2D, 0x76, 0xC7, 0xBD, 0x52, 0xFF, 0xA1, 0xAC, 0xFF, 0x60, 0x15, 0x02, 0x90, 0x9D, 0x5C, 0x4B, 0xE6,
+0xE6, 0x97, 0xCD, 0x50, 0x7C, 0x4D, 0x10, 0x37, 0xB0, 0x44, 0xE3, 0xCE, 0x79, 0x31, 0xE9, 0x0B, 0xFC, 0x00, 0x98, 0x73, 0x02,
+0x7B, 0x1C, 0x8D, 0x1E, 0xFB, 0x73, 0xF8, 0x39, 0x04, 0xB7, 0x82, 0x1E, 0x81, 0x02, 0xE4, 0xDF, 0xF6, 0xE2, 0xDF, 0x7D, 0x92,
+0x3D, 0x70, 0x2F, 0x5D, 0x18, 0xAC, 0xD9, 0x36, 0x1E, 0xE0, 0x25, 0x9F, 0x7B, 0x7B, 0xAF, 0x3E, 0xF7, 0x10, 0x38, 0x7E, 0x9D,
+0x1C, 0xCF, 0xFB, 0xA3, 0x7C, 0x10, 0x43, 0x86, 0x20, 0x49, 0x60, 0x4D, 0x3E, 0xF7, 0xB6, 0x9D, 0xD0, 0xA5, 0x01, 0x6F, 0xE7,
+0x4C, 0xA2, 0x24, 0xB3, 0xBF, 0x70, 0x5C, 0xE5, 0x19, 0xA7, 0x28, 0x73, 0xF0, 0xB3, 0x08, 0x44, 0xBB, 0x7E, 0x43, 0x2E, 0x40,
+0x6D, 0xD9, 0x00, 0x2F, 0x34, 0xF1, 0x6F, 0x0A, 0x01, 0x13, 0xC1, 0x8F, 0x50, 0x53, 0x45, 0xCD, 0x3C, 0x9D, 0x62, 0x0D, 0xA7,
+0x38, 0xBC, 0xB0, 0x1A, 0xA6, 0xB1, 0x50, 0x61, 0x95, 0x55, 0x3D, 0x7E, 0xFA, 0x82, 0xFF, 0x09, 0x2D, 0xD4, 0x54, 0x02, 0x49,
+0x7E, 0x2C, 0x4C, 0xFD, 0xB4, 0x41, 0x71, 0xCA, 0xA8, 0xF0, 0x33, 0xF9, 0x6A, 0xEE, 0x46, 0xE5, 0x87, 0x19, 0x0B, 0x82, 0x91,
+0x3F, 0xA3, 0x9C, 0x5D, 0x63, 0xCD, 0x53, 0xF9, 0x41, 0x65, 0xC1, 0x13, 0x82, 0xD8, 0x65, 0xA2, 0xBB, 0xFB, 0x48, 0x99, 0x38,
+0x39, 0x26, 0xC6, 0xE2, 0xC8, 0x32, 0x9D, 0x87, 0x60, 0xF1, 0xF3, 0x33, 0x62, 0xEC, 0xB6, 0x4F, 0x31, 0xB4, 0xF8, 0xB7, 0xFC,
+0x4F, 0xF4, 0x54, 0xD9, 0xA2, 0xB7, 0x99, 0xF0, 0x04, 0x7D, 0x9A, 0x8B, 0x87, 0x53, 0x07, 0xF8, 0x1D, 0x56, 0xC7, 0x2D, 0xFF,
+0x94, 0x8F, 0xD4, 0xE8, 0x1B, 0x3D, 0x7D, 0xAD, 0x68, 0x02, 0x32, 0xFF, 0x14, 0xE0, 0xFE, 0x77, 0x56, 0x8C, 0x61, 0x84, 0x44,
+0x40, 0xA4, 0xDA, 0x57, 0xAB, 0x36, 0xFD, 0xCA, 0x1F, 0x03, 0x5A, 0x9E, 0x04, 0x89, 0xB0, 0xD2, 0xD8, 0x9F, 0x64, 0x61, 0xBD,
+0xAB, 0x14, 0xE0, 0xB6, 0xDB, 0x7F, 0x67, 0xFA, 0x02, 0x1B, 0x24, 0x00, 0x47, 0xE6, 0x0A, 0x24, 0xD0, 0xFF, 0xB4, 0x92, 0x3A,
+0x03, 0xE4, 0x50, 0x17, 0x4A, 0xFF, 0x3B, 0x73, 0x60, 0x69, 0x69, 0xBE, 0xE9, 0x1C, 0xF9, 0x57, 0x9D, 0x40, 0xB4, 0xB2, 0x64,
+0x6E, 0xEB, 0x74, 0xD4, 0x3F, 0xA0, 0x37, 0x94, 0x7F, 0x93, 0x6D, 0x28, 0xFE, 0xBA, 0xE3, 0xFF, 0x01, 0x80, 0x85, 0xF0, 0x40,
+0xEF, 0x71, 0x00, 0x00
 };
\ No newline at end of file
@@ -1,190 +1,84 @@
 #include <Arduino.h>
 
 static const uint8_t keyshtm[] PROGMEM={
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x68, 0x74, 0x6D,
-0x6C, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0D,
-0x0A, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65, 0x65,
-0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x64, 0x6E, 0x2E,
-0x6A, 0x73, 0x64, 0x65, 0x6C, 0x69, 0x76, 0x72, 0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x6E, 0x70, 0x6D, 0x2F, 0x62, 0x6F, 0x6F, 0x74,
-0x73, 0x74, 0x72, 0x61, 0x70, 0x40, 0x33, 0x2E, 0x34, 0x2E, 0x31, 0x2F, 0x64, 0x69, 0x73, 0x74, 0x2F, 0x63, 0x73, 0x73, 0x2F,
-0x62, 0x6F, 0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70, 0x2E, 0x6D, 0x69, 0x6E, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x69, 0x6E,
-0x74, 0x65, 0x67, 0x72, 0x69, 0x74, 0x79, 0x3D, 0x22, 0x73, 0x68, 0x61, 0x33, 0x38, 0x34, 0x2D, 0x48, 0x53, 0x4D, 0x78, 0x63,
-0x52, 0x54, 0x52, 0x78, 0x6E, 0x4E, 0x2B, 0x42, 0x64, 0x67, 0x30, 0x4A, 0x64, 0x62, 0x78, 0x59, 0x4B, 0x72, 0x54, 0x68, 0x65,
-0x63, 0x4F, 0x4B, 0x75, 0x48, 0x35, 0x7A, 0x43, 0x59, 0x6F, 0x74, 0x6C, 0x53, 0x41, 0x63, 0x70, 0x31, 0x2B, 0x63, 0x38, 0x78,
-0x6D, 0x79, 0x54, 0x65, 0x39, 0x47, 0x59, 0x67, 0x31, 0x6C, 0x39, 0x61, 0x36, 0x39, 0x70, 0x73, 0x75, 0x22, 0x20, 0x63, 0x72,
-0x6F, 0x73, 0x73, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x3D, 0x22, 0x61, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x22,
-0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73,
-0x3A, 0x2F, 0x2F, 0x61, 0x6A, 0x61, 0x78, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x61, 0x70, 0x69, 0x73, 0x2E, 0x63, 0x6F,
-0x6D, 0x2F, 0x61, 0x6A, 0x61, 0x78, 0x2F, 0x6C, 0x69, 0x62, 0x73, 0x2F, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x2F, 0x33, 0x2E,
-0x37, 0x2E, 0x31, 0x2F, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x2E, 0x6D, 0x69, 0x6E, 0x2E, 0x6A, 0x73, 0x22, 0x3E, 0x3C, 0x2F,
-0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D,
-0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x64, 0x6E, 0x2E, 0x6A, 0x73, 0x64, 0x65, 0x6C, 0x69, 0x76, 0x72,
-0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x6E, 0x70, 0x6D, 0x2F, 0x62, 0x6F, 0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70, 0x40, 0x33, 0x2E,
-0x34, 0x2E, 0x31, 0x2F, 0x64, 0x69, 0x73, 0x74, 0x2F, 0x6A, 0x73, 0x2F, 0x62, 0x6F, 0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70,
-0x2E, 0x6D, 0x69, 0x6E, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x72, 0x69, 0x74, 0x79, 0x3D, 0x22, 0x73,
-0x68, 0x61, 0x33, 0x38, 0x34, 0x2D, 0x61, 0x4A, 0x32, 0x31, 0x4F, 0x6A, 0x6C, 0x4D, 0x58, 0x4E, 0x4C, 0x35, 0x55, 0x79, 0x49,
-0x6C, 0x2F, 0x58, 0x4E, 0x77, 0x54, 0x4D, 0x71, 0x76, 0x7A, 0x65, 0x52, 0x4D, 0x5A, 0x48, 0x32, 0x77, 0x38, 0x63, 0x35, 0x63,
-0x52, 0x56, 0x70, 0x7A, 0x70, 0x55, 0x38, 0x59, 0x35, 0x62, 0x41, 0x70, 0x54, 0x70, 0x70, 0x53, 0x75, 0x55, 0x6B, 0x68, 0x5A,
-0x58, 0x4E, 0x30, 0x56, 0x78, 0x48, 0x64, 0x22, 0x20, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x3D,
-0x22, 0x61, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E,
-0x0D, 0x0A, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D,
-0x38, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x76, 0x69, 0x65, 0x77,
-0x70, 0x6F, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x75, 0x73, 0x65, 0x72, 0x2D, 0x73,
-0x63, 0x61, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x3D, 0x6E, 0x6F, 0x2C, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x2D, 0x73,
-0x63, 0x61, 0x6C, 0x65, 0x3D, 0x31, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x65,
-0x3D, 0x31, 0x2C, 0x20, 0x6D, 0x69, 0x6E, 0x69, 0x6D, 0x75, 0x6D, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x3D, 0x31, 0x2C, 0x20,
-0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x3E, 0x0D,
-0x0A, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x6D, 0x6F,
-0x62, 0x69, 0x6C, 0x65, 0x2D, 0x77, 0x65, 0x62, 0x2D, 0x61, 0x70, 0x70, 0x2D, 0x63, 0x61, 0x70, 0x61, 0x62, 0x6C, 0x65, 0x22,
-0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x79, 0x65, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x0D, 0x0A, 0x3C, 0x6D,
-0x65, 0x74, 0x61, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x6D, 0x6F, 0x62, 0x69, 0x6C,
-0x65, 0x2D, 0x77, 0x65, 0x62, 0x2D, 0x61, 0x70, 0x70, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2D, 0x62, 0x61, 0x72, 0x2D,
-0x73, 0x74, 0x79, 0x6C, 0x65, 0x22, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75,
-0x6C, 0x74, 0x22, 0x20, 0x2F, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x61, 0x70,
-0x70, 0x6C, 0x65, 0x2D, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2D, 0x69, 0x63, 0x6F, 0x6E, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D,
-0x22, 0x66, 0x61, 0x76, 0x69, 0x63, 0x6F, 0x6E, 0x2E, 0x70, 0x6E, 0x67, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x69, 0x6E, 0x6B,
-0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x66, 0x61, 0x76,
-0x69, 0x63, 0x6F, 0x6E, 0x2E, 0x70, 0x6E, 0x67, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x69, 0x6D, 0x61, 0x67, 0x65,
-0x2F, 0x70, 0x6E, 0x67, 0x22, 0x20, 0x2F, 0x3E, 0x0D, 0x0A, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x54, 0x69, 0x6E, 0x79,
-0x20, 0x44, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x3C, 0x2F, 0x74, 0x69,
-0x74, 0x6C, 0x65, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0D, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E,
-0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20,
-0x6D, 0x69, 0x6E, 0x28, 0x39, 0x30, 0x25, 0x2C, 0x20, 0x35, 0x30, 0x30, 0x70, 0x78, 0x29, 0x3B, 0x20, 0x6D, 0x61, 0x72, 0x67,
-0x69, 0x6E, 0x3A, 0x20, 0x30, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x3B, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20,
-0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x64, 0x3D, 0x22,
-0x66, 0x6F, 0x72, 0x6D, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x66, 0x69, 0x65, 0x6C,
-0x64, 0x73, 0x65, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D,
-0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x22,
-0x3E, 0x44, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x42, 0x6F, 0x61, 0x72, 0x64, 0x20, 0x53, 0x65, 0x74,
-0x75, 0x70, 0x3C, 0x2F, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
-0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61,
-0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2D, 0x6C, 0x61,
-0x62, 0x65, 0x6C, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x6E, 0x72, 0x4B, 0x65, 0x79, 0x22, 0x3E, 0x4E, 0x61, 0x74, 0x69,
-0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x52, 0x61, 0x69, 0x6C, 0x20, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65,
-0x6C, 0x3E, 0x0D, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x72, 0x4B, 0x65, 0x79, 0x22,
-0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C,
-0x64, 0x65, 0x72, 0x3D, 0x22, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x2C, 0x20, 0x65, 0x6E, 0x74, 0x65,
-0x72, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x33, 0x36, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x74,
-0x6F, 0x6B, 0x65, 0x6E, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E,
-0x74, 0x72, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x6D, 0x64, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x70, 0x61,
-0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x6C, 0x70, 0x2D, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x3E,
-0x59, 0x6F, 0x75, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x20, 0x61, 0x20, 0x4E, 0x61, 0x74, 0x69, 0x6F,
-0x6E, 0x61, 0x6C, 0x20, 0x52, 0x61, 0x69, 0x6C, 0x20, 0x45, 0x6E, 0x71, 0x75, 0x69, 0x72, 0x69, 0x65, 0x73, 0x20, 0x44, 0x61,
-0x72, 0x77, 0x69, 0x6E, 0x20, 0x4C, 0x69, 0x74, 0x65, 0x20, 0x57, 0x65, 0x62, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x20,
-0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x69, 0x73, 0x68, 0x20, 0x74, 0x6F, 0x20,
-0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x4E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x52, 0x61, 0x69, 0x6C,
-0x20, 0x64, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2E, 0x20, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68,
-0x65, 0x20, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x61, 0x73, 0x20, 0x72, 0x65,
-0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x28, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
-0x20, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x2D, 0x6E, 0x6E, 0x6E, 0x6E, 0x2D, 0x6E, 0x6E, 0x6E, 0x6E, 0x2D, 0x6E,
-0x6E, 0x6E, 0x6E, 0x2D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x29, 0x2E, 0x20, 0x59, 0x6F,
-0x75, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20,
-0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x67, 0x65, 0x20,
-0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x72, 0x65, 0x61, 0x6C,
-0x74, 0x69, 0x6D, 0x65, 0x2E, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x72, 0x61, 0x69, 0x6C, 0x2E, 0x63, 0x6F, 0x2E,
-0x75, 0x6B, 0x2F, 0x4F, 0x70, 0x65, 0x6E, 0x4C, 0x44, 0x42, 0x57, 0x53, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x22, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x3E,
-0x68, 0x65, 0x72, 0x65, 0x3C, 0x2F, 0x61, 0x3E, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64,
-0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D,
-0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73,
-0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x20, 0x66, 0x6F, 0x72,
-0x3D, 0x22, 0x6F, 0x77, 0x6D, 0x4B, 0x65, 0x79, 0x22, 0x3E, 0x4F, 0x70, 0x65, 0x6E, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72,
-0x20, 0x4D, 0x61, 0x70, 0x20, 0x41, 0x50, 0x49, 0x20, 0x4B, 0x65, 0x79, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D,
-0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6F, 0x77, 0x6D, 0x4B, 0x65, 0x79, 0x22, 0x20, 0x74,
-0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65,
-0x72, 0x3D, 0x22, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x2C, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20,
-0x79, 0x6F, 0x75, 0x72, 0x20, 0x41, 0x50, 0x49, 0x20, 0x6B, 0x65, 0x79, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x6D, 0x64,
-0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x6C, 0x70,
-0x2D, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x3E, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x6F, 0x70,
-0x65, 0x6E, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x6D, 0x61, 0x70, 0x2E, 0x6F, 0x72, 0x67, 0x20, 0x61, 0x70, 0x69, 0x20,
-0x6B, 0x65, 0x79, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x69, 0x73, 0x68, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x69,
-0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72,
-0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E,
-0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20,
-0x61, 0x70, 0x69, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70,
-0x73, 0x3A, 0x2F, 0x2F, 0x68, 0x6F, 0x6D, 0x65, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x6D,
-0x61, 0x70, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x75, 0x73, 0x65, 0x72, 0x73, 0x2F, 0x73, 0x69, 0x67, 0x6E, 0x5F, 0x75, 0x70, 0x22,
-0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x3E, 0x68, 0x65, 0x72, 0x65,
-0x3C, 0x2F, 0x61, 0x3E, 0x2E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D,
-0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F,
-0x75, 0x70, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77,
-0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6C, 0x2D, 0x78,
-0x73, 0x2D, 0x36, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x3E, 0x0D, 0x0A, 0x3C, 0x62,
-0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x61, 0x76, 0x65, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D,
-0x22, 0x73, 0x61, 0x76, 0x65, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x20, 0x62, 0x74, 0x6E,
-0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F,
-0x6E, 0x22, 0x3E, 0x53, 0x61, 0x76, 0x65, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64,
-0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6C, 0x2D,
-0x78, 0x73, 0x2D, 0x36, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x3E, 0x0D, 0x0A, 0x3C,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x22, 0x20, 0x6E, 0x61,
-0x6D, 0x65, 0x3D, 0x22, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74,
-0x6E, 0x20, 0x62, 0x74, 0x6E, 0x2D, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x3E, 0x43, 0x61, 0x6E, 0x63,
-0x65, 0x6C, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A,
-0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x66, 0x69, 0x65,
-0x6C, 0x64, 0x73, 0x65, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x64, 0x69,
-0x76, 0x3E, 0x0D, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0D, 0x0A, 0x24, 0x28, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-0x65, 0x6E, 0x74, 0x29, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29,
-0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E, 0x72, 0x4B, 0x65, 0x79, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
-0x6E, 0x20, 0x3D, 0x20, 0x2F, 0x5E, 0x5B, 0x61, 0x2D, 0x66, 0x30, 0x2D, 0x39, 0x5D, 0x7B, 0x38, 0x7D, 0x2D, 0x5B, 0x61, 0x2D,
-0x66, 0x30, 0x2D, 0x39, 0x5D, 0x7B, 0x34, 0x7D, 0x2D, 0x5B, 0x61, 0x2D, 0x66, 0x30, 0x2D, 0x39, 0x5D, 0x7B, 0x34, 0x7D, 0x2D,
-0x5B, 0x61, 0x2D, 0x66, 0x30, 0x2D, 0x39, 0x5D, 0x7B, 0x34, 0x7D, 0x2D, 0x5B, 0x61, 0x2D, 0x66, 0x30, 0x2D, 0x39, 0x5D, 0x7B,
-0x31, 0x32, 0x7D, 0x24, 0x2F, 0x3B, 0x0D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x69,
-0x64, 0x61, 0x74, 0x65, 0x4B, 0x65, 0x79, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E,
-0x72, 0x56, 0x61, 0x6C, 0x20, 0x20, 0x3D, 0x20, 0x24, 0x28, 0x27, 0x23, 0x6E, 0x72, 0x4B, 0x65, 0x79, 0x27, 0x29, 0x2E, 0x76,
-0x61, 0x6C, 0x28, 0x29, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E,
-0x72, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x20, 0x3D, 0x20, 0x6E, 0x72, 0x56, 0x61, 0x6C, 0x2E, 0x6C, 0x65, 0x6E,
-0x67, 0x74, 0x68, 0x20, 0x3E, 0x20, 0x30, 0x3B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C,
-0x65, 0x53, 0x61, 0x76, 0x65, 0x20, 0x3D, 0x20, 0x21, 0x6E, 0x72, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x7C, 0x7C,
-0x20, 0x6E, 0x72, 0x4B, 0x65, 0x79, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x6E, 0x72,
-0x56, 0x61, 0x6C, 0x29, 0x3B, 0x0D, 0x0A, 0x24, 0x28, 0x27, 0x23, 0x73, 0x61, 0x76, 0x65, 0x27, 0x29, 0x2E, 0x70, 0x72, 0x6F,
-0x70, 0x28, 0x27, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x21, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65,
-0x53, 0x61, 0x76, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x2F, 0x2F, 0x20, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x73, 0x61,
-0x76, 0x65, 0x64, 0x20, 0x41, 0x50, 0x49, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x0D, 0x0A, 0x24, 0x2E, 0x67, 0x65, 0x74, 0x4A, 0x53,
-0x4F, 0x4E, 0x28, 0x27, 0x2F, 0x61, 0x70, 0x69, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x2C, 0x20, 0x66,
-0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x69, 0x66, 0x20,
-0x28, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6E, 0x72, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x24, 0x28, 0x27,
-0x23, 0x6E, 0x72, 0x4B, 0x65, 0x79, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6E, 0x72, 0x54,
-0x6F, 0x6B, 0x65, 0x6E, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6F,
-0x77, 0x6D, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x24, 0x28, 0x27, 0x23, 0x6F, 0x77, 0x6D, 0x4B, 0x65,
-0x79, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6F, 0x77, 0x6D, 0x54, 0x6F, 0x6B, 0x65, 0x6E,
-0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A, 0x2F, 0x2F, 0x20, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x20, 0x61, 0x66,
-0x74, 0x65, 0x72, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x0D, 0x0A, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65,
-0x4B, 0x65, 0x79, 0x73, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x24, 0x28, 0x27, 0x23, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x27, 0x29,
-0x2E, 0x70, 0x72, 0x6F, 0x70, 0x28, 0x27, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x66, 0x61, 0x6C,
-0x73, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x2F, 0x2F, 0x20, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74,
-0x65, 0x20, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x0D, 0x0A, 0x24, 0x28, 0x27, 0x23, 0x6E, 0x72, 0x4B, 0x65, 0x79,
-0x27, 0x29, 0x2E, 0x6F, 0x6E, 0x28, 0x27, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x27, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x61, 0x74, 0x65, 0x4B, 0x65, 0x79, 0x73,
-0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x24, 0x28, 0x27, 0x23, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x27,
-0x29, 0x2E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x28, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F,
-0x6E, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x22, 0x2F, 0x22, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x24, 0x28, 0x27,
-0x23, 0x73, 0x61, 0x76, 0x65, 0x27, 0x29, 0x2E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-0x6E, 0x20, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E, 0x72, 0x54, 0x6F, 0x6B, 0x65, 0x6E,
-0x20, 0x3D, 0x20, 0x24, 0x28, 0x27, 0x23, 0x6E, 0x72, 0x4B, 0x65, 0x79, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x28, 0x29, 0x3B,
-0x0D, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6F, 0x77, 0x6D, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x24, 0x28,
-0x27, 0x23, 0x6F, 0x77, 0x6D, 0x4B, 0x65, 0x79, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x63, 0x6F,
-0x6E, 0x73, 0x74, 0x20, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x0D, 0x0A, 0x6E, 0x72, 0x54, 0x6F,
-0x6B, 0x65, 0x6E, 0x3A, 0x20, 0x6E, 0x72, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x2C, 0x0D, 0x0A, 0x6F, 0x77, 0x6D, 0x54, 0x6F, 0x6B,
-0x65, 0x6E, 0x3A, 0x20, 0x6F, 0x77, 0x6D, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x0D, 0x0A, 0x7D, 0x3B, 0x0D, 0x0A, 0x24, 0x2E, 0x61,
-0x6A, 0x61, 0x78, 0x28, 0x7B, 0x0D, 0x0A, 0x75, 0x72, 0x6C, 0x3A, 0x20, 0x27, 0x2F, 0x73, 0x61, 0x76, 0x65, 0x6B, 0x65, 0x79,
-0x73, 0x27, 0x2C, 0x0D, 0x0A, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0D, 0x0A, 0x63,
-0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x2C, 0x0D, 0x0A, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x20, 0x4A, 0x53, 0x4F,
-0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x29, 0x2C,
-0x0D, 0x0A, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28,
-0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x72, 0x65,
-0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x29, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x44, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x73,
-0x65, 0x72, 0x76, 0x65, 0x72, 0x27, 0x73, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F,
-0x6E, 0x73, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x0D, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x72, 0x65,
-0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x22, 0x2F, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x2C, 0x0D, 0x0A, 0x65, 0x72, 0x72, 0x6F,
-0x72, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x78, 0x68, 0x72, 0x2C, 0x20, 0x73, 0x74, 0x61,
-0x74, 0x75, 0x73, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28,
-0x78, 0x68, 0x72, 0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x54, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x20, 0x2F, 0x2F,
-0x20, 0x44, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x27, 0x73, 0x20, 0x65, 0x72, 0x72,
-0x6F, 0x72, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x0D, 0x0A, 0x7D, 0x0D, 0x0A,
-0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69,
-0x70, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E,
-0x0D, 0x0A
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xAD, 0x57, 0xFB, 0x6F, 0xDB, 0x36, 0x10, 0xFE, 0x3D, 0x40, 0xFE,
+0x07, 0x56, 0xEB, 0x60, 0x1B, 0x8B, 0xA4, 0xA4, 0x6D, 0xBA, 0xBC, 0x6C, 0xAC, 0x6D, 0xBA, 0x75, 0x6D, 0x93, 0x14, 0x89, 0xFB,
+0xC8, 0x86, 0x6D, 0xA0, 0xA5, 0xB3, 0xC4, 0x84, 0x22, 0x59, 0x92, 0xB2, 0xAD, 0x6E, 0xF9, 0xDF, 0x77, 0xA4, 0x24, 0xBF, 0x92,
+0x00, 0xDD, 0x23, 0x40, 0x2C, 0xEB, 0x78, 0xF7, 0xDD, 0x77, 0x0F, 0x1E, 0xE9, 0xA3, 0x07, 0xC7, 0x67, 0x2F, 0x86, 0x97, 0xEF,
+0x5E, 0x92, 0xDC, 0x16, 0x7C, 0xB0, 0xB9, 0x71, 0xE4, 0x9E, 0x84, 0x53, 0x91, 0xF5, 0x03, 0x10, 0x81, 0x97, 0x00, 0x4D, 0xDD,
+0x93, 0x33, 0x71, 0x4D, 0x34, 0xF0, 0x7E, 0x60, 0x6C, 0xC5, 0xC1, 0xE4, 0x00, 0x36, 0x20, 0xB9, 0x86, 0x71, 0x3F, 0xC8, 0xAD,
+0x55, 0xE6, 0x20, 0x8E, 0x93, 0x54, 0x44, 0x57, 0x26, 0x05, 0xCE, 0x26, 0x3A, 0x12, 0x60, 0x63, 0xA1, 0x8A, 0x78, 0x24, 0xA5,
+0x35, 0x56, 0x53, 0xF5, 0xC3, 0xE3, 0xE8, 0x49, 0xB4, 0x13, 0xA7, 0xCC, 0xD8, 0x38, 0x31, 0x66, 0xB1, 0x10, 0x15, 0x4C, 0x44,
+0x28, 0x09, 0x08, 0x13, 0x16, 0x32, 0xCD, 0x6C, 0x85, 0x5E, 0x72, 0xFA, 0x78, 0xEF, 0x49, 0xF8, 0xEA, 0xE2, 0x64, 0x96, 0x9C,
+0x0F, 0xCF, 0x67, 0xE2, 0xF4, 0xBB, 0xE7, 0x69, 0xB6, 0xFD, 0x3A, 0x1D, 0xCD, 0x2E, 0xDF, 0xE8, 0x61, 0x0E, 0xC9, 0xD9, 0x9B,
+0xF2, 0xD5, 0xEE, 0x97, 0x17, 0x97, 0xD2, 0xF2, 0x8B, 0x67, 0x89, 0xDA, 0xF9, 0x2E, 0xD9, 0x9B, 0x15, 0xD5, 0x10, 0xF6, 0x7F,
+0xBA, 0xCC, 0x76, 0xF8, 0x3E, 0x7D, 0xBA, 0xAF, 0x4C, 0x19, 0x90, 0x44, 0x4B, 0x63, 0xA4, 0x66, 0x19, 0x13, 0xFD, 0x80, 0x0A,
+0x29, 0xAA, 0x42, 0x96, 0xC6, 0xC7, 0x66, 0x12, 0xCD, 0x94, 0x25, 0x46, 0x27, 0x8B, 0x18, 0xE8, 0x15, 0x9D, 0x45, 0x99, 0x94,
+0x19, 0x07, 0xAA, 0x98, 0x89, 0x12, 0x59, 0x78, 0x59, 0xCC, 0xD9, 0xC8, 0xC4, 0x57, 0x9F, 0x4B, 0xD0, 0x55, 0xFC, 0x38, 0xFA,
+0x1E, 0x23, 0xA9, 0x5F, 0x3C, 0xFB, 0x2B, 0x04, 0x3C, 0x8A, 0x6B, 0xBC, 0xFB, 0x90, 0xBF, 0x3E, 0x3B, 0x57, 0xEB, 0xC9, 0xB9,
+0xBA, 0x33, 0x37, 0xF4, 0xF5, 0xA3, 0x9D, 0xB3, 0x2B, 0x7E, 0xF2, 0xE9, 0xF4, 0xED, 0xEE, 0xFB, 0xEA, 0x67, 0x1E, 0x7F, 0x3A,
+0x9D, 0x0E, 0x4F, 0x3E, 0x4F, 0xBE, 0xC0, 0xF9, 0xC9, 0x2F, 0xAF, 0x1E, 0x4D, 0xF7, 0x92, 0xDD, 0xE4, 0xFC, 0x83, 0xFA, 0xA2,
+0xDE, 0xEF, 0x5D, 0xEE, 0x8E, 0x9E, 0xA9, 0xA1, 0x52, 0x17, 0xE5, 0xFB, 0xEB, 0xFC, 0x97, 0x4F, 0xA7, 0xDB, 0x1F, 0x66, 0xAF,
+0xD2, 0xFB, 0x73, 0xB3, 0x1C, 0x4A, 0x01, 0x96, 0x92, 0x24, 0xA7, 0xDA, 0x80, 0xED, 0x07, 0xEF, 0x87, 0x3F, 0x86, 0x7B, 0xC1,
+0x5C, 0x2E, 0x68, 0x01, 0xFD, 0x60, 0xC2, 0x60, 0xAA, 0xA4, 0xC6, 0x7E, 0x48, 0x24, 0xB2, 0x14, 0xA8, 0x57, 0x1A, 0xD0, 0xA1,
+0x49, 0x28, 0xA7, 0x23, 0x0E, 0x7D, 0x21, 0xB7, 0x90, 0x3F, 0xB3, 0x8C, 0x72, 0x2F, 0x84, 0xFE, 0xCE, 0x16, 0x29, 0xE8, 0x8C,
+0x15, 0x65, 0xB1, 0x24, 0x40, 0x95, 0x15, 0xC1, 0x94, 0xA5, 0x36, 0xEF, 0xA7, 0x30, 0x61, 0x09, 0x84, 0xFE, 0x65, 0xDD, 0x33,
+0x55, 0x8A, 0x43, 0x58, 0xC8, 0x11, 0xC3, 0xC7, 0x14, 0x46, 0x21, 0x0A, 0xC2, 0x84, 0x2A, 0xE7, 0x75, 0x89, 0x4D, 0x05, 0x98,
+0xC0, 0xF8, 0x6B, 0x6C, 0x8D, 0xA5, 0xB6, 0x34, 0xE1, 0x88, 0x22, 0x7B, 0xD7, 0xE7, 0x4B, 0x20, 0x29, 0x8C, 0x69, 0xC9, 0x6D,
+0x03, 0xB4, 0xD8, 0x0F, 0x35, 0x8E, 0x95, 0x65, 0x92, 0x87, 0x0C, 0xB5, 0xDB, 0x5D, 0x31, 0xA6, 0x13, 0xF7, 0x1A, 0x29, 0x91,
+0x05, 0xAB, 0x16, 0xF7, 0x69, 0x11, 0x5B, 0x29, 0x24, 0xC6, 0x0A, 0x9A, 0x41, 0xEC, 0x05, 0xDE, 0x95, 0x65, 0x96, 0xC3, 0x60,
+0xC8, 0x44, 0x45, 0x8E, 0x41, 0x51, 0x6D, 0x4B, 0x0D, 0x86, 0x3C, 0x97, 0x54, 0xA7, 0x47, 0x71, 0xBD, 0x88, 0x5A, 0x71, 0xBB,
+0x53, 0x47, 0x32, 0xAD, 0xDC, 0x33, 0x65, 0x13, 0xE2, 0x63, 0xE8, 0x07, 0x3E, 0x77, 0x07, 0x2E, 0xC1, 0xDD, 0xFD, 0xED, 0x6F,
+0xB7, 0xC8, 0xEE, 0xF6, 0xB6, 0x9A, 0xF5, 0x0E, 0xB1, 0x04, 0x1A, 0x4B, 0x7F, 0x40, 0xB6, 0x09, 0x2D, 0xAD, 0x3C, 0x24, 0x8A,
+0xA6, 0x29, 0x13, 0x99, 0x13, 0xEC, 0xA0, 0xC6, 0xA1, 0xE7, 0x3D, 0x96, 0xBA, 0x20, 0x2C, 0x45, 0xAA, 0xF8, 0x05, 0x9B, 0xC0,
+0xA2, 0x46, 0xBD, 0x7F, 0xC6, 0x0C, 0x78, 0x8A, 0x12, 0x1F, 0x1D, 0x64, 0x20, 0xD2, 0xD6, 0xA1, 0x85, 0x99, 0x0D, 0x29, 0x67,
+0x19, 0x82, 0x27, 0x98, 0x3D, 0xD0, 0x88, 0xB5, 0x4E, 0x9E, 0x5C, 0x80, 0x2D, 0xD5, 0x51, 0x5C, 0x9B, 0xB6, 0x94, 0x13, 0x4E,
+0x8D, 0xA9, 0x9D, 0x85, 0x99, 0x96, 0xA5, 0xAA, 0x93, 0x47, 0x47, 0xC0, 0xDB, 0x35, 0x57, 0x12, 0x2D, 0x79, 0xE8, 0x85, 0x01,
+0x41, 0xD5, 0x7E, 0x20, 0xF4, 0x1B, 0xA8, 0x82, 0xC1, 0x29, 0xB5, 0x4C, 0x0A, 0xCA, 0xC9, 0x39, 0x65, 0x9C, 0x0C, 0xE5, 0x35,
+0x08, 0x74, 0xE0, 0xF4, 0x1C, 0x0A, 0x13, 0xAA, 0xB4, 0x3E, 0x96, 0x5A, 0xBD, 0x49, 0xB8, 0x63, 0x1B, 0x10, 0xC5, 0x69, 0x02,
+0xB9, 0xE4, 0x29, 0x20, 0xDC, 0x99, 0xAA, 0x71, 0x78, 0xB5, 0x45, 0x3C, 0x7F, 0x52, 0xC9, 0x52, 0x93, 0xC7, 0x4F, 0xFD, 0x56,
+0xA0, 0x89, 0x93, 0x58, 0x87, 0x1E, 0xAC, 0x10, 0x6E, 0x98, 0x11, 0xEF, 0x28, 0x2C, 0xD2, 0x7A, 0xCC, 0x28, 0x2A, 0x5A, 0xAD,
+0x1C, 0xB8, 0x0A, 0x47, 0x5C, 0x26, 0xD7, 0xC1, 0xE0, 0x52, 0x96, 0xD8, 0xE2, 0x9C, 0x13, 0x01, 0x90, 0x12, 0x4A, 0x56, 0xB9,
+0xBF, 0x14, 0x9F, 0x4B, 0xA6, 0x19, 0x26, 0xEB, 0x98, 0xEA, 0x29, 0x13, 0xE4, 0x2D, 0xB3, 0x40, 0x3E, 0xC2, 0x08, 0x77, 0x96,
+0xDB, 0x10, 0xB5, 0x7B, 0xC2, 0xC6, 0x8E, 0x19, 0xE2, 0x98, 0x1C, 0x25, 0x04, 0xE7, 0x07, 0xC6, 0x51, 0xAD, 0x61, 0xA5, 0xF3,
+0xCC, 0x47, 0x88, 0xEB, 0xB9, 0xE7, 0x2D, 0x00, 0xCC, 0x30, 0x1A, 0x5E, 0x11, 0x6A, 0xB0, 0x39, 0x13, 0x60, 0x13, 0xE4, 0xD2,
+0x45, 0x77, 0x4E, 0xC3, 0xC5, 0x44, 0x2D, 0x11, 0xCD, 0x5F, 0x78, 0xC7, 0x47, 0xFB, 0xD7, 0x8B, 0x88, 0x8B, 0x27, 0xC1, 0x50,
+0x35, 0x64, 0x38, 0xC5, 0xD0, 0x09, 0x9A, 0x63, 0x58, 0xB5, 0x9B, 0xB1, 0x06, 0x20, 0x72, 0xEC, 0xD3, 0x97, 0x01, 0x39, 0xA2,
+0x6B, 0x67, 0x87, 0x06, 0xCA, 0x2D, 0x2B, 0x20, 0x12, 0x0D, 0x73, 0x8D, 0xC4, 0x71, 0xFA, 0x46, 0xE5, 0x75, 0x7C, 0xA6, 0x40,
+0xBC, 0x3D, 0x7E, 0xFE, 0xF1, 0xE2, 0xDC, 0x23, 0x6B, 0xAF, 0x81, 0xC5, 0x73, 0x48, 0xB8, 0x31, 0xFF, 0x18, 0xE1, 0x89, 0x85,
+0xF9, 0xCC, 0x41, 0xC3, 0x51, 0x4C, 0x07, 0x11, 0x8E, 0x2F, 0x4C, 0xB9, 0xDF, 0x14, 0xD8, 0x51, 0xFF, 0xB1, 0xB1, 0xE4, 0xB4,
+0xF0, 0x9D, 0xE5, 0x48, 0x7C, 0x04, 0x8A, 0x69, 0xD1, 0xE4, 0x84, 0x2A, 0xF2, 0xEC, 0xDD, 0xCF, 0x04, 0x17, 0xEE, 0xEC, 0xAE,
+0xC6, 0xE6, 0x1F, 0xB7, 0x97, 0xC3, 0xBC, 0x76, 0x86, 0xFF, 0xBA, 0xA7, 0x5E, 0x2E, 0xC0, 0x24, 0x12, 0x9E, 0xD6, 0x84, 0x0B,
+0x3C, 0x47, 0xA4, 0xCE, 0x08, 0x9E, 0x68, 0x0E, 0xFF, 0xBE, 0xA6, 0x71, 0xC3, 0x0F, 0x69, 0x91, 0xC6, 0x0A, 0x3D, 0xD6, 0x0D,
+0x80, 0xB2, 0x7B, 0xAB, 0xEB, 0xEB, 0xDA, 0xE2, 0xDE, 0xAA, 0x6A, 0x2E, 0xB1, 0xA2, 0xB7, 0x89, 0xC4, 0xEE, 0x78, 0x30, 0xB1,
+0xC1, 0xF9, 0xF0, 0x07, 0xD6, 0xE1, 0xFF, 0xA9, 0xE4, 0xD2, 0x8A, 0x96, 0xD3, 0x75, 0x51, 0x82, 0x65, 0x9D, 0x99, 0xF0, 0x29,
+0xF1, 0xA3, 0xA9, 0x9E, 0x49, 0x5E, 0x67, 0x54, 0x5A, 0x8B, 0x31, 0xBB, 0xB2, 0x19, 0x3A, 0xC1, 0x81, 0x5F, 0x9F, 0x0E, 0xF5,
+0xF7, 0xC6, 0x78, 0x64, 0x05, 0xC1, 0xFF, 0x50, 0x69, 0x9C, 0xCD, 0x7A, 0x5E, 0xD8, 0xDA, 0x34, 0x18, 0x5C, 0xA0, 0xEE, 0x51,
+0x5C, 0xBF, 0xDD, 0xC3, 0xF5, 0x6B, 0xDC, 0x63, 0x76, 0x13, 0xD7, 0x76, 0x35, 0x81, 0xF6, 0x6D, 0x8D, 0xC2, 0xFC, 0x14, 0x5A,
+0xA1, 0xE0, 0x4A, 0xE8, 0xCE, 0xBC, 0x74, 0xF0, 0xC2, 0x9B, 0xDD, 0xC5, 0xE6, 0xD6, 0x73, 0x79, 0x7C, 0xC7, 0x2E, 0x99, 0xCB,
+0xAB, 0xF3, 0x0B, 0xC0, 0xC3, 0x6E, 0x2A, 0x93, 0xB2, 0x40, 0xC6, 0xBD, 0x08, 0x37, 0x69, 0x5A, 0x75, 0xC7, 0xA5, 0x48, 0x5C,
+0x4F, 0x74, 0x7B, 0xE4, 0xCF, 0xCD, 0x0D, 0x6C, 0x4F, 0x83, 0x23, 0xC2, 0xCD, 0xD3, 0x77, 0xD4, 0x62, 0x58, 0x82, 0xF4, 0x49,
+0xFC, 0xFB, 0xAF, 0x34, 0x1C, 0x6F, 0x87, 0xFB, 0xBF, 0xFD, 0xB9, 0x77, 0x13, 0xCE, 0xBF, 0x3F, 0xF9, 0x8A, 0xEF, 0x3B, 0x8F,
+0x6E, 0x1E, 0xC6, 0x87, 0x9B, 0x1B, 0xAD, 0x17, 0x32, 0xC1, 0x73, 0x24, 0xA5, 0x16, 0xD0, 0x81, 0x59, 0x75, 0xF9, 0x01, 0xE7,
+0x1B, 0x3A, 0x7B, 0xD8, 0xED, 0x7C, 0xE3, 0xFD, 0x77, 0x7A, 0x11, 0x2A, 0x77, 0x7B, 0x91, 0xC5, 0x3A, 0x75, 0x7B, 0x87, 0x0B,
+0x4D, 0xBF, 0x2D, 0x70, 0xB0, 0xA1, 0xB6, 0x37, 0x8B, 0x38, 0x88, 0xCC, 0xE6, 0x64, 0x40, 0xB6, 0xE7, 0x5A, 0x20, 0x5C, 0x06,
+0x5D, 0x2D, 0x51, 0xEB, 0xC1, 0xC2, 0xE6, 0xAF, 0xBF, 0x56, 0xA2, 0x8B, 0x2C, 0x18, 0xDB, 0xF5, 0x28, 0xCE, 0x83, 0x73, 0xEE,
+0x7A, 0x05, 0x7D, 0x2B, 0x2D, 0x55, 0xB7, 0xD3, 0x56, 0xA2, 0xB3, 0x45, 0x1E, 0x2C, 0x20, 0x9D, 0xEA, 0xCD, 0xE6, 0x46, 0x1C,
+0x93, 0xB7, 0x92, 0xE2, 0x31, 0x49, 0xDD, 0x98, 0x6D, 0xB6, 0xBB, 0x41, 0x94, 0x08, 0xFB, 0xFF, 0xF5, 0xC5, 0xD9, 0x69, 0xB7,
+0x13, 0xE3, 0x66, 0x72, 0x42, 0xBC, 0xF4, 0x49, 0x81, 0x20, 0xF3, 0x3C, 0x74, 0x31, 0x09, 0xD4, 0xC7, 0x8F, 0xDB, 0xD7, 0xBF,
+0x44, 0x42, 0xFB, 0x13, 0xCE, 0x0B, 0xD7, 0xB3, 0xB0, 0xA2, 0x50, 0x7B, 0x9F, 0xDB, 0xE1, 0x7C, 0x5A, 0x35, 0xAC, 0x07, 0xD6,
+0xB2, 0xE5, 0x5C, 0x65, 0x4E, 0xFC, 0x43, 0x53, 0x07, 0x42, 0xC7, 0x6E, 0xFB, 0x73, 0x8C, 0x03, 0x6F, 0x02, 0x9B, 0x1B, 0xAB,
+0xF5, 0x69, 0x52, 0x52, 0x77, 0xEF, 0x5D, 0x49, 0x19, 0x53, 0x6E, 0xEA, 0x74, 0xB8, 0x8F, 0x65, 0x5C, 0xB7, 0x0D, 0xDC, 0x8C,
+0x5B, 0x8D, 0x05, 0xFB, 0xAC, 0xE3, 0xC5, 0x2B, 0xB9, 0xF0, 0xCC, 0x6F, 0x79, 0xBE, 0xB9, 0xE5, 0x3E, 0xE1, 0x2C, 0xB9, 0xEE,
+0xA2, 0x7A, 0x7F, 0x80, 0x8C, 0x93, 0x7A, 0x96, 0x69, 0xF0, 0xC3, 0xB8, 0x1B, 0xC4, 0x41, 0x6F, 0xAD, 0x86, 0xB5, 0xFE, 0x9A,
+0x9F, 0xB6, 0x8B, 0x7C, 0x42, 0xEE, 0x6A, 0xB8, 0x79, 0x0F, 0xB5, 0x59, 0x6B, 0x94, 0x56, 0xD2, 0xBA, 0xD0, 0x52, 0xB4, 0x72,
+0xD9, 0x43, 0x25, 0x04, 0x6F, 0x60, 0x0F, 0x5A, 0xFC, 0xAD, 0xCD, 0x8D, 0x16, 0xE5, 0x60, 0x8E, 0x87, 0xA1, 0x39, 0x9E, 0x91,
+0xFB, 0x25, 0xD2, 0x45, 0xA3, 0x52, 0xF3, 0x03, 0xD2, 0x89, 0x1D, 0x69, 0xD7, 0x2B, 0x1D, 0x34, 0x72, 0xF3, 0x00, 0x65, 0xEF,
+0xCE, 0x2E, 0x86, 0xEE, 0xB5, 0xB9, 0xB6, 0x0E, 0x6B, 0xA9, 0xBB, 0xA3, 0xB2, 0x3A, 0xFA, 0xB8, 0xEE, 0xAB, 0xCD, 0x0D, 0x57,
+0xE6, 0x03, 0xE2, 0x9A, 0x2E, 0xC2, 0x33, 0x15, 0x4B, 0xC9, 0xC6, 0x55, 0xB7, 0xA1, 0xD6, 0xC3, 0x75, 0x53, 0x26, 0x09, 0x18,
+0x73, 0xB0, 0x94, 0x75, 0xBC, 0x40, 0x28, 0x8C, 0x00, 0x7C, 0x56, 0xF0, 0x92, 0xAE, 0xED, 0x42, 0x74, 0x48, 0xB0, 0x96, 0xC7,
+0xED, 0x49, 0x82, 0x77, 0x14, 0xD0, 0x1D, 0x43, 0x1A, 0x10, 0xD2, 0xAA, 0xF9, 0xF9, 0xB7, 0xB9, 0x71, 0x67, 0x29, 0x5C, 0x01,
+0xD1, 0x2F, 0x68, 0x2D, 0xF5, 0xB2, 0xD7, 0x59, 0xAE, 0xB7, 0x48, 0x7D, 0x31, 0xC7, 0xD3, 0xD2, 0xAD, 0x2E, 0xF9, 0xC7, 0xC5,
+0xA8, 0x05, 0x1F, 0x22, 0xF6, 0x3D, 0x3C, 0xBC, 0xD9, 0x3A, 0x8B, 0x9B, 0xA6, 0x63, 0x16, 0x1F, 0xCB, 0x3F, 0x7C, 0xE2, 0xF6,
+0x22, 0x1D, 0x37, 0xBF, 0x8E, 0xFF, 0x06, 0x4B, 0x7E, 0x8A, 0xC8, 0x2F, 0x0F, 0x00, 0x00
 };
\ No newline at end of file
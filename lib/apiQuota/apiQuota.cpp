@@ -0,0 +1,191 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * API Quota Library - per-API token bucket budgets and request counters (persisted to LittleFS)
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <apiQuota.h>
+#include <LittleFS.h>
+#include <ArduinoJson.h>
+#include <time.h>
+
+static const char* apiNames[QUOTA_APIS] = { "rail", "bus", "weather", "github", "picker" };
+static const unsigned int defaultBudgets[QUOTA_APIS] = { 120, 120, 40, 30, 120 };   // Requests per hour
+
+apiQuota quota;
+
+apiQuota::apiQuota() {
+    memset(budgets, 0, sizeof(budgets));
+    for (int i=0;i<QUOTA_APIS;i++) setHourlyBudget(i, defaultBudgets[i]);
+}
+
+//
+// Set the sustained budget for an API. The bucket allows a burst of a quarter of the hourly budget.
+//
+void apiQuota::setHourlyBudget(int api, unsigned int perHour) {
+    if (api < 0 || api >= QUOTA_APIS || !perHour) return;
+    budgets[api].perHour = perHour;
+    budgets[api].capacity = (perHour >= 20) ? perHour / 4.0 : 5.0;
+    budgets[api].tokens = budgets[api].capacity;
+    budgets[api].lastRefill = millis();
+}
+
+// Hours since the epoch once the clock is set, otherwise hours since boot
+unsigned long apiQuota::hourNumber() {
+    time_t now = time(nullptr);
+    if (now > 1700000000) return (unsigned long)(now / 3600);
+    return millis() / 3600000UL;
+}
+
+//
+// Move the rolling hourly counters on to the current hour, clearing any hours that have passed
+//
+void apiQuota::advanceHours() {
+    unsigned long hour = hourNumber();
+    if (hour == currentHour) return;
+    if (hour < currentHour) {
+        // Clock has changed source (boot time to real time), start the current slot afresh
+        currentHour = hour;
+        return;
+    }
+    unsigned long steps = hour - currentHour;
+    for (int i=0;i<QUOTA_APIS;i++) {
+        for (unsigned long s=0;s<steps && s<QUOTA_HOURS;s++) {
+            budgets[i].hourly[(currentHour + s + 1) % QUOTA_HOURS] = 0;
+        }
+    }
+    currentHour = hour;
+}
+
+void apiQuota::refill(apiBudget *b) {
+    unsigned long now = millis();
+    b->tokens += ((now - b->lastRefill) * (float)b->perHour) / 3600000.0;
+    if (b->tokens > b->capacity) b->tokens = b->capacity;
+    b->lastRefill = now;
+}
+
+//
+// Record a request to an API. Returns false if the budget was already used up (the request is still counted).
+//
+bool apiQuota::consume(int api) {
+    if (api < 0 || api >= QUOTA_APIS) return true;
+    apiBudget *b = &budgets[api];
+    refill(b);
+    advanceHours();
+    b->total++;
+    if (b->hourly[currentHour % QUOTA_HOURS] < UINT16_MAX) b->hourly[currentHour % QUOTA_HOURS]++;
+    dirty = true;
+    if (b->tokens >= 1.0) {
+        b->tokens -= 1.0;
+        return true;
+    }
+    b->throttled++;
+    return false;
+}
+
+// Fraction of the bucket remaining (0-1)
+float apiQuota::remaining(int api) {
+    if (api < 0 || api >= QUOTA_APIS) return 1.0;
+    refill(&budgets[api]);
+    return budgets[api].tokens / budgets[api].capacity;
+}
+
+//
+// Lengthen a refresh interval when the budget is tight. Below QUOTA_TIGHT the interval is stretched to the sustainable
+// rate for the budget, and to twice that once the bucket is empty.
+//
+unsigned long apiQuota::stretch(int api, unsigned long interval) {
+    if (api < 0 || api >= QUOTA_APIS) return interval;
+    float level = remaining(api);
+    if (level >= QUOTA_TIGHT) return interval;
+    unsigned long sustainable = 3600000UL / budgets[api].perHour;
+    if (level < 1.0 / budgets[api].capacity) sustainable *= 2;
+    return (interval > sustainable) ? interval : sustainable;
+}
+
+unsigned long apiQuota::last24Hours(int api) {
+    if (api < 0 || api >= QUOTA_APIS) return 0;
+    advanceHours();
+    unsigned long count = 0;
+    for (int i=0;i<QUOTA_HOURS;i++) count += budgets[api].hourly[i];
+    return count;
+}
+
+//
+// Load the counters saved by a previous session. Call once the clock has been set so the hourly counters line up.
+//
+void apiQuota::load() {
+    if (!LittleFS.exists(F(QUOTA_FILE))) return;
+    File file = LittleFS.open(F(QUOTA_FILE), "r");
+    if (!file) return;
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+    if (error) return;
+
+    unsigned long savedHour = doc[F("hour")].as<unsigned long>();
+    currentHour = hourNumber();
+    for (int i=0;i<QUOTA_APIS;i++) {
+        JsonObject api = doc[apiNames[i]];
+        if (api.isNull()) continue;
+        // Add to (rather than replace) any requests already made this session
+        budgets[i].total += api[F("total")].as<unsigned long>();
+        budgets[i].throttled += api[F("throttled")].as<unsigned long>();
+        // Only restore the hourly counters if they're still within the window
+        JsonArray hourly = api[F("hourly")];
+        if (savedHour <= currentHour && currentHour - savedHour < QUOTA_HOURS && hourly.size() == QUOTA_HOURS) {
+            for (int h=0;h<QUOTA_HOURS && h<=(int)savedHour;h++) {
+                unsigned long slotHour = savedHour - h;
+                if (currentHour - slotHour < QUOTA_HOURS) budgets[i].hourly[slotHour % QUOTA_HOURS] += hourly[h].as<uint16_t>();
+            }
+        }
+    }
+}
+
+//
+// Save the counters (at most every QUOTA_SAVEINTERVAL unless forced, to limit flash wear)
+//
+void apiQuota::save(bool force) {
+    if (!dirty || (!force && lastSave && millis() - lastSave < QUOTA_SAVEINTERVAL)) return;
+    advanceHours();
+    JsonDocument doc;
+    doc[F("hour")] = currentHour;
+    for (int i=0;i<QUOTA_APIS;i++) {
+        JsonObject api = doc[apiNames[i]].to<JsonObject>();
+        api[F("total")] = budgets[i].total;
+        api[F("throttled")] = budgets[i].throttled;
+        JsonArray hourly = api[F("hourly")].to<JsonArray>();
+        for (int h=0;h<QUOTA_HOURS;h++) hourly.add((h<=(int)currentHour) ? budgets[i].hourly[(currentHour - h) % QUOTA_HOURS] : 0);   // Newest first
+    }
+    File file = LittleFS.open(F(QUOTA_FILE), "w");
+    if (!file) return;
+    serializeJson(doc, file);
+    file.close();
+    lastSave = millis();
+    dirty = false;
+}
+
+//
+// Counters and remaining budget for each API (used by /quota)
+//
+String apiQuota::getJson() {
+    JsonDocument doc;
+    for (int i=0;i<QUOTA_APIS;i++) {
+        JsonObject api = doc[apiNames[i]].to<JsonObject>();
+        api[F("budgetPerHour")] = budgets[i].perHour;
+        api[F("remaining")] = (int)(remaining(i) * budgets[i].capacity);
+        api[F("burst")] = (int)budgets[i].capacity;
+        api[F("lastHour")] = budgets[i].hourly[currentHour % QUOTA_HOURS];
+        api[F("last24Hours")] = last24Hours(i);
+        api[F("total")] = budgets[i].total;
+        api[F("throttled")] = budgets[i].throttled;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
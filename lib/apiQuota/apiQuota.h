@@ -0,0 +1,61 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * API Quota Library - per-API token bucket budgets and request counters (persisted to LittleFS)
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+
+// Upstream APIs
+#define QUOTA_RAIL 0
+#define QUOTA_BUS 1
+#define QUOTA_WEATHER 2
+#define QUOTA_GITHUB 3
+#define QUOTA_PICKER 4
+#define QUOTA_APIS 5
+
+#define QUOTA_HOURS 24                  // Rolling window of hourly counters
+#define QUOTA_TIGHT 0.5                 // Stretch intervals when less than this fraction of the bucket is left
+#define QUOTA_SAVEINTERVAL 600000UL     // Minimum time between saves to the file system (ms)
+#define QUOTA_FILE "/quota.json"
+
+class apiQuota {
+
+    private:
+        struct apiBudget {
+            unsigned int perHour;           // Sustained request budget
+            float capacity;                 // Bucket size (burst allowance)
+            float tokens;                   // Tokens currently in the bucket
+            unsigned long lastRefill;       // millis() of the last refill
+            unsigned long total;            // Requests since the counters were created
+            unsigned long throttled;        // Requests made with an empty bucket
+            uint16_t hourly[QUOTA_HOURS];   // Requests per hour, rolling
+        };
+
+        apiBudget budgets[QUOTA_APIS];
+        unsigned long currentHour = 0;      // Hour number of the newest hourly slot
+        unsigned long lastSave = 0;
+        bool dirty = false;
+
+        void refill(apiBudget *b);
+        void advanceHours();
+        unsigned long hourNumber();
+
+    public:
+        apiQuota();
+        void setHourlyBudget(int api, unsigned int perHour);
+        bool consume(int api);
+        float remaining(int api);
+        unsigned long stretch(int api, unsigned long interval);
+        unsigned long last24Hours(int api);
+        void load();
+        void save(bool force);
+        String getJson();
+};
+
+extern apiQuota quota;
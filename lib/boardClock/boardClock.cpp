@@ -0,0 +1,38 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Board Clock Library - the time source for the board loops, so their timing can be driven by a simulated clock
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <boardClock.h>
+
+hardwareClock systemClock;
+
+unsigned long hardwareClock::millis() {
+    return ::millis();
+}
+
+void hardwareClock::delay(unsigned long ms) {
+    ::delay(ms);
+}
+
+simulatedClock::simulatedClock(unsigned long start) {
+    now = start;
+}
+
+unsigned long simulatedClock::millis() {
+    return now;
+}
+
+void simulatedClock::delay(unsigned long ms) {
+    now += ms;
+}
+
+void simulatedClock::advance(unsigned long ms) {
+    now += ms;
+}
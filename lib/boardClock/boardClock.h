@@ -0,0 +1,40 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Board Clock Library - the time source for the board loops, so their timing can be driven by a simulated clock
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+
+class boardClock {
+    public:
+        virtual unsigned long millis() = 0;
+        virtual void delay(unsigned long ms) = 0;
+};
+
+// The Arduino core's millis() and delay()
+class hardwareClock : public boardClock {
+    public:
+        virtual unsigned long millis();
+        virtual void delay(unsigned long ms);
+};
+
+// A clock that only moves when delay() or advance() is called, to run the loops faster than real time
+class simulatedClock : public boardClock {
+
+    private:
+        unsigned long now;
+
+    public:
+        simulatedClock(unsigned long start = 0);
+        virtual unsigned long millis();
+        virtual void delay(unsigned long ms);
+        void advance(unsigned long ms);
+};
+
+extern hardwareClock systemClock;
@@ -10,24 +10,27 @@
  */
 
 #include <busDataClient.h>
-#include <JsonListener.h>
+#include <jsonListener.h>
 #include <WiFiClientSecure.h>
 #include <stationData.h>
+#include <perfMonitor.h>
+#include <requestBuilder.h>
+#include <socketUtils.h>
+#include <apiQuota.h>
+#include <algorithm>
+#include <time.h>
 
 busDataClient::busDataClient() {}
 
 //
-// Strip HTML tag from string
+// Override the default bustimes.org host (e.g. to use a local test server)
 //
-String busDataClient::stripTag(String html) {
-    String result = "";
-    int start = html.indexOf(">");
-    int end = html.indexOf("</");
-    if (start!=1 && end!=1 && end>start) {
-        result = html.substring(start+1,end);
-        result.trim();
-    }
-    return result;
+void busDataClient::setApiHost(const char *host) {
+    if (host && host[0]) apiHost = host;
+}
+
+const char *busDataClient::getHost() {
+    return apiHost;
 }
 
 //
@@ -53,114 +56,49 @@ void busDataClient::replaceWord(char* input, const char* target, const char* rep
     }
 }
 
-// Trim leading and trailing spaces in-place
-void busDataClient::trim(char* &start, char* &end) {
-  while (start <= end && isspace(*start)) start++;
-  while (end >= start && isspace(*end)) end--;
-}
-
-// Compare strings case-insensitively
-bool busDataClient::equalsIgnoreCase(const char* a, int a_len, const char* b) {
-  for (int i = 0; i < a_len; i++) {
-    if (tolower(a[i]) != tolower(b[i])) return false;
-  }
-  return b[a_len] == '\0';
-}
-
-// Check if the service is in the filter list (if there is one)
-bool busDataClient::serviceMatchesFilter(const char* filter, const char* serviceId) {
-  if (filter == nullptr || filter[0] == '\0') return true; // empty filter = match all
-
-  const char* start = filter;
-  const char* ptr = filter;
-
-  while (true) {
-    if (*ptr == ',' || *ptr == '\0') {
-      const char* end = ptr - 1;
-      char* trimStart = const_cast<char*>(start);
-      char* trimEnd   = const_cast<char*>(end);
-      trim(trimStart, trimEnd);
-      int len = trimEnd - trimStart + 1;
-      if (len > 0 && equalsIgnoreCase(trimStart, len, serviceId)) {
-        return true;
-      }
-      if (*ptr == '\0') break;
-      ptr++;
-      start = ptr;
-    } else {
-      ptr++;
-    }
-  }
-
-  return false;
-}
-
-void busDataClient::cleanFilter(const char* rawFilter, char* cleanedFilter, size_t maxLen) {
-    if (!rawFilter || rawFilter[0] == '\0') {
-        if (maxLen > 0) cleanedFilter[0] = '\0';
-        return;
-    }
-
-    size_t j = 0;
-    const char* ptr = rawFilter;
-
-    while (*ptr != '\0' && j < maxLen - 1) {
-        if (*ptr == ',') {
-            cleanedFilter[j++] = ',';
-            ptr++;
-            continue;
-        }
-        if (!isspace(*ptr)) {
-            cleanedFilter[j++] = tolower(*ptr);
-        }
-        ptr++;
-    }
-
-    cleanedFilter[j] = '\0';
-    return;
-}
-
-int busDataClient::updateDepartures(rdStation *station, const char *locationId, const char *filter, busClientCallback Xcb) {
-
-    unsigned long perfTimer=millis();
-    long dataReceived = 0;
-    bool bChunked = false;
-    lastErrorMsg = "";
-
-    WiFiClientSecure httpsClient;
+//
+// Connect to the API and send the departures request for one stop
+//
+int busDataClient::sendRequest(WiFiClientSecure &httpsClient, const char *locationId) {
     httpsClient.setInsecure();
     httpsClient.setTimeout(15000);
-    station->boardChanged=false;
 
-    int retryCounter=0;
-    while (!httpsClient.connect(apiHost,443) && (retryCounter++ < 15)){
-        delay(200);
-    }
-    if (retryCounter>=15) {
+    if (!socketConnect(httpsClient, apiHost, 443, 3000)) {
         lastErrorMsg = F("Connection timeout");
         return UPD_NO_RESPONSE;
     }
-    String request = "GET /stops/" + String(locationId) + F("/departures HTTP/1.0\r\nHost: ") + String(apiHost) + F("\r\nConnection: close\r\n\r\n");
-    httpsClient.print(request);
-    Xcb();
-    unsigned long ticker = millis()+800;
-    retryCounter=0;
-    while(!httpsClient.available() && retryCounter++ < 40) {
-        delay(200);
+    char requestBuffer[192];
+    requestBuilder request(requestBuffer,sizeof(requestBuffer));
+    request.add(F("GET /stops/")).addUrl(locationId).add(F("/departures HTTP/1.0\r\nHost: ")).add(apiHost).add(F("\r\nConnection: close\r\n\r\n"));
+    if (!request.send(httpsClient)) {
+        httpsClient.stop();
+        if (request.isValid()) {
+            lastErrorMsg = F("Request not sent");
+            return UPD_NO_RESPONSE;
+        }
+        lastErrorMsg = F("Request too large");
+        return UPD_DATA_ERROR;
     }
+    quota.consume(QUOTA_BUS);
+    perf.setSendTime(request.sendTime);
+    return UPD_SUCCESS;
+}
 
-    if (!httpsClient.available()) {
+//
+// Read one stop's departures page, adding up to MAXBOARDSERVICES matching services after those already read
+//
+int busDataClient::readResponse(WiFiClientSecure &httpsClient, const serviceFilter &filter, busClientCallback Xcb, bool firstResponse) {
+    unsigned long ticker = millis()+800;
+    if (!waitForData(httpsClient, 8000)) {
         // no response within 8 seconds so exit
-        httpsClient.stop();
         lastErrorMsg = F("Response timeout");
         return UPD_TIMEOUT;
     }
+    if (firstResponse) perf.firstByte();
 
     // Parse status code
     String statusLine = httpsClient.readStringUntil('\n');
     if (!statusLine.startsWith(F("HTTP/")) || statusLine.indexOf(F("200 OK")) == -1) {
-        httpsClient.stop();
-
         if (statusLine.indexOf(F("401")) > 0 || statusLine.indexOf(F("429")) > 0) {
             lastErrorMsg = F("Not Authorized");
             return UPD_UNAUTHORISED;
@@ -182,129 +120,336 @@ int busDataClient::updateDepartures(rdStation *station, const char *locationId,
 
     // Start scraping the data
     unsigned long dataSendTimeout = millis() + 10000UL;
-    id=0;
-    bool maxServicesRead = false;
-    xBusStop.numServices = 0;
-    for (int i=0;i<MAXBOARDSERVICES;i++) {
-        strcpy(xBusStop.service[i].destinationName,"Check front of bus");
-        strcpy(xBusStop.service[i].scheduled,"");
-        strcpy(xBusStop.service[i].expected,"");
-    }
-    int parseStep = PBT_START; // looking for the start of data
-    int dataColumns = 0;
-    bool serviceData;
-    String serviceId;
-    String destination;
-
-    while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout) && (!maxServicesRead)) {
-        while(httpsClient.available() && !maxServicesRead) {
-            String line = httpsClient.readStringUntil('\n');
-            dataReceived+=line.length()+1;
-            line.trim();
-            if (line.length()) {
-                if (line.indexOf("</body>")>=0) {
-                    // end of page
-                    maxServicesRead = true;
-                } else {
-                    switch (parseStep) {
-                        case PBT_START:
-                            if (line.indexOf("<tr>")>=0) parseStep = PBT_HEADER;
-                            break;
-
-                        case PBT_HEADER:
-                            if (line.indexOf("</tr>")>=0) {
-                                parseStep = PBT_SERVICE;
-                                serviceData = false;
-                            }
-                            else if (line.substring(0,1)=="<") dataColumns++;
-                            break;
-
-                        case PBT_SERVICE:
-                            if (line.indexOf("</table>")>=0) {
-                                // Assume another day of data with headers
-                                dataColumns=0;
-                                parseStep = PBT_START;
-                            }
-                            else if (line.indexOf("</td>")>=0) parseStep = PBT_DESTINATION;
-                            else if (line.substring(0,3)=="<td") serviceData = true;
-                            else if (line.substring(0,7)=="<a href" && serviceData) {
-                                // Get the service name from within the hyperlink
-                                serviceId = stripTag(line);
-                                strncpy(xBusStop.service[id].lineName,serviceId.c_str(),MAXBUSLINESIZE-1);
-                                xBusStop.service[id].lineName[MAXBUSLINESIZE-1] = '\0';
-                            } else {
-                                // must be a service Id without hyperlink
-                                serviceId = line;
-                                strncpy(xBusStop.service[id].lineName,serviceId.c_str(),MAXBUSLINESIZE-1);
-                                xBusStop.service[id].lineName[MAXBUSLINESIZE-1] = '\0';
-                            }
-                            break;
-
-                        case PBT_DESTINATION:
-                            if (line.indexOf("</td>")>=0) parseStep = PBT_SCHEDULED;
-                            else if (line.substring(0,1)!="<") {
-                                strncpy(xBusStop.service[id].destinationName,line.c_str(),MAXLOCATIONSIZE-1);
-                                xBusStop.service[id].destinationName[MAXLOCATIONSIZE-1] = '\0';
-                            }
-                            break;
-
-                        case PBT_SCHEDULED:
-                            if (line.indexOf("</td>")>=0) {
-                                if (dataColumns == 4) parseStep = PBT_EXPECTED; else {
-                                    strcpy(xBusStop.service[id].expected,"");
-                                    parseStep = PBT_HEADER;
-                                    if (serviceMatchesFilter(filter,xBusStop.service[id].lineName)) id++;
-                                    if (id>=MAXBOARDSERVICES) maxServicesRead=true;
-                                }
-                            } else if (line.substring(0,1)!="<") {
-                                strncpy(xBusStop.service[id].scheduled,line.c_str(),sizeof(xBusStop.service[id].scheduled));
-                                xBusStop.service[id].scheduled[sizeof(xBusStop.service[id].scheduled)-1] = '\0';
-                            }
-                            break;
-
-                        case PBT_EXPECTED:
-                            if (line.indexOf("</td>")>=0) {
-                                parseStep = PBT_HEADER;
-                                if (serviceMatchesFilter(filter,xBusStop.service[id].lineName)) id++;
-                                if (id>=MAXBOARDSERVICES) maxServicesRead=true;
-                            }
-                            else if (line.substring(0,1)!="<") {
-                                strncpy(xBusStop.service[id].expected,line.c_str(),sizeof(xBusStop.service[id].expected));
-                                xBusStop.service[id].expected[sizeof(xBusStop.service[id].expected)-1] = '\0';
-                            }
-                            break;
-                    }
-                }
-            }
+    maxId = id + MAXBOARDSERVICES;
+    if (maxId > BUSMAXREADSERVICES) maxId = BUSMAXREADSERVICES;
+    pageComplete = (id >= maxId);
+    rowFilter = &filter;
+    htmlState = HTS_TEXT;
+    skipRawText = false;
+    rowOpen = false;
+    parseStep = PBT_START;
+    uint8_t buffer[HTMLREADBUFFER];
+
+    while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout) && (!pageComplete)) {
+        unsigned long parseStart = micros();
+        int bytes;
+        while (!pageComplete && (bytes = httpsClient.available()) > 0) {
+            if (bytes > HTMLREADBUFFER) bytes = HTMLREADBUFFER;
+            bytes = httpsClient.read(buffer, bytes);
+            if (bytes <= 0) break;
+            dataReceived += bytes;
+            for (int i=0;i<bytes && !pageComplete;i++) htmlByte(buffer[i]);
             if (millis()>ticker) {
                 Xcb();
                 ticker = millis()+800;
             }
         }
+        parseTime += micros() - parseStart;
+        if (!pageComplete) waitForData(httpsClient, 100);
     }
 
-    httpsClient.stop();
     if (millis() >= dataSendTimeout) {
         lastErrorMsg = F("Timed out during msgs data receive operation");
         return UPD_TIMEOUT;
     }
+    return UPD_SUCCESS;
+}
+
+//
+// HTML tokenizer. Works a byte at a time so it doesn't matter how the page is split into lines or packets, and
+// passes tags and text to the departures table logic below without any heap allocations.
+//
+void busDataClient::htmlByte(char c) {
+    switch (htmlState) {
+        case HTS_TEXT:
+            if (c == '<') {
+                htmlState = HTS_TAGOPEN;
+                tagLength = 0;
+                closingTag = false;
+            } else if (!skipRawText) htmlText(c);
+            break;
+
+        case HTS_TAGOPEN:
+            if (c == '/' && !closingTag) closingTag = true;
+            else if (c == '!' && !closingTag) {
+                htmlState = HTS_DECLARATION;
+                declarationChars = 0;
+                commentDashes = 0;
+                inComment = false;
+            } else if (isalpha(c)) {
+                tagName[tagLength++] = tolower(c);
+                htmlState = HTS_TAGNAME;
+            } else {
+                // Not a tag after all
+                htmlState = HTS_TEXT;
+                if (!skipRawText) {
+                    htmlText('<');
+                    if (closingTag) htmlText('/');
+                    htmlText(c);
+                }
+            }
+            break;
+
+        case HTS_TAGNAME:
+            if (isalnum(c)) {
+                if (tagLength < MAXHTMLTAGSIZE-1) tagName[tagLength++] = tolower(c);
+            } else if (c == '>') {
+                htmlTag();
+                htmlState = HTS_TEXT;
+            } else {
+                attributeQuote = 0;
+                htmlState = HTS_ATTRIBUTES;
+            }
+            break;
+
+        case HTS_ATTRIBUTES:
+            if (attributeQuote) {
+                if (c == attributeQuote) attributeQuote = 0;
+            } else if (c == '"' || c == '\'') attributeQuote = c;
+            else if (c == '>') {
+                htmlTag();
+                htmlState = HTS_TEXT;
+            }
+            break;
+
+        case HTS_DECLARATION:
+            if (declarationChars < 2) {
+                // A comment starts with two dashes
+                if (c == '-') {
+                    if (++declarationChars == 2) inComment = true;
+                    break;
+                }
+                declarationChars = 2;
+            }
+            if (inComment) {
+                if (c == '-') commentDashes++;
+                else {
+                    if (c == '>' && commentDashes >= 2) htmlState = HTS_TEXT;
+                    commentDashes = 0;
+                }
+            } else if (c == '>') htmlState = HTS_TEXT;
+            break;
+    }
+}
+
+//
+// A complete start or end tag has been read
+//
+void busDataClient::htmlTag() {
+    tagName[tagLength] = '\0';
+    bool scriptTag = !strcmp(tagName,"script") || !strcmp(tagName,"style");
+    if (skipRawText) {
+        if (closingTag && scriptTag) skipRawText = false;
+        return;
+    }
+
+    if (!closingTag) {
+        if (scriptTag) skipRawText = true;
+        else if (!strcmp(tagName,"tr")) startRow();
+        else if (!strcmp(tagName,"td")) startCell(false);
+        else if (!strcmp(tagName,"th")) startCell(true);
+        else if (parseStep != PBT_START) {
+            // Inside a cell
+            if (!strcmp(tagName,"a")) inLink = true;
+            else if (!strcmp(tagName,"br")) htmlText(' ');
+            else if (strcmp(tagName,"img") && strcmp(tagName,"wbr") && strcmp(tagName,"hr") && strcmp(tagName,"input")) nestedTags++;
+        }
+    } else {
+        if (!strcmp(tagName,"body")) pageComplete = true;
+        else if (!strcmp(tagName,"td") || !strcmp(tagName,"th")) endCell();
+        else if (!strcmp(tagName,"tr") || !strcmp(tagName,"table")) endRow();
+        else if (parseStep != PBT_START) {
+            if (!strcmp(tagName,"a")) inLink = false;
+            else if (nestedTags) nestedTags--;
+        }
+    }
+}
+
+//
+// Text within a cell, with runs of white space reduced to a single space
+//
+void busDataClient::htmlText(char c) {
+    if (parseStep == PBT_START || parseStep == PBT_OTHER) return;
+    char *text = inLink ? linkText : (nestedTags ? nestedText : cellText);
+    int &length = inLink ? linkLength : (nestedTags ? nestedLength : cellLength);
+    if (isspace(c)) {
+        if (length) pendingSpace = true;
+        return;
+    }
+    if (pendingSpace && length && length < MAXLOCATIONSIZE-1) text[length++] = ' ';
+    pendingSpace = false;
+    if (length < MAXLOCATIONSIZE-1) text[length++] = c;
+}
+
+void busDataClient::startRow() {
+    if (rowOpen) endRow();     // The previous row wasn't closed
+    rowOpen = true;
+    rowCells = 0;
+    strcpy(xBusStop.service[id].lineName,"");
+    strcpy(xBusStop.service[id].destinationName,"Check front of bus");
+    strcpy(xBusStop.service[id].scheduled,"");
+    strcpy(xBusStop.service[id].expected,"");
+}
+
+//
+// Keep the row if it's a departure for a service that passes the filter
+//
+void busDataClient::endRow() {
+    if (parseStep != PBT_START) endCell();
+    if (!rowOpen) return;
+    rowOpen = false;
+    if (rowCells >= 3 && xBusStop.service[id].lineName[0] && rowFilter->matches(xBusStop.service[id].lineName)) {
+        id++;
+        if (id >= maxId) pageComplete = true;
+    }
+}
+
+void busDataClient::startCell(bool header) {
+    if (parseStep != PBT_START) endCell();     // The previous cell wasn't closed
+    if (!rowOpen) startRow();
+    if (header) parseStep = PBT_HEADER;
+    else parseStep = (rowCells < PBT_OTHER-PBT_SERVICE) ? PBT_SERVICE + rowCells : PBT_OTHER;
+    cellLength = 0;
+    linkLength = 0;
+    nestedLength = 0;
+    nestedTags = 0;
+    inLink = false;
+    pendingSpace = false;
+}
+
+//
+// Store the text of a data cell in the column it belongs to. Text directly in the cell is used first, so a vehicle
+// link after the destination is ignored, then link text (the service number) and then text in other elements.
+//
+void busDataClient::endCell() {
+    if (parseStep == PBT_START) return;
+    cellText[cellLength] = '\0';
+    linkText[linkLength] = '\0';
+    nestedText[nestedLength] = '\0';
+    const char *text = cellLength ? cellText : (linkLength ? linkText : nestedText);
+    switch (parseStep) {
+        case PBT_SERVICE:
+            strlcpy(xBusStop.service[id].lineName,text,sizeof(xBusStop.service[0].lineName));
+            break;
+        case PBT_DESTINATION:
+            if (text[0]) strlcpy(xBusStop.service[id].destinationName,text,sizeof(xBusStop.service[0].destinationName));
+            break;
+        case PBT_SCHEDULED:
+            strlcpy(xBusStop.service[id].scheduled,text,sizeof(xBusStop.service[0].scheduled));
+            break;
+        case PBT_EXPECTED:
+            strlcpy(xBusStop.service[id].expected,text,sizeof(xBusStop.service[0].expected));
+            break;
+    }
+    if (parseStep != PBT_HEADER) rowCells++;
+    parseStep = PBT_START;
+}
+
+//
+// Minutes past midnight of the expected (or scheduled) time of a service, used to merge several stops
+//
+int busDataClient::departureMinutes(const busService &service) {
+    const char *time = service.expected[0] ? service.expected : service.scheduled;
+    if (strlen(time) != 5 || time[2] != ':') return 0;
+    return atoi(time) * 60 + atoi(time+3);
+}
+
+int busDataClient::updateDepartures(rdStation *station, const char *locationId, const serviceFilter &filter, busClientCallback Xcb) {
+    const char *locationIds[1] = { locationId };
+    return updateDepartures(station, locationIds, 1, filter, Xcb);
+}
+
+//
+// Update the board from one or more stops. The requests are all sent before any responses are read (memory
+// permitting) so the server handles them at the same time, then the services are merged in time order.
+//
+int busDataClient::updateDepartures(rdStation *station, const char *locationIds[], int numLocations, const serviceFilter &filter, busClientCallback Xcb) {
+
+    unsigned long perfTimer=millis();
+    dataReceived = 0;
+    parseTime = 0;      // Time spent reading and scraping (us), excludes waiting for data
+    bChunked = false;
+    lastErrorMsg = "";
+    if (numLocations > BUSMAXSTOPS) numLocations = BUSMAXSTOPS;
+    if (numLocations < 1) {
+        lastErrorMsg = F("No bus stop");
+        return UPD_DATA_ERROR;
+    }
+
+    perf.begin(PERF_BUS);
+    station->boardChanged=false;
+    station->changedRows=0;
+    station->changedTimes=0;
+
+    id=0;
+    xBusStop.numServices = 0;
+    for (int i=0;i<BUSMAXREADSERVICES;i++) {
+        strcpy(xBusStop.service[i].destinationName,"Check front of bus");
+        strcpy(xBusStop.service[i].scheduled,"");
+        strcpy(xBusStop.service[i].expected,"");
+    }
+
+    WiFiClientSecure httpsClient[BUSMAXSTOPS];
+    int requested = 0;
+    for (int i=0;i<numLocations;i++) {
+        // Start the requests that haven't been sent yet, always this stop's and others while there's room for another connection
+        while (requested < numLocations && (requested <= i || ESP.getMaxAllocHeap() >= BUSMINCONNHEAP)) {
+            int result = sendRequest(httpsClient[requested], locationIds[requested]);
+            if (result != UPD_SUCCESS) {
+                for (int j=i;j<requested;j++) httpsClient[j].stop();
+                return result;
+            }
+            if (!requested) perf.sample(PERF_HANDSHAKE);
+            requested++;
+        }
+        if (!i) Xcb();
+
+        int result = readResponse(httpsClient[i], filter, Xcb, i==0);
+        httpsClient[i].stop();
+        if (result != UPD_SUCCESS) {
+            for (int j=i+1;j<requested;j++) httpsClient[j].stop();
+            return result;
+        }
+    }
+    perf.sample(PERF_PARSED);
 
     xBusStop.numServices = id;
 
+    if (numLocations > 1) {
+        // Merge the stops by departure time. If the board spans midnight, the early morning times sort last.
+        bool lateEvening = false;
+        bool earlyMorning = false;
+        for (int i=0;i<xBusStop.numServices;i++) {
+            int minutes = departureMinutes(xBusStop.service[i]);
+            if (minutes >= 1260) lateEvening = true;
+            else if (minutes < 180) earlyMorning = true;
+        }
+        bool spansMidnight = lateEvening && earlyMorning;
+        std::stable_sort(xBusStop.service, xBusStop.service+xBusStop.numServices, [spansMidnight](const busService &a, const busService &b) {
+            int aMinutes = departureMinutes(a);
+            int bMinutes = departureMinutes(b);
+            if (spansMidnight) {
+                if (aMinutes < 720) aMinutes += 1440;
+                if (bMinutes < 720) bMinutes += 1440;
+            }
+            return aMinutes < bMinutes;
+        });
+        if (xBusStop.numServices > MAXBOARDSERVICES) xBusStop.numServices = MAXBOARDSERVICES;
+    }
+
     // Remove &amp; from destination name
     for (int i=0;i<xBusStop.numServices;i++) replaceWord(xBusStop.service[i].destinationName,"&amp;","&");
 
-    // Check if any of the services have changed
-    if (xBusStop.numServices != station->numServices) station->boardChanged=true;
-    else {
-        for (int i=0;i<xBusStop.numServices;i++) {
-            if (i>1) break; // Only check first two services
-            if (strcmp(xBusStop.service[i].destinationName,station->service[i].destination) || strcmp(xBusStop.service[i].lineName,station->service[i].via)) {
-                station->boardChanged=true;
-                break;
-            }
+    // Work out which rows of the board have changed, so only those need to be redrawn
+    int rows = (xBusStop.numServices > station->numServices) ? xBusStop.numServices : station->numServices;
+    for (int i=0;i<rows;i++) {
+        if (i >= xBusStop.numServices || i >= station->numServices || strcmp(xBusStop.service[i].lineName,station->service[i].via) || strcmp(xBusStop.service[i].destinationName,station->service[i].destination) || strcmp(xBusStop.service[i].scheduled,station->service[i].sTime)) {
+            station->changedRows |= (1 << i);
+        } else if (strcmp(xBusStop.service[i].expected,station->service[i].etd)) {
+            station->changedTimes |= (1 << i);
         }
     }
+    station->boardChanged = (station->changedRows || station->changedTimes);
 
     // Update the callers data with the new data
     station->numServices = xBusStop.numServices;
@@ -314,48 +459,54 @@ int busDataClient::updateDepartures(rdStation *station, const char *locationId,
         strcpy(station->service[i].sTime,xBusStop.service[i].scheduled);
         strcpy(station->service[i].etd,xBusStop.service[i].expected);
     }
+    perf.sample(PERF_COPIED);
 
     if (bChunked) lastErrorMsg = F("WARNING: Chunked response! ");
-    if (station->boardChanged) {
-        lastErrorMsg += F("SUCCESS [Primary Service Changed] Update took: ");
-        lastErrorMsg += String(millis() - perfTimer) + F("ms [") + String(dataReceived) + F("]");
-        return UPD_SUCCESS;
-    } else {
-        lastErrorMsg += F("SUCCESS Update took: ");
-        lastErrorMsg += String(millis() - perfTimer) + F("ms [") + String(dataReceived) + F("]");
-        return UPD_NO_CHANGE;
-    }
+    if (station->boardChanged) lastErrorMsg += F("SUCCESS [Services Changed] Update took: ");
+    else lastErrorMsg += F("SUCCESS Update took: ");
+    lastErrorMsg += String(millis() - perfTimer) + F("ms [") + String(dataReceived) + F("]");
+    if (numLocations > 1) lastErrorMsg += " from " + String(numLocations) + F(" stops, ") + String(requested) + F(" in parallel");
+    // Scraper throughput (bytes/s) for performance monitoring
+    lastErrorMsg += " (parse " + String(parseTime/1000) + F("ms");
+    if (parseTime) lastErrorMsg += ", " + String((unsigned long)((dataReceived * 1000000ULL) / parseTime)) + F(" bytes/s");
+    lastErrorMsg += F(")");
+    return station->boardChanged ? UPD_SUCCESS : UPD_NO_CHANGE;
 }
 
-int busDataClient::getStopLongName(const char *locationId, char *locationName) {
+//
+// Get the details of a stop (long name, indicator and location) from the bustimes.org stops API
+//
+int busDataClient::getStopInfo(const char *locationId, busStopInfo *info) {
 
     unsigned long perfTimer=millis();
     long dataReceived = 0;
     bool bChunked = false;
     lastErrorMsg = "";
 
-    JsonStreamingParser parser;
+    jsonStreamingParser parser;
     parser.setListener(this);
     WiFiClientSecure httpsClient;
     httpsClient.setInsecure();
     httpsClient.setTimeout(15000);
 
-    int retryCounter=0;
-    while (!httpsClient.connect(apiHost,443) && (retryCounter++ < 15)){
-        delay(200);
-    }
-    if (retryCounter>=15) {
+    if (!socketConnect(httpsClient, apiHost, 443, 3000)) {
         lastErrorMsg = F("Connection timeout");
         return UPD_NO_RESPONSE;
     }
-    String request = "GET /api/stops/" + String(locationId) + F(" HTTP/1.0\r\nHost: ") + String(apiHost) + F("\r\nConnection: close\r\n\r\n");
-    httpsClient.print(request);
-    retryCounter=0;
-    while(!httpsClient.available() && retryCounter++ < 40) {
-        delay(200);
+    char requestBuffer[192];
+    requestBuilder request(requestBuffer,sizeof(requestBuffer));
+    request.add(F("GET /api/stops/")).addUrl(locationId).add(F(" HTTP/1.0\r\nHost: ")).add(apiHost).add(F("\r\nConnection: close\r\n\r\n"));
+    if (!request.send(httpsClient)) {
+        httpsClient.stop();
+        if (request.isValid()) {
+            lastErrorMsg = F("Request not sent");
+            return UPD_NO_RESPONSE;
+        }
+        lastErrorMsg = F("Request too large");
+        return UPD_DATA_ERROR;
     }
-
-    if (!httpsClient.available()) {
+    quota.consume(QUOTA_BUS);
+    if (!waitForData(httpsClient, 8000)) {
         // no response within 8 seconds so exit
         httpsClient.stop();
         lastErrorMsg = F("Response timeout");
@@ -386,28 +537,31 @@ int busDataClient::getStopLongName(const char *locationId, char *locationName) {
         if (line.startsWith(F("Transfer-Encoding:")) && line.indexOf(F("chunked")) >= 0) bChunked=true;
     }
 
-    bool isBody = false;
     char c;
-    longName = "";
+    memset(info, 0, sizeof(busStopInfo));
+    strlcpy(info->atco, locationId, sizeof(info->atco));
+    stopInfo = info;
     unsigned long dataSendTimeout = millis() + 10000UL;
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
         while(httpsClient.available()) {
             c = httpsClient.read();
             dataReceived++;
-            if (c == '{' || c == '[') isBody = true;
-            if (isBody) parser.parse(c);
+            parser.parse(c);
         }
-        delay(25);
+        waitForData(httpsClient, 100);
     }
     httpsClient.stop();
+    stopInfo = nullptr;
     if (millis() >= dataSendTimeout) {
         lastErrorMsg = F("Timed out during data receive operation - ");
         lastErrorMsg += String(dataReceived) + F(" bytes received");
         return UPD_TIMEOUT;
     }
-
-    strncpy(locationName,longName.c_str(),sizeof(locationName)-1);
-    locationName[sizeof(locationName)-1] = '\0';
+    if (!info->longName[0]) {
+        lastErrorMsg = F("No stop name returned");
+        return UPD_DATA_ERROR;
+    }
+    info->fetched = time(nullptr);
 
     if (bChunked) lastErrorMsg = F("WARNING: Chunked response! ");
     lastErrorMsg += F("SUCCESS Update took: ");
@@ -415,24 +569,24 @@ int busDataClient::getStopLongName(const char *locationId, char *locationName) {
     return UPD_SUCCESS;
 }
 
-void busDataClient::whitespace(char c) {}
+void busDataClient::startContainer(const jsonPath &path, bool isArray) {}
 
-void busDataClient::startDocument() {}
-
-void busDataClient::key(String key) {
-    currentKey = key;
-}
+void busDataClient::endContainer(const jsonPath &path, bool isArray) {}
 
-void busDataClient::value(String value) {
-    if (currentKey == F("long_name")) longName = value;
+void busDataClient::value(const jsonPath &path, const char *value, int type) {
+    if (!stopInfo) return;
+    if (path.depth == 1) {
+        switch (path.lastKey()) {
+            case jsonKey("long_name"):
+                strlcpy(stopInfo->longName, value, sizeof(stopInfo->longName));
+                break;
+            case jsonKey("indicator"):
+                if (type == JSON_STRING) strlcpy(stopInfo->indicator, value, sizeof(stopInfo->indicator));
+                break;
+        }
+    } else if (path.depth == 2 && path.key(0) == jsonKey("location")) {
+        // GeoJSON order, longitude first
+        if (path.index(1) == 0) stopInfo->lon = atof(value);
+        else if (path.index(1) == 1) stopInfo->lat = atof(value);
+    }
 }
-
-void busDataClient::endArray() {}
-
-void busDataClient::endObject() {}
-
-void busDataClient::endDocument() {}
-
-void busDataClient::startArray() {}
-
-void busDataClient::startObject() {}
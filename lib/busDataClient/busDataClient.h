@@ -9,23 +9,40 @@
  * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
  */
 #pragma once
-#include <JsonListener.h>
-#include <JsonStreamingParser.h>
+#include <jsonListener.h>
+#include <jsonStreamingParser.h>
 #include <stationData.h>
+#include <serviceFilter.h>
+#include <busStopCache.h>
+#include <WiFiClientSecure.h>
 
 typedef void (*busClientCallback) ();
 
 #define MAXBUSLINESIZE 9
-#define BUSMAXREADSERVICES 20
+#define BUSMAXSTOPS 3                   // Most stops that can be shown on one board
+#define BUSMAXREADSERVICES (MAXBOARDSERVICES*BUSMAXSTOPS)
+#define BUSMINCONNHEAP 50000            // Largest free block needed to open another connection while one is open
 
-#define PBT_START 0
-#define PBT_HEADER 1
-#define PBT_SERVICE 2
+// Departures table cells
+#define PBT_START 0             // Not in a cell
+#define PBT_HEADER 1            // Header cell
+#define PBT_SERVICE 2           // First data cell of a row, the following cells are in column order
 #define PBT_DESTINATION 3
 #define PBT_SCHEDULED 4
 #define PBT_EXPECTED 5
+#define PBT_OTHER 6             // Any further cells
 
-class busDataClient: public JsonListener {
+// HTML tokenizer states
+#define HTS_TEXT 0
+#define HTS_TAGOPEN 1           // After '<'
+#define HTS_TAGNAME 2
+#define HTS_ATTRIBUTES 3
+#define HTS_DECLARATION 4       // <!DOCTYPE> or <!-- comment -->
+
+#define MAXHTMLTAGSIZE 8
+#define HTMLREADBUFFER 256
+
+class busDataClient: public jsonListener {
 
     private:
 
@@ -42,35 +59,64 @@ class busDataClient: public JsonListener {
         };
 
         const char* apiHost = "bustimes.org";
-        String currentKey = "";
-        String currentObject = "";
-
         int id=0;
-        String longName;
-        bool maxServicesRead = false;
+        busStopInfo *stopInfo = nullptr;    // Stop details being parsed
         busStop xBusStop;
+        long dataReceived = 0;
+        unsigned long parseTime = 0;
+        bool bChunked = false;
 
-        String stripTag(String html);
+        // HTML tokenizer
+        int htmlState = HTS_TEXT;
+        char tagName[MAXHTMLTAGSIZE];
+        int tagLength = 0;
+        bool closingTag = false;
+        char attributeQuote = 0;
+        int declarationChars = 0;
+        int commentDashes = 0;
+        bool inComment = false;
+        bool skipRawText = false;           // Inside <script> or <style>
+
+        // Departures table
+        const serviceFilter *rowFilter = nullptr;
+        int maxId = 0;
+        bool pageComplete = false;
+        bool rowOpen = false;
+        int rowCells = 0;
+        int parseStep = PBT_START;
+        int nestedTags = 0;
+        bool inLink = false;
+        char cellText[MAXLOCATIONSIZE];     // Text directly in the cell
+        int cellLength = 0;
+        char linkText[MAXLOCATIONSIZE];     // Text in a link, used if there's no direct text (the service number)
+        int linkLength = 0;
+        char nestedText[MAXLOCATIONSIZE];   // Text in other elements within the cell, used if there's no direct text
+        int nestedLength = 0;
+        bool pendingSpace = false;
+
+        void htmlByte(char c);
+        void htmlTag();
+        void htmlText(char c);
+        void startRow();
+        void endRow();
+        void startCell(bool header);
+        void endCell();
         void replaceWord(char* input, const char* target, const char* replacement);
-        void trim(char* &start, char* &end);
-        bool equalsIgnoreCase(const char* a, int a_len, const char* b);
-        bool serviceMatchesFilter(const char* filter, const char* serviceId);
+        int sendRequest(WiFiClientSecure &httpsClient, const char *locationId);
+        int readResponse(WiFiClientSecure &httpsClient, const serviceFilter &filter, busClientCallback Xcb, bool firstResponse);
+        static int departureMinutes(const busService &service);
 
     public:
         String lastErrorMsg = "";
 
         busDataClient();
-        int getStopLongName(const char *locationId, char *locationName);
-        void cleanFilter(const char* rawFilter, char* cleanedFilter, size_t maxLen);
-        int updateDepartures(rdStation *station, const char *locationId, const char *filter, busClientCallback Xcb);
-
-        virtual void whitespace(char c);
-        virtual void startDocument();
-        virtual void key(String key);
-        virtual void value(String value);
-        virtual void endArray();
-        virtual void endObject();
-        virtual void endDocument();
-        virtual void startArray();
-        virtual void startObject();
+        void setApiHost(const char *host);
+        const char *getHost();
+        int getStopInfo(const char *locationId, busStopInfo *info);
+        int updateDepartures(rdStation *station, const char *locationId, const serviceFilter &filter, busClientCallback Xcb);
+        int updateDepartures(rdStation *station, const char *locationIds[], int numLocations, const serviceFilter &filter, busClientCallback Xcb);
+
+        virtual void startContainer(const jsonPath &path, bool isArray);
+        virtual void endContainer(const jsonPath &path, bool isArray);
+        virtual void value(const jsonPath &path, const char *value, int type);
 };
\ No newline at end of file
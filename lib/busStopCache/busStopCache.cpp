@@ -0,0 +1,127 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Bus Stop Cache Library - stop details (name, indicator and location) cached on LittleFS by ATCO code
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ *
+ * The cache file is an array of fixed size busStopInfo records, so a lookup only reads one record at a time
+ * and an update rewrites a single record in place.
+ */
+
+#include <busStopCache.h>
+#include <LittleFS.h>
+#include <time.h>
+
+busStopCache stopCache;
+
+busStopCache::busStopCache() {}
+
+//
+// Find the cached details of a stop. Returns false if the stop isn't in the cache.
+//
+bool busStopCache::lookup(const char *atco, busStopInfo *info) {
+    if (!atco[0] || !LittleFS.exists(F(STOPCACHE_FILE))) {
+        misses++;
+        return false;
+    }
+    File f = LittleFS.open(F(STOPCACHE_FILE), "r");
+    if (!f) {
+        misses++;
+        return false;
+    }
+    if (f.size() % sizeof(busStopInfo)) {
+        // Written by a different version of the firmware
+        f.close();
+        clear();
+        misses++;
+        return false;
+    }
+    while (f.read((uint8_t *)info, sizeof(busStopInfo)) == sizeof(busStopInfo)) {
+        if (!strcasecmp(info->atco, atco)) {
+            f.close();
+            hits++;
+            return true;
+        }
+    }
+    f.close();
+    misses++;
+    return false;
+}
+
+//
+// Check if the details of a stop are due to be refreshed. Details can't go stale until the clock has been set.
+//
+bool busStopCache::isStale(const busStopInfo &info) {
+    time_t now = time(nullptr);
+    if (now < 1700000000) return false;
+    return (info.fetched < 1700000000 || (unsigned long)(now - info.fetched) > STOPCACHE_TTL);
+}
+
+//
+// Add or update the details of a stop. When the cache is full the stop fetched longest ago is replaced.
+//
+bool busStopCache::store(const busStopInfo &info) {
+    busStopInfo entry;
+    int slot = -1;
+    int oldest = 0;
+    uint32_t oldestTime = UINT32_MAX;
+    int entries = 0;
+
+    if (LittleFS.exists(F(STOPCACHE_FILE))) {
+        File f = LittleFS.open(F(STOPCACHE_FILE), "r");
+        if (f && !(f.size() % sizeof(busStopInfo))) {
+            while (f.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry)) {
+                if (!strcasecmp(entry.atco, info.atco)) slot = entries;
+                if (entry.fetched < oldestTime) {
+                    oldestTime = entry.fetched;
+                    oldest = entries;
+                }
+                entries++;
+            }
+        } else entries = -1;
+        if (f) f.close();
+        if (entries < 0) {
+            clear();
+            entries = 0;
+        }
+    }
+    if (slot < 0) slot = (entries < STOPCACHE_ENTRIES) ? entries : oldest;
+
+    File f = LittleFS.open(F(STOPCACHE_FILE), entries ? "r+" : "w");
+    if (!f) return false;
+    bool result = f.seek(slot * sizeof(busStopInfo)) && f.write((const uint8_t *)&info, sizeof(info)) == sizeof(info);
+    f.close();
+    return result;
+}
+
+void busStopCache::clear() {
+    if (LittleFS.exists(F(STOPCACHE_FILE))) LittleFS.remove(F(STOPCACHE_FILE));
+}
+
+//
+// Stop details in the same form as the bustimes.org stops API, so the Web GUI can use either
+//
+String busStopCache::getJson(const busStopInfo &info) {
+    String json = "{\"atco_code\":\"" + String(info.atco) + F("\",\"long_name\":\"");
+    for (const char *p = info.longName; *p; p++) {
+        if (*p == '"' || *p == '\\') json += '\\';
+        json += *p;
+    }
+    json += F("\",\"indicator\":\"");
+    for (const char *p = info.indicator; *p; p++) {
+        if (*p == '"' || *p == '\\') json += '\\';
+        json += *p;
+    }
+    json += F("\"");
+    if (info.lat != 0 || info.lon != 0) json += ",\"location\":[" + String(info.lon,6) + F(",") + String(info.lat,6) + F("]");
+    json += ",\"fetched\":" + String(info.fetched) + F(",\"stale\":") + (isStale(info) ? F("true") : F("false")) + F("}");
+    return json;
+}
+
+String busStopCache::getStats() {
+    return String(hits) + F(" hits, ") + String(misses) + F(" misses");
+}
@@ -0,0 +1,46 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Bus Stop Cache Library - stop details (name, indicator and location) cached on LittleFS by ATCO code
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+#include <stationData.h>
+
+#define MAXATCOSIZE 13
+#define MAXINDICATORSIZE 16
+#define STOPCACHE_ENTRIES 16                    // Stops kept in the cache, the least recently fetched is replaced
+#define STOPCACHE_TTL (30UL * 24UL * 3600UL)    // Age before the details of a stop are refreshed (seconds)
+#define STOPCACHE_FILE "/stopcache.bin"
+
+struct busStopInfo {
+    char atco[MAXATCOSIZE];
+    char longName[MAXLOCATIONSIZE];
+    char indicator[MAXINDICATORSIZE];
+    float lat;
+    float lon;
+    uint32_t fetched;                           // Time the details were fetched (seconds since the epoch)
+};
+
+class busStopCache {
+
+    private:
+        unsigned long hits = 0;
+        unsigned long misses = 0;
+
+    public:
+        busStopCache();
+        bool lookup(const char *atco, busStopInfo *info);
+        bool isStale(const busStopInfo &info);
+        bool store(const busStopInfo &info);
+        void clear();
+        String getJson(const busStopInfo &info);
+        String getStats();
+};
+
+extern busStopCache stopCache;
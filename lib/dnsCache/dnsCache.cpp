@@ -0,0 +1,103 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * DNS Cache Library - caches resolved API host addresses so connects can skip the lookup
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <dnsCache.h>
+#include <WiFi.h>
+
+dnsCache hostCache;
+
+dnsCache::dnsCache() {
+    memset(entries, 0, sizeof(entries));
+}
+
+dnsCache::dnsEntry* dnsCache::find(const char *host) {
+    for (int i=0;i<DNSCACHE_ENTRIES;i++) {
+        if (entries[i].host[0] && !strcmp(entries[i].host,host)) return &entries[i];
+    }
+    return NULL;
+}
+
+//
+// Do a real lookup for the entry, keeping the previous address if it fails
+//
+bool dnsCache::lookup(dnsEntry *entry) {
+    IPAddress ip;
+    unsigned long start = millis();
+    lookups++;
+    if (!WiFi.hostByName(entry->host, ip)) return false;
+    entry->ip = ip;
+    entry->lookupTime = millis() - start;
+    entry->resolved = millis();
+    if (!entry->resolved) entry->resolved = 1;
+    return true;
+}
+
+//
+// Resolve a host name, using the cached address if it hasn't expired
+//
+bool dnsCache::resolve(const char *host, IPAddress &ip) {
+    if (!host || !host[0] || strlen(host) >= DNSCACHE_HOSTSIZE) return WiFi.hostByName(host, ip);
+
+    dnsEntry *entry = find(host);
+    if (entry && entry->resolved && millis() - entry->resolved < DNSCACHE_TTL) {
+        hits++;
+        timeSaved += entry->lookupTime;
+        ip = entry->ip;
+        return true;
+    }
+
+    if (!entry) {
+        // Use a free slot, or replace the oldest entry
+        entry = &entries[0];
+        for (int i=0;i<DNSCACHE_ENTRIES;i++) {
+            if (!entries[i].host[0]) {
+                entry = &entries[i];
+                break;
+            }
+            if (millis() - entries[i].resolved > millis() - entry->resolved) entry = &entries[i];
+        }
+        memset(entry, 0, sizeof(dnsEntry));
+        strlcpy(entry->host, host, sizeof(entry->host));
+    }
+    if (!lookup(entry)) return false;
+    ip = entry->ip;
+    return true;
+}
+
+//
+// Forget the cached address for a host (e.g. after a failed connect)
+//
+void dnsCache::invalidate(const char *host) {
+    dnsEntry *entry = find(host);
+    if (entry) entry->resolved = 0;
+}
+
+//
+// Called during idle frames ahead of a fetch from the host. Re-resolves its address if it would expire within the
+// given window, so the fetch finds it fresh. A host that isn't cached, has already expired or failed to resolve is
+// left for the fetch itself to look up.
+//
+void dnsCache::refresh(const char *host, unsigned long window) {
+    if (millis() < nextRefresh || !host) return;
+    dnsEntry *entry = find(host);
+    if (!entry || !entry->resolved) return;
+    unsigned long age = millis() - entry->resolved;
+    if (age >= DNSCACHE_TTL || age + window < DNSCACHE_TTL) return;
+    nextRefresh = millis() + DNSCACHE_RETRY;
+    lookup(entry);
+}
+
+//
+// Summary line for /info
+//
+String dnsCache::getSummary() {
+    return "DNS cache: " + String(hits) + F(" lookups avoided, ") + String(lookups) + F(" made, ~") + String(timeSaved) + F("ms saved");
+}
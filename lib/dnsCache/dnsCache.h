@@ -0,0 +1,49 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * DNS Cache Library - caches resolved API host addresses so connects can skip the lookup
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+#include <IPAddress.h>
+
+#define DNSCACHE_ENTRIES 6
+#define DNSCACHE_HOSTSIZE 48
+#define DNSCACHE_TTL 300000UL       // lwIP doesn't expose the record TTL, so entries are kept for a fixed 5 minutes
+#define DNSCACHE_PRERESOLVE 30000UL // Re-resolve the next fetch's host if it's due to expire within this time of it
+#define DNSCACHE_RETRY 10000UL      // Minimum time between idle re-resolves
+
+class dnsCache {
+
+    private:
+        struct dnsEntry {
+            char host[DNSCACHE_HOSTSIZE];
+            IPAddress ip;
+            unsigned long resolved;     // millis() when last resolved (0 = unused)
+            unsigned long lookupTime;   // Duration of the last real lookup (ms)
+        };
+
+        dnsEntry entries[DNSCACHE_ENTRIES];
+        unsigned long nextRefresh = 0;
+
+        dnsEntry* find(const char *host);
+        bool lookup(dnsEntry *entry);
+
+    public:
+        unsigned long lookups = 0;      // Real DNS lookups made
+        unsigned long hits = 0;         // Lookups avoided
+        unsigned long timeSaved = 0;    // Estimated time saved by the avoided lookups (ms)
+
+        dnsCache();
+        bool resolve(const char *host, IPAddress &ip);
+        void invalidate(const char *host);
+        void refresh(const char *host, unsigned long window);
+        String getSummary();
+};
+
+extern dnsCache hostCache;
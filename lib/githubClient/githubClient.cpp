@@ -10,52 +10,64 @@
  */
 
 #include <githubClient.h>
-#include <JsonListener.h>
+#include <jsonListener.h>
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
 #include <LittleFS.h>
 #include <md5Utils.h>
+#include <perfMonitor.h>
+#include <requestBuilder.h>
+#include <socketUtils.h>
+#include <apiQuota.h>
 
 github::github(String token) {
     accessToken = token;            // Initialise with a GitHub token if the repository is private
 }
 
+//
+// Override the default GitHub API host (e.g. to use a local test server)
+//
+void github::setApiHost(const char *host) {
+    if (host && host[0]) apiHost = host;
+}
+
 bool github::getLatestRelease() {
 
     lastErrorMsg = "";
-    JsonStreamingParser parser;
+    perf.begin(PERF_GITHUB);
+    jsonStreamingParser parser;
     parser.setListener(this);
     WiFiClientSecure httpsClient;
 
     httpsClient.setInsecure();
     httpsClient.setTimeout(15000);
 
-    int retryCounter=0; //retry counter
-    while((!httpsClient.connect(apiHost, 443)) && (retryCounter < 30)){
-        delay(200);
-        retryCounter++;
-    }
-    if(retryCounter>=30) {
+    if (!socketConnect(httpsClient, apiHost, 443, 6000)) {
         lastErrorMsg += F("Connection timeout");
         return false;
     }
+    perf.sample(PERF_HANDSHAKE);
 
-    String request = "GET "+ String(apiGetLatestRelease) + F(" HTTP/1.0\r\nHost: ") + String(apiHost) + F("\r\nuser-agent: esp32/1.0\r\nX-GitHub-Api-Version: 2022-11-28\r\nAccept: application/vnd.github+json\r\n");
-    if (accessToken.length()) request += "Authorization: Bearer " + String(accessToken) + F("\r\n");
-    request += F("Connection: close\r\n\r\n");
-
-    httpsClient.print(request);
-    retryCounter=0;
-    while(!httpsClient.available()) {
-        delay(200);
-        retryCounter++;
-        if (retryCounter > 25) {
-            // no response within 5 seconds so quit
-            httpsClient.stop();
-            lastErrorMsg += F("Response timeout");
-            return false;
-        }
+    char requestBuffer[384];
+    requestBuilder request(requestBuffer,sizeof(requestBuffer));
+    request.add(F("GET ")).add(apiGetLatestRelease).add(F(" HTTP/1.0\r\nHost: ")).add(apiHost).add(F("\r\nuser-agent: esp32/1.0\r\nX-GitHub-Api-Version: 2022-11-28\r\nAccept: application/vnd.github+json\r\n"));
+    if (accessToken.length()) request.add(F("Authorization: Bearer ")).add(accessToken.c_str()).add(F("\r\n"));
+    request.add(F("Connection: close\r\n\r\n"));
+
+    if (!request.send(httpsClient)) {
+        httpsClient.stop();
+        lastErrorMsg += request.isValid() ? F("Request not sent") : F("Request too large");
+        return false;
+    }
+    quota.consume(QUOTA_GITHUB);
+    perf.setSendTime(request.sendTime);
+    if (!waitForData(httpsClient, 5000)) {
+        // no response within 5 seconds so quit
+        httpsClient.stop();
+        lastErrorMsg += F("Response timeout");
+        return false;
     }
+    perf.firstByte();
 
     while (httpsClient.connected()) {
         String line = httpsClient.readStringUntil('\n');
@@ -73,30 +85,35 @@ bool github::getLatestRelease() {
         }
     }
 
-    bool isBody = false;
     char c;
     releaseId="";
     releaseDescription="";
     releaseAssets=0;
     unsigned long dataReceived = 0;
+    unsigned long parseTime = 0;    // Time spent reading and parsing (us), excludes waiting for data
 
     unsigned long dataSendTimeout = millis() + 12000UL;
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
+        unsigned long parseStart = micros();
         while(httpsClient.available()) {
             c = httpsClient.read();
             dataReceived++;
-            if (c == '{' || c == '[') isBody = true;
-            if (isBody) parser.parse(c);
+            parser.parse(c);
         }
-        delay(50);
+        parseTime += micros() - parseStart;
+        waitForData(httpsClient, 100);
     }
+    perf.sample(PERF_PARSED);
     httpsClient.stop();
     if (millis() >= dataSendTimeout) {
         lastErrorMsg += "Data timeout (" + String(dataReceived) + F(" bytes)");
         return false;
     }
 
-    lastErrorMsg=F("SUCCESS");
+    lastErrorMsg = "SUCCESS [" + String(dataReceived) + F(" bytes, parse ") + String(parseTime/1000) + F("ms");
+    if (parseTime) lastErrorMsg += ", " + String((unsigned long)(((unsigned long long)dataReceived * 1000000ULL) / parseTime)) + F(" bytes/s");
+    lastErrorMsg += F("]");
+    perf.sample(PERF_COPIED);
 
     return true;
 }
@@ -203,46 +220,46 @@ String github::getLastError() {
     return lastErrorMsg;
 }
 
-void github::whitespace(char c) {}
-
-void github::startDocument() {
-    currentArray = "";
-    currentObject = "";
+// An asset object within the assets array
+static bool isAsset(const jsonPath &path) {
+    return path.key(0) == jsonKey("assets") && path.index(1) >= 0;
 }
 
-void github::key(String key) {
-    currentKey = key;
+void github::startContainer(const jsonPath &path, bool isArray) {
+    if (path.depth == 3 && !isArray && isAsset(path)) {
+        assetURL[0] = '\0';
+        assetName[0] = '\0';
+    }
 }
 
-void github::value(String value) {
-    if (currentKey == "tag_name") releaseId = value;
-    else if ((currentKey == "name") && (currentArray=="")) releaseDescription = value;
-    else if ((currentKey == "url") && (currentArray=="assets") && (currentObject!="uploader")) assetURL = value;
-    else if ((currentKey == "name") && (currentArray=="assets") && (currentObject!="uploader")) assetName = value;
-
-    if (assetURL.length() && assetName.length() && releaseAssets<MAX_RELEASE_ASSETS) {
+void github::endContainer(const jsonPath &path, bool isArray) {
+    if (path.depth == 3 && !isArray && isAsset(path) && assetURL[0] && assetName[0] && releaseAssets<MAX_RELEASE_ASSETS) {
         // Save the full asset url to the list
         releaseAssetURL[releaseAssets] = assetURL;
         releaseAssetName[releaseAssets++] = assetName;
-        assetURL="";
-        assetName="";
     }
 }
 
-void github::endArray() {
-    currentArray = "";
-}
-
-void github::endObject() {
-    currentObject = "";
-}
-
-void github::endDocument() {}
-
-void github::startArray() {
-    currentArray = currentKey;
-}
-
-void github::startObject() {
-    currentObject = currentKey;
+void github::value(const jsonPath &path, const char *value, int type) {
+    if (path.depth == 1) {
+        // Release details
+        switch (path.lastKey()) {
+            case jsonKey("tag_name"):
+                releaseId = value;
+                break;
+            case jsonKey("name"):
+                releaseDescription = value;
+                break;
+        }
+    } else if (path.depth == 3 && isAsset(path)) {
+        // Asset details (not those of its uploader, which is a level deeper)
+        switch (path.lastKey()) {
+            case jsonKey("url"):
+                strlcpy(assetURL, value, sizeof(assetURL));
+                break;
+            case jsonKey("name"):
+                strlcpy(assetName, value, sizeof(assetName));
+                break;
+        }
+    }
 }
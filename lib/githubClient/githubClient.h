@@ -9,26 +9,25 @@
  * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
  */
 #pragma once
-#include <JsonListener.h>
-#include <JsonStreamingParser.h>
+#include <jsonListener.h>
+#include <jsonStreamingParser.h>
 #include <md5Utils.h>
 
 #define MAX_RELEASE_ASSETS 16   //  The maximum number of release asset details that will be read and stored
+#define MAX_ASSETURL_SIZE 160
+#define MAX_ASSETNAME_SIZE 64
 
-class github: public JsonListener {
+class github: public jsonListener {
 
     private:
         const char* apiHost = "api.github.com";
         const char* apiGetLatestRelease = "/repos/gadec-uk/tiny-departures-board/releases/latest";
-        String currentKey = "";
-        String currentArray = "";
-        String currentObject = "";
-        String previousObject = "";
 
         String lastErrorMsg = "";
 
-        String assetURL;
-        String assetName;
+        // The asset being parsed
+        char assetURL[MAX_ASSETURL_SIZE];
+        char assetName[MAX_ASSETNAME_SIZE];
         md5Utils md5;
 
     public:
@@ -40,18 +39,13 @@ class github: public JsonListener {
         String releaseAssetName[MAX_RELEASE_ASSETS];
 
         github(String token);
+        void setApiHost(const char *host);
 
         bool getLatestRelease();
 
         String getLastError();
 
-        virtual void whitespace(char c);
-        virtual void startDocument();
-        virtual void key(String key);
-        virtual void value(String value);
-        virtual void endArray();
-        virtual void endObject();
-        virtual void endDocument();
-        virtual void startArray();
-        virtual void startObject();
+        virtual void startContainer(const jsonPath &path, bool isArray);
+        virtual void endContainer(const jsonPath &path, bool isArray);
+        virtual void value(const jsonPath &path, const char *value, int type);
 };
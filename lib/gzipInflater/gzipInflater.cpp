@@ -0,0 +1,107 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Gzip Inflater Library - streams a gzipped flash array out uncompressed, using the tinfl inflater in ROM
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ *
+ * Only needed for the rare browser that doesn't accept gzip. The buffers are only held while a page is sent.
+ */
+#include <gzipInflater.h>
+#include <rom/miniz.h>
+
+#define GZIP_FTEXT 0x01
+#define GZIP_FHCRC 0x02
+#define GZIP_FEXTRA 0x04
+#define GZIP_FNAME 0x08
+#define GZIP_FCOMMENT 0x10
+#define GZIP_TRAILERSIZE 8
+
+gzipInflater::gzipInflater() {}
+
+gzipInflater::~gzipInflater() {
+    end();
+}
+
+bool gzipInflater::isGzip(const uint8_t *data, size_t length) {
+    return length > 10 + GZIP_TRAILERSIZE && data[0] == 0x1F && data[1] == 0x8B && data[2] == 8;
+}
+
+//
+// Size of the gzip header, skipping the optional fields. Returns 0 if the header runs past the data.
+//
+size_t gzipInflater::headerSize(const uint8_t *data, size_t length) {
+    size_t pos = 10;
+    uint8_t flags = data[3];
+    if (flags & GZIP_FEXTRA) {
+        if (pos + 2 > length) return 0;
+        pos += 2 + (data[pos] | (data[pos+1] << 8));
+    }
+    if (flags & GZIP_FNAME) {
+        while (pos < length && data[pos]) pos++;
+        pos++;
+    }
+    if (flags & GZIP_FCOMMENT) {
+        while (pos < length && data[pos]) pos++;
+        pos++;
+    }
+    if (flags & GZIP_FHCRC) pos += 2;
+    return (pos + GZIP_TRAILERSIZE <= length) ? pos : 0;
+}
+
+//
+// Uncompressed size, from the end of the gzip trailer
+//
+size_t gzipInflater::inflatedSize(const uint8_t *data, size_t length) {
+    const uint8_t *size = data + length - 4;
+    return size[0] | (size[1] << 8) | (size[2] << 16) | ((uint32_t)size[3] << 24);
+}
+
+//
+// Allocate the inflater. Call before sending any headers, so a shortage of memory can still be reported.
+//
+bool gzipInflater::begin() {
+    if (!inflator) inflator = malloc(sizeof(tinfl_decompressor));
+    if (!dictionary) dictionary = (uint8_t *)malloc(TINFL_LZ_DICT_SIZE);
+    if (inflator && dictionary) return true;
+    end();
+    return false;
+}
+
+//
+// Inflate gzipped data to a stream, a window at a time. Returns false if the data is corrupt.
+//
+bool gzipInflater::inflate(const uint8_t *data, size_t length, Print &out) {
+    if (!inflator || !dictionary || !isGzip(data, length)) return false;
+    size_t header = headerSize(data, length);
+    if (!header) return false;
+
+    tinfl_decompressor *decompressor = (tinfl_decompressor *)inflator;
+    tinfl_init(decompressor);
+    const uint8_t *next = data + header;
+    size_t remaining = length - header - GZIP_TRAILERSIZE;
+    size_t windowPos = 0;
+
+    while (true) {
+        size_t inBytes = remaining;
+        size_t outBytes = TINFL_LZ_DICT_SIZE - windowPos;
+        tinfl_status status = tinfl_decompress(decompressor, next, &inBytes, dictionary, dictionary + windowPos, &outBytes, 0);
+        next += inBytes;
+        remaining -= inBytes;
+        if (outBytes) out.write(dictionary + windowPos, outBytes);
+        windowPos = (windowPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+        if (status == TINFL_STATUS_DONE) return true;
+        if (status < TINFL_STATUS_DONE) return false;
+        yield();
+    }
+}
+
+void gzipInflater::end() {
+    free(inflator);
+    free(dictionary);
+    inflator = nullptr;
+    dictionary = nullptr;
+}
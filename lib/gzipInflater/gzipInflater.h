@@ -0,0 +1,30 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Gzip Inflater Library - streams a gzipped flash array out uncompressed, using the tinfl inflater in ROM
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+
+class gzipInflater {
+
+    private:
+        void *inflator = nullptr;           // tinfl_decompressor (about 11KB)
+        uint8_t *dictionary = nullptr;      // 32KB output window, the most distance a match can reach back
+
+        static size_t headerSize(const uint8_t *data, size_t length);
+
+    public:
+        gzipInflater();
+        ~gzipInflater();
+        static bool isGzip(const uint8_t *data, size_t length);
+        static size_t inflatedSize(const uint8_t *data, size_t length);
+        bool begin();
+        bool inflate(const uint8_t *data, size_t length, Print &out);
+        void end();
+};
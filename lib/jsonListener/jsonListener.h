@@ -0,0 +1,72 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * jsonListener Library - callbacks and path stack for the streaming JSON parser
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#define JSON_MAX_DEPTH 10           // Deepest nesting tracked, values nested deeper are still parsed but can't be matched
+
+// Value types
+#define JSON_STRING 0
+#define JSON_NUMBER 1
+#define JSON_BOOL 2
+#define JSON_NULL 3
+
+#define JSON_HASH_SEED 2166136261UL
+#define JSON_HASH_PRIME 16777619UL
+
+//
+// FNV-1a hash of a key name. Evaluated at compile time for literals, so keys can be used as case labels.
+//
+constexpr uint32_t jsonKey(const char *key, uint32_t hash = JSON_HASH_SEED) {
+    return *key ? jsonKey(key + 1, (hash ^ (uint8_t)*key) * JSON_HASH_PRIME) : hash;
+}
+
+//
+// Where the parser is in the document. Level 0 is the outermost object or array. Each object level holds the
+// hash of its current key and each array level the index of its current element.
+//
+class jsonPath {
+  public:
+    struct level {
+        bool isArray;
+        uint32_t key;
+        int index;
+    };
+
+    int depth = 0;                  // Number of open objects and arrays
+    level levels[JSON_MAX_DEPTH];
+
+    // Key hash of an object level (0 for an array or a level that's too deep to track)
+    uint32_t key(int d) const {
+        return (d >= 0 && d < depth && d < JSON_MAX_DEPTH && !levels[d].isArray) ? levels[d].key : 0;
+    }
+
+    // Element index of an array level (-1 for an object or a level that's too deep to track)
+    int index(int d) const {
+        return (d >= 0 && d < depth && d < JSON_MAX_DEPTH && levels[d].isArray) ? levels[d].index : -1;
+    }
+
+    // Key hash of the innermost level
+    uint32_t lastKey() const {
+        return key(depth - 1);
+    }
+};
+
+class jsonListener {
+  private:
+
+  public:
+
+    virtual void startContainer(const jsonPath &path, bool isArray) = 0;
+    virtual void endContainer(const jsonPath &path, bool isArray) = 0;
+    virtual void value(const jsonPath &path, const char *value, int type) = 0;
+};
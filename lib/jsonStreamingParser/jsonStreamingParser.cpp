@@ -0,0 +1,193 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * JSON Streaming Parser Library - parses a character at a time into a fixed buffer, reporting values by path
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ *
+ * Keys are never stored, they're hashed as they're read (see jsonKey() in jsonListener.h). Values are collected
+ * in a fixed buffer and passed to the listener with the current path, so parsing doesn't allocate any memory.
+ * The parser is lenient, anything before the first '{' or '[' (e.g. HTTP headers) is skipped.
+ */
+#include <jsonStreamingParser.h>
+
+jsonStreamingParser::jsonStreamingParser() {
+    reset();
+}
+
+void jsonStreamingParser::setListener(jsonListener* listener) {
+    myListener = listener;
+}
+
+void jsonStreamingParser::reset() {
+    state = JSTATE_BEGIN;
+    path.depth = 0;
+    arrayLevels = 0;
+    length = 0;
+    buffer[0] = '\0';
+    escape = false;
+    unicodeDigits = 0;
+}
+
+// The outermost object or array has been closed
+bool jsonStreamingParser::isComplete() {
+    return state == JSTATE_DONE;
+}
+
+void jsonStreamingParser::parse(const char character) {
+    switch (state) {
+        case JSTATE_BEGIN:
+            if (character == '{' || character == '[') openContainer(character == '[');
+            break;
+
+        case JSTATE_KEYSTART:
+            if (character == '"') {
+                keyHash = JSON_HASH_SEED;
+                escape = false;
+                unicodeDigits = 0;
+                state = JSTATE_KEY;
+            } else if (character == '}') closeContainer();
+            break;
+
+        case JSTATE_KEY:
+        case JSTATE_STRING:
+            if (unicodeDigits) {
+                unicodeChar = (unicodeChar << 4) | (isdigit(character) ? character - '0' : (tolower(character) - 'a' + 10) & 0x0F);
+                if (!--unicodeDigits) addUnicode(unicodeChar);
+            } else if (escape) {
+                escape = false;
+                if (character == 'u') {
+                    unicodeDigits = 4;
+                    unicodeChar = 0;
+                } else addChar(unescape(character));
+            } else if (character == '\\') {
+                escape = true;
+            } else if (character == '"') {
+                if (state == JSTATE_KEY) {
+                    if (path.depth <= JSON_MAX_DEPTH) path.levels[path.depth-1].key = keyHash;
+                    state = JSTATE_COLON;
+                } else {
+                    buffer[length] = '\0';
+                    if (myListener) myListener->value(path, buffer, JSON_STRING);
+                    state = JSTATE_AFTERVALUE;
+                }
+            } else addChar(character);
+            break;
+
+        case JSTATE_COLON:
+            if (character == ':') state = JSTATE_VALUE;
+            break;
+
+        case JSTATE_VALUE:
+            if (character == '"') {
+                length = 0;
+                escape = false;
+                unicodeDigits = 0;
+                state = JSTATE_STRING;
+            } else if (character == '{' || character == '[') {
+                openContainer(character == '[');
+            } else if (character == ']' || character == '}') {
+                // Empty array (or a missing value)
+                closeContainer();
+            } else if (!isspace(character) && character != ',') {
+                length = 0;
+                state = JSTATE_LITERAL;
+                addChar(character);
+            }
+            break;
+
+        case JSTATE_LITERAL:
+            if (character == ',' || character == ']' || character == '}' || isspace(character)) {
+                endLiteral();
+                state = JSTATE_AFTERVALUE;
+                parse(character);
+            } else addChar(character);
+            break;
+
+        case JSTATE_AFTERVALUE:
+            if (character == ',') {
+                if (inArray()) {
+                    if (path.depth <= JSON_MAX_DEPTH) path.levels[path.depth-1].index++;
+                    state = JSTATE_VALUE;
+                } else state = JSTATE_KEYSTART;
+            } else if (character == ']' || character == '}') closeContainer();
+            break;
+
+        default:
+            break;
+    }
+}
+
+void jsonStreamingParser::openContainer(bool isArray) {
+    if (path.depth >= JSON_MAX_NESTING) {
+        // Too deep to follow, give up on the rest of the document
+        state = JSTATE_DONE;
+        return;
+    }
+    if (isArray) arrayLevels |= (1UL << path.depth); else arrayLevels &= ~(1UL << path.depth);
+    if (path.depth < JSON_MAX_DEPTH) {
+        path.levels[path.depth].isArray = isArray;
+        path.levels[path.depth].key = 0;
+        path.levels[path.depth].index = 0;
+    }
+    path.depth++;
+    if (myListener) myListener->startContainer(path, isArray);
+    state = isArray ? JSTATE_VALUE : JSTATE_KEYSTART;
+}
+
+void jsonStreamingParser::closeContainer() {
+    if (!path.depth) return;
+    if (myListener) myListener->endContainer(path, inArray());
+    path.depth--;
+    state = path.depth ? JSTATE_AFTERVALUE : JSTATE_DONE;
+}
+
+bool jsonStreamingParser::inArray() {
+    return path.depth && ((arrayLevels >> (path.depth-1)) & 1);
+}
+
+// Add a character to the key hash or the value buffer
+void jsonStreamingParser::addChar(char character) {
+    if (state == JSTATE_KEY) {
+        keyHash = (keyHash ^ (uint8_t)character) * JSON_HASH_PRIME;
+    } else if (length < JSON_BUFFER_MAX_LENGTH - 1) {
+        buffer[length++] = character;
+    }
+}
+
+// Add a \u escaped character as UTF-8 (surrogate pairs aren't decoded)
+void jsonStreamingParser::addUnicode(uint16_t code) {
+    if (code < 0x80) addChar(code);
+    else if (code < 0x800) {
+        addChar(0xC0 | (code >> 6));
+        addChar(0x80 | (code & 0x3F));
+    } else if (code >= 0xD800 && code <= 0xDFFF) {
+        addChar('?');
+    } else {
+        addChar(0xE0 | (code >> 12));
+        addChar(0x80 | ((code >> 6) & 0x3F));
+        addChar(0x80 | (code & 0x3F));
+    }
+}
+
+char jsonStreamingParser::unescape(char character) {
+    switch (character) {
+        case 'n': return '\n';
+        case 'r': return '\r';
+        case 't': return '\t';
+        case 'b': return '\b';
+        case 'f': return '\f';
+        default: return character;  // " \ and /
+    }
+}
+
+void jsonStreamingParser::endLiteral() {
+    buffer[length] = '\0';
+    int type = JSON_NUMBER;
+    if (buffer[0] == 't' || buffer[0] == 'f') type = JSON_BOOL;
+    else if (buffer[0] == 'n') type = JSON_NULL;
+    if (myListener) myListener->value(path, buffer, type);
+}
@@ -0,0 +1,58 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * JSON Streaming Parser Library - parses a character at a time into a fixed buffer, reporting values by path
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <jsonListener.h>
+
+#define JSON_BUFFER_MAX_LENGTH 256  // Longest value passed to the listener, longer values are truncated
+#define JSON_MAX_NESTING 32         // Deepest nesting that can be parsed at all (see JSON_MAX_DEPTH)
+
+#define JSTATE_BEGIN 0              // Skipping anything before the document
+#define JSTATE_KEYSTART 1           // In an object, waiting for a key
+#define JSTATE_KEY 2
+#define JSTATE_COLON 3
+#define JSTATE_VALUE 4              // Waiting for a value
+#define JSTATE_STRING 5
+#define JSTATE_LITERAL 6            // Number, true, false or null
+#define JSTATE_AFTERVALUE 7         // Waiting for a comma or the end of the object/array
+#define JSTATE_DONE 8
+
+class jsonStreamingParser {
+  private:
+
+    int state;
+    jsonListener* myListener = nullptr;
+    jsonPath path;
+    uint32_t arrayLevels;       // A bit for each open level that's an array, including levels too deep for the path
+
+    char buffer[JSON_BUFFER_MAX_LENGTH];
+    uint32_t length;
+    uint32_t keyHash;
+    bool escape;                // The previous character was a backslash
+    int unicodeDigits;          // Hex digits of a \u escape still to read (0 when not in one)
+    uint16_t unicodeChar;
+
+    void openContainer(bool isArray);
+    void closeContainer();
+    bool inArray();
+    void addChar(char character);
+    void addUnicode(uint16_t code);
+    char unescape(char character);
+    void endLiteral();
+
+  public:
+    jsonStreamingParser();
+    void parse(const char character);
+    void setListener(jsonListener* listener);
+    void reset();
+    bool isComplete();
+};
@@ -0,0 +1,133 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Performance Monitor Library - records heap and stack usage at each stage of a data fetch
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <perfMonitor.h>
+
+static const char* fetchNames[PERF_FETCHTYPES] = { "Rail", "Bus", "Weather", "GitHub", "Picker" };
+static const char* stageNames[PERF_STAGES] = { "connect", "handshake", "parsed", "copied" };
+
+perfMonitor perf;
+
+perfMonitor::perfMonitor() {}
+
+//
+// Start a new record for a fetch (overwriting the oldest if the window is full) and take the first sample
+//
+void perfMonitor::begin(int fetchType) {
+    latest = (latest + 1) % PERF_MAXRECORDS;
+    if (numRecords < PERF_MAXRECORDS) numRecords++;
+    memset(&records[latest], 0, sizeof(perfRecord));
+    records[latest].fetchType = fetchType;
+    records[latest].started = millis();
+    sample(PERF_CONNECT);
+}
+
+//
+// Sample the heap and stack at the given stage of the current fetch
+//
+void perfMonitor::sample(int stage) {
+    if (latest < 0 || stage < 0 || stage >= PERF_STAGES) return;
+    perfSample *s = &records[latest].sample[stage];
+    s->freeHeap = ESP.getFreeHeap();
+    s->minFreeHeap = ESP.getMinFreeHeap();
+    s->largestBlock = ESP.getMaxAllocHeap();
+    s->stackFree = uxTaskGetStackHighWaterMark(NULL);
+    records[latest].duration = millis() - records[latest].started;
+    if (stage == PERF_HANDSHAKE) records[latest].handshake = records[latest].duration;
+}
+
+//
+// Heap held by the connection (mbedTLS context and buffers for TLS) once connected
+//
+long perfMonitor::connectionHeap(perfRecord *r) {
+    if (!r->sample[PERF_CONNECT].freeHeap || !r->sample[PERF_HANDSHAKE].freeHeap) return 0;
+    return (long)r->sample[PERF_CONNECT].freeHeap - (long)r->sample[PERF_HANDSHAKE].freeHeap;
+}
+
+//
+// Record how long the request took to write for the current fetch
+//
+void perfMonitor::setSendTime(unsigned long us) {
+    if (latest >= 0) records[latest].sendTime = us;
+}
+
+//
+// Record when the first byte of the response arrived for the current fetch
+//
+void perfMonitor::firstByte() {
+    if (latest >= 0) records[latest].firstByte = millis() - records[latest].started;
+}
+
+//
+// Full listing of the rolling window, oldest first (used by /perf)
+//
+String perfMonitor::getReport() {
+    String report = F("Fetch    Age(s) Time(ms) Conn(ms) ConnHeap Send(us) TTFB(ms) Stage      FreeHeap  MinHeap  MaxBlock  StackFree\n");
+    char line[90];
+
+    for (int i=numRecords-1;i>=0;i--) {
+        perfRecord *r = &records[(latest - i + PERF_MAXRECORDS) % PERF_MAXRECORDS];
+        for (int j=0;j<PERF_STAGES;j++) {
+            if (!r->sample[j].freeHeap) continue;   // Stage not reached (fetch failed)
+            if (j==0) {
+                snprintf(line,sizeof(line),"%-8s %6lu %8lu %8lu %8ld %8lu %8lu ",fetchNames[r->fetchType],(millis()-r->started)/1000,r->duration,r->handshake,connectionHeap(r),r->sendTime,r->firstByte);
+            } else {
+                snprintf(line,sizeof(line),"%61s","");
+            }
+            report += line;
+            snprintf(line,sizeof(line),"%-10s %8lu %8lu %9lu %10lu\n",stageNames[j],(unsigned long)r->sample[j].freeHeap,(unsigned long)r->sample[j].minFreeHeap,(unsigned long)r->sample[j].largestBlock,(unsigned long)r->sample[j].stackFree);
+            report += line;
+        }
+    }
+    return report;
+}
+
+//
+// The lowest free heap, smallest largest block, lowest stack headroom, average connect time and largest connection heap
+// seen for each fetch type in the window (used by /info)
+//
+String perfMonitor::getSummary() {
+    String summary = "";
+    char line[110];
+
+    for (int t=0;t<PERF_FETCHTYPES;t++) {
+        uint32_t lowHeap = UINT32_MAX;
+        uint32_t lowBlock = UINT32_MAX;
+        uint32_t lowStack = UINT32_MAX;
+        int lowStage = 0;
+        unsigned long totalHandshake = 0;
+        long peakConnHeap = 0;
+        int connects = 0;
+        for (int i=0;i<numRecords;i++) {
+            if (records[i].fetchType != t) continue;
+            if (records[i].sample[PERF_HANDSHAKE].freeHeap) {
+                connects++;
+                totalHandshake += records[i].handshake;
+                if (connectionHeap(&records[i]) > peakConnHeap) peakConnHeap = connectionHeap(&records[i]);
+            }
+            for (int j=0;j<PERF_STAGES;j++) {
+                perfSample *s = &records[i].sample[j];
+                if (!s->freeHeap) continue;
+                if (s->freeHeap < lowHeap) { lowHeap = s->freeHeap; lowStage = j; }
+                if (s->largestBlock < lowBlock) lowBlock = s->largestBlock;
+                if (s->stackFree < lowStack) lowStack = s->stackFree;
+            }
+        }
+        if (lowHeap == UINT32_MAX) continue;
+        snprintf(line,sizeof(line),"\n%s fetch peak: free heap %lu (at %s), largest block %lu, stack free %lu",fetchNames[t],(unsigned long)lowHeap,stageNames[lowStage],(unsigned long)lowBlock,(unsigned long)lowStack);
+        summary += line;
+        if (connects) {
+            snprintf(line,sizeof(line),", connect avg %lums, connection heap %ld",totalHandshake/connects,peakConnHeap);
+            summary += line;
+        }
+    }
+    return summary;
+}
@@ -0,0 +1,67 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Performance Monitor Library - records heap and stack usage at each stage of a data fetch
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+
+#define PERF_MAXRECORDS 12      // Number of fetches kept in the rolling window
+
+// Fetch types
+#define PERF_RAIL 0
+#define PERF_BUS 1
+#define PERF_WEATHER 2
+#define PERF_GITHUB 3
+#define PERF_PICKER 4
+#define PERF_FETCHTYPES 5
+
+// Stages of a fetch at which the heap and stack are sampled
+#define PERF_CONNECT 0          // Before connecting
+#define PERF_HANDSHAKE 1        // After connecting (and TLS handshake)
+#define PERF_PARSED 2           // After the response has been parsed
+#define PERF_COPIED 3           // After the data has been copied out to the caller
+#define PERF_STAGES 4
+
+class perfMonitor {
+
+    private:
+        struct perfSample {
+            uint32_t freeHeap;      // Free heap (bytes)
+            uint32_t minFreeHeap;   // Lowest free heap since boot (bytes)
+            uint32_t largestBlock;  // Largest allocatable block (bytes)
+            uint32_t stackFree;     // Loop task stack high watermark (bytes never used)
+        };
+
+        struct perfRecord {
+            int fetchType;
+            unsigned long started;  // millis() at the start of the fetch
+            unsigned long duration; // Time to the last sample (ms)
+            unsigned long sendTime; // Time taken to write the request (us)
+            unsigned long firstByte;    // Time from the start of the fetch to the first response byte (ms)
+            unsigned long handshake;    // Time taken to connect, including DNS and any TLS handshake (ms)
+            perfSample sample[PERF_STAGES];
+        };
+
+        perfRecord records[PERF_MAXRECORDS];
+        int numRecords = 0;
+        int latest = -1;            // Index of the current/most recent record
+
+        long connectionHeap(perfRecord *r);
+
+    public:
+        perfMonitor();
+        void begin(int fetchType);
+        void sample(int stage);
+        void setSendTime(unsigned long us);
+        void firstByte();
+        String getReport();
+        String getSummary();
+};
+
+extern perfMonitor perf;
@@ -13,6 +13,10 @@
 #include <xmlListener.h>
 #include <WiFiClientSecure.h>
 #include <stationData.h>
+#include <perfMonitor.h>
+#include <requestBuilder.h>
+#include <socketUtils.h>
+#include <apiQuota.h>
 
 raildataXmlClient::raildataXmlClient() {
     firstDataLoad=true;
@@ -47,26 +51,23 @@ int raildataXmlClient::init(const char *wsdlHost, const char *wsdlAPI, rdCallbac
     httpsClient.setInsecure();
     httpsClient.setTimeout(15000);
 
-    int retryCounter=0; //retry counter
-    while((!httpsClient.connect(wsdlHost, 443)) && (retryCounter < 30)){
-        delay(100);
-        retryCounter++;
-    }
-    if(retryCounter==30) {
+    if (!socketConnect(httpsClient, wsdlHost, 443, 3000)) {
       return UPD_NO_RESPONSE;   // No response within 3s
     }
 
-    httpsClient.print("GET " + String(wsdlAPI) + F(" HTTP/1.0\r\n") +
-      F("Host: ") + String(wsdlHost) + F("\r\n") +
-      F("Connection: close\r\n\r\n"));
+    char requestBuffer[256];
+    requestBuilder request(requestBuffer,sizeof(requestBuffer));
+    request.add(F("GET ")).add(wsdlAPI).add(F(" HTTP/1.0\r\nHost: ")).add(wsdlHost).add(F("\r\nConnection: close\r\n\r\n"));
+    if (!request.send(httpsClient)) {
+      httpsClient.stop();
+      if (request.isValid()) return UPD_NO_RESPONSE;    // Connection failed while sending
+      return UPD_DATA_ERROR;    // Request too large for the buffer
+    }
+    quota.consume(QUOTA_RAIL);
 
-    retryCounter = 0;
-    while(!httpsClient.available()) {
-        delay(100);
-        retryCounter++;
-        if (retryCounter > 100) {
-            return UPD_TIMEOUT;     // Timeout after 10s
-        }
+    if (!waitForData(httpsClient, 10000)) {
+        httpsClient.stop();
+        return UPD_TIMEOUT;     // Timeout after 10s
     }
 
     while (httpsClient.connected() || httpsClient.available()) {
@@ -96,16 +97,14 @@ int raildataXmlClient::init(const char *wsdlHost, const char *wsdlAPI, rdCallbac
     xmlStreamingParser parser;
     parser.setListener(this);
     parser.reset();
-    grandParentTagName = "";
-    parentTagName = "";
-    tagName = "";
-    tagLevel = 0;
+    tagDepth = 0;
 
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
       while (httpsClient.available()) {
         c = httpsClient.read();
         parser.parse(c);
       }
+      waitForData(httpsClient, 100);
     }
 
     httpsClient.stop();
@@ -185,253 +184,359 @@ void raildataXmlClient::fixFullStop(char *input) {
     }
 }
 
-// Trim leading and trailing spaces in-place
-void raildataXmlClient::trim(char* &start, char* &end) {
-  while (start <= end && isspace(*start)) start++;
-  while (end >= start && isspace(*end)) end--;
-}
 
-// Compare strings case-insensitively
-bool raildataXmlClient::equalsIgnoreCase(const char* a, int a_len, const char* b) {
-  for (int i = 0; i < a_len; i++) {
-    if (tolower(a[i]) != tolower(b[i])) return false;
-  }
-  return b[a_len] == '\0';
+//
+// Adds the SOAP envelope and access token header to a request body
+//
+void raildataXmlClient::beginSoapBody(requestBuilder &request, const char *customToken) {
+    request.add(F("POST ")).add(soapAPI).add(F(" HTTP/1.1\r\nHost: ")).add(soapHost);
+    request.add(F("\r\nContent-Type: text/xml;charset=UTF-8\r\nConnection: keep-alive\r\n"));
+    request.beginBody();
+    request.add(F("<soap-env:Envelope xmlns:soap-env=\"http://schemas.xmlsoap.org/soap/envelope/\"><soap-env:Header><ns0:AccessToken xmlns:ns0=\"http://thalesgroup.com/RTTI/2013-11-28/Token/types\"><ns0:TokenValue>"));
+    request.addXml(customToken).add(F("</ns0:TokenValue></ns0:AccessToken></soap-env:Header><soap-env:Body>"));
 }
 
-// Check if the service is in the filter list (if there is one)
-bool raildataXmlClient::serviceMatchesFilter(const char* filter, const char* serviceId) {
-  if (filter == nullptr || filter[0] == '\0') return true; // empty filter = match all
-
-  const char* start = filter;
-  const char* ptr = filter;
-
-  while (true) {
-    if (*ptr == ',' || *ptr == '\0') {
-      const char* end = ptr - 1;
-      char* trimStart = const_cast<char*>(start);
-      char* trimEnd   = const_cast<char*>(end);
-      trim(trimStart, trimEnd);
-      int len = trimEnd - trimStart + 1;
-      if (len > 0 && equalsIgnoreCase(trimStart, len, serviceId)) {
-        return true;
-      }
-      if (*ptr == '\0') break;
-      ptr++;
-      start = ptr;
-    } else {
-      ptr++;
-    }
-  }
-
-  return false;
+void raildataXmlClient::endSoapBody(requestBuilder &request) {
+    request.add(F("</soap-env:Body></soap-env:Envelope>"));
+    request.endBody();
 }
 
-void raildataXmlClient::cleanFilter(const char* rawFilter, char* cleanedFilter, size_t maxLen) {
-    if (!rawFilter || rawFilter[0] == '\0') {
-        if (maxLen > 0) cleanedFilter[0] = '\0';
-        return;
-    }
-
-    size_t j = 0;
-    const char* ptr = rawFilter;
-
-    while (*ptr != '\0' && j < maxLen - 1) {
-        if (*ptr == ',') {
-            cleanedFilter[j++] = ',';
-            ptr++;
-            continue;
-        }
-        if (!isspace(*ptr)) {
-            cleanedFilter[j++] = tolower(*ptr);
-        }
-        ptr++;
-    }
-
-    cleanedFilter[j] = '\0';
-    return;
-}
-
-
 //
-// Updates the Departure Board data from the SOAP API
+// Posts a SOAP request and streams the response through the xml parser. The connection is kept open (if the server
+// allows it) so the other requests in the same update don't need another TLS handshake.
 //
-int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, const char *platforms) {
-
-    unsigned long perfTimer=millis();
-    bool bChunked = false;
-    lastErrorMessage = "";
-
-    // Reset the counters
-    xStation.numServices=0;
-    xMessages.numMessages=0;
-    xStation.platformAvailable=false;
-    addedStopLocation = false;
-    strcpy(xStation.location,"");
-
-    for (int i=0;i<MAXBOARDSERVICES;i++) {
-      strcpy(xStation.service[i].sTime,"");
-      strcpy(xStation.service[i].destination,"");
-      strcpy(xStation.service[i].via,"");
-      strcpy(xStation.service[i].origin,"");
-      strcpy(xStation.service[i].etd,"");
-      strcpy(xStation.service[i].platform,"");
-      strcpy(xStation.service[i].opco,"");
-      strcpy(xStation.service[i].calling,"");
-      strcpy(xStation.service[i].serviceMessage,"");
-      xStation.service[i].trainLength=0;
-      xStation.service[i].classesAvailable=0;
-      xStation.service[i].serviceType=0;
-      xStation.service[i].isCancelled=false;
-      xStation.service[i].isDelayed=false;
-    }
-    for (int i=0;i<MAXBOARDMESSAGES;i++) strcpy(xMessages.messages[i],"");
-    id=-1;
-    coaches=0;
-
-    WiFiClientSecure httpsClient;
-    httpsClient.setInsecure();
-    httpsClient.setTimeout(15000);
-    httpsClient.setNoDelay(false);
-
-    int retryCounter=0; //retry counter
-    while((!httpsClient.connect(soapHost, 443)) && (retryCounter < 30)) {
-        delay(100);
-        retryCounter++;
-    }
-    if(retryCounter>=30) {
-        lastErrorMessage = F("Timed out, no response from connect");    // No response within 3s
-        return UPD_NO_RESPONSE;
-    }
-
-    int reqRows = MAXBOARDSERVICES;
-    if (platforms[0]) reqRows = 10;   // Request maximum services if we're filtering platforms
-    String data = F("<soap-env:Envelope xmlns:soap-env=\"http://schemas.xmlsoap.org/soap/envelope/\"><soap-env:Header><ns0:AccessToken xmlns:ns0=\"http://thalesgroup.com/RTTI/2013-11-28/Token/types\"><ns0:TokenValue>");
-    data += String(customToken) + F("</ns0:TokenValue></ns0:AccessToken></soap-env:Header><soap-env:Body><ns0:GetDepBoardWithDetailsRequest xmlns:ns0=\"http://thalesgroup.com/RTTI/2021-11-01/ldb/\"><ns0:numRows>") + String(reqRows) + F("</ns0:numRows><ns0:crs>");
-    data += String(crsCode) + F("</ns0:crs>");
-    if (callingCrsCode[0]) {
-        data += "<ns0:filterCrs>" + String(callingCrsCode) + F("</ns0:filterCrs><ns0:filterType>to</ns0:filterType>");
-    }
-    data += F("</ns0:GetDepBoardWithDetailsRequest></soap-env:Body></soap-env:Envelope>");
+int raildataXmlClient::soapExchange(requestBuilder &request, unsigned long *parseTime) {
+    bool reused = soapClient.connected();
+    bool counted = false;           // A retry on a new connection is the same request as far as the quota goes
+    for (int attempt=0;attempt<2;attempt++) {
+        if (!reused) {
+            soapClient.stop();
+            soapClient.setInsecure();
+            soapClient.setTimeout(15000);
+            soapClient.setNoDelay(false);
+            if (!socketConnect(soapClient, soapHost, 443, 3000)) {
+                lastErrorMessage += F("Timed out, no response from connect");    // No response within 3s
+                return UPD_NO_RESPONSE;
+            }
+            if (!parsingDetails) perf.sample(PERF_HANDSHAKE);
+            connections++;
+        }
 
-    httpsClient.print("POST " + String(soapAPI) + F(" HTTP/1.1\r\n") +
-      F("Host: ") + String(soapHost) + F("\r\n") +
-      F("Content-Type: text/xml;charset=UTF-8\r\n") +
-      F("Connection: close\r\n") +
-      F("Content-Length: ") + String(data.length()) + F("\r\n\r\n") +
-      data + F("\r\n\r\n"));
+        if (!request.send(soapClient)) {
+            soapClient.stop();
+            if (reused) {
+                // The server closed the idle connection, try again on a new one
+                reused = false;
+                continue;
+            }
+            if (request.isValid()) {
+                lastErrorMessage += F("Request not sent");
+                return UPD_NO_RESPONSE;
+            }
+            lastErrorMessage += F("Request too large");
+            return UPD_DATA_ERROR;
+        }
+        if (!counted) {
+            quota.consume(QUOTA_RAIL);
+            counted = true;
+        }
+        if (!parsingDetails) perf.setSendTime(request.sendTime);
 
-    Xcb(1,0);   // progress callback
-    unsigned long ticker = millis()+800;
-    retryCounter = 0;
-    while(!httpsClient.available()) {
-        delay(100);
-        retryCounter++;
-        if (retryCounter >= 30) {
-            lastErrorMessage = F("Timed out (GET)");
+        Xcb(1,0);   // progress callback
+        if (waitForData(soapClient, 3000)) break;
+        soapClient.stop();
+        if (!reused) {
+            lastErrorMessage += F("Timed out (GET)");
             return UPD_TIMEOUT;     // No response within 3s
         }
+        reused = false;
     }
+    if (!parsingDetails) perf.firstByte();
 
+    unsigned long ticker = millis()+800;
+    long contentLength = -1;
+    bool chunked = false;
+    bool keepAlive = true;          // The default for HTTP/1.1
     unsigned long dataSendTimeout = millis() + 1000UL;
-    while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
-        String line = httpsClient.readStringUntil('\n');
+    while((soapClient.available() || soapClient.connected()) && (millis() < dataSendTimeout)) {
+        String line = soapClient.readStringUntil('\n');
         // check for success code...
         if (line.startsWith(F("HTTP"))) {
             if (line.indexOf(F("200 OK")) == -1) {
-                httpsClient.stop();
+                soapClient.stop();
+                lastErrorMessage += line;
                 if (line.indexOf(F("401")) > 0) {
-                    lastErrorMessage = line;
                     return UPD_UNAUTHORISED;
                 } else if (line.indexOf(F("500")) > 0) {
-                    lastErrorMessage = line;
                     return UPD_DATA_ERROR;
                 } else {
-                    lastErrorMessage = line;
                     return UPD_HTTP_ERROR;
                 }
             }
-        } else if (line.startsWith(F("Transfer-Encoding:")) && line.indexOf(F("chunked")) >= 0) bChunked=true;
+            if (line.startsWith(F("HTTP/1.0"))) keepAlive = false;
+        } else {
+            line.toLowerCase();
+            if (line.startsWith(F("content-length:"))) contentLength = line.substring(15).toInt();
+            else if (line.startsWith(F("transfer-encoding:")) && line.indexOf(F("chunked")) >= 0) chunked = true;
+            else if (line.startsWith(F("connection:")) && line.indexOf(F("close")) >= 0) keepAlive = false;
+        }
         if (line == F("\r")) {
             // Headers received
             break;
         }
         yield();
     }
+    if (!chunked && contentLength < 0) keepAlive = false;     // The body ends when the connection closes
 
     xmlStreamingParser parser;
     parser.setListener(this);
     parser.reset();
-    grandParentTagName = "";
-    parentTagName = "";
-    tagName = "";
-    tagLevel = 0;
-    loadingWDSL=false;
-    long dataReceived = 0;
-    if (platforms[0]) {
-        filterPlatforms = true;
-        strcpy(platformFilter,platforms);
-    } else {
-        filterPlatforms = false;
-        strcpy(platformFilter,"");
-    }
-    keepRoute=false;
+    tagDepth = 0;
+    addedStopLocation = false;
 
     char c;
+    long received = 0;
+    long remaining = chunked ? 0 : contentLength;   // Bytes left in the body (or the current chunk)
+    bool complete = (!chunked && !contentLength);
     dataSendTimeout = millis() + 12000UL;
-    perfTimer=millis(); // Reset the data load timer
-    while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
-        while (httpsClient.available()) {
-            c = httpsClient.read();
+    while(!complete && (soapClient.available() || soapClient.connected()) && (millis() < dataSendTimeout)) {
+        unsigned long parseStart = micros();
+        while (!complete && soapClient.available()) {
+            if (chunked && !remaining) {
+                // Chunk size line (skipping the CRLF that ends the previous chunk)
+                String sizeLine = soapClient.readStringUntil('\n');
+                sizeLine.trim();
+                if (!sizeLine.length()) continue;
+                remaining = strtol(sizeLine.c_str(), NULL, 16);
+                if (!remaining) {
+                    // Last chunk, skip any trailers
+                    while (soapClient.connected() || soapClient.available()) {
+                        String trailer = soapClient.readStringUntil('\n');
+                        if (trailer == F("\r") || !trailer.length()) break;
+                    }
+                    complete = true;
+                }
+                continue;
+            }
+            c = soapClient.read();
             parser.parse(c);
-            dataReceived++;
+            received++;
+            if (remaining > 0 && !--remaining && !chunked) complete = true;
             if (millis()>ticker) {
                 Xcb(2,xStation.numServices);    // Callback progress
                 ticker = millis()+800;
             }
-//            yield();
         }
+        *parseTime += micros() - parseStart;
         if (millis()>ticker) {
             Xcb(2,id);      // Callback with progress
             ticker = millis()+800;
         }
-        delay(50);
+        if (!complete) waitForData(soapClient, 100);  // Returns as soon as more data arrives
     }
+    if (!keepAlive || !complete) soapClient.stop();
+    dataReceived += received;
+    totalBytes += received;
 
-    httpsClient.stop();
-    if (bChunked) lastErrorMessage = F("WARNING: Chunked response! ");
     if (millis() >= dataSendTimeout) {
         lastErrorMessage += F("Timed out during data receive operation - ");
-        lastErrorMessage += String(dataReceived) + F(" bytes received");
+        lastErrorMessage += String(received) + F(" bytes received");
         return UPD_TIMEOUT;
     }
+    if (!complete && (chunked || contentLength > 0)) {
+        lastErrorMessage += F("Connection closed during data receive operation - ");
+        lastErrorMessage += String(received) + F(" bytes received");
+        return UPD_INCOMPLETE;
+    }
+    return UPD_SUCCESS;
+}
+
+//
+// Fetches the calling points and formation of a single service (used for the first service on the board)
+//
+int raildataXmlClient::updateServiceDetails(const char *customToken, const char *serviceId, unsigned long *parseTime) {
+    strcpy(detailsServiceId,"");
+    strcpy(detailsCalling,"");
+    detailsClasses=0;
+    detailsCoaches=0;
+    detailsLength=0;
+
+    char requestBuffer[768];
+    requestBuilder request(requestBuffer,sizeof(requestBuffer));
+    beginSoapBody(request,customToken);
+    request.add(F("<ns0:GetServiceDetailsRequest xmlns:ns0=\"http://thalesgroup.com/RTTI/2021-11-01/ldb/\"><ns0:serviceID>")).addXml(serviceId).add(F("</ns0:serviceID></ns0:GetServiceDetailsRequest>"));
+    endSoapBody(request);
+
+    parsingDetails = true;
+    detailsRequests++;
+    int result = soapExchange(request, parseTime);
+    parsingDetails = false;
+    if (result != UPD_SUCCESS) return result;
+
+    removeHtmlTags(detailsCalling);
+    replaceWord(detailsCalling,"&amp;","&");
+    if (!detailsLength) detailsLength = detailsCoaches;
+    strlcpy(detailsServiceId,serviceId,sizeof(detailsServiceId));
+    detailsAge = 0;
+    return UPD_SUCCESS;
+}
+
+//
+// Updates the Departure Board data from the SOAP API. Routine refreshes use the lightweight GetDepartureBoard request,
+// the calling points and formation are only requested (via GetServiceDetails) when the first service or its departure
+// changes, or they're RAIL_DETAILSREFRESH refreshes old.
+//
+int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, const serviceFilter &platforms) {
+    const char *crsCodes[1] = { crsCode };
+    return updateDepartures(station, messages, crsCodes, 1, customToken, numRows, includeBusServices, callingCrsCode, platforms);
+}
+
+//
+// Removes incomplete services (and bus services if they're not wanted) from the board
+//
+void raildataXmlClient::pruneServices(bool includeBusServices) {
+    int i=0;
+    while (i<xStation.numServices) {
+        if (!xStation.service[i].destination[0] || !xStation.service[i].etd[0] || !xStation.service[i].sTime[0] || (!includeBusServices && xStation.service[i].serviceType == BUS)) deleteService(i);
+        else i++;
+    }
+}
+
+//
+// Merges the services from another station into the board in time order. A train calling at more than one of the
+// stations (same rsid) is only shown once, at the station it leaves first. Services without an rsid (buses and
+// some operators) are taken to be the same train when the scheduled time, destination and operator all match.
+//
+void raildataXmlClient::mergeServices() {
+    std::stable_sort(xStation.service, xStation.service+xStation.numServices, compareTimes);
+    int i=1;
+    while (i<xStation.numServices) {
+        bool duplicate = false;
+        for (int j=0;j<i && !duplicate;j++) {
+            if (xStation.service[i].rsid[0]) duplicate = !strcmp(xStation.service[i].rsid,xStation.service[j].rsid);
+            else duplicate = !strcmp(xStation.service[i].sTime,xStation.service[j].sTime) && !strcmp(xStation.service[i].destination,xStation.service[j].destination) && !strcmp(xStation.service[i].opco,xStation.service[j].opco);
+        }
+        if (duplicate) {
+            deleteService(i);
+            mergedDuplicates++;
+        } else i++;
+    }
+    if (xStation.numServices > MAXBOARDSERVICES) xStation.numServices = MAXBOARDSERVICES;
+}
 
-    if (!xStation.location[0]) {
-        // We didn't get a location back so probably failed
-        lastErrorMessage += F("Data incomplete - no location in response");
+//
+// Updates the board from up to RAILMAXSTATIONS stations. All the requests share one connection and each station's
+// services are merged into the board as soon as they are parsed, so only two stations' services are held at once.
+//
+int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *messages, const char *crsCodes[], int numStations, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, const serviceFilter &platforms) {
+
+    unsigned long perfTimer=millis();
+    lastErrorMessage = "";
+    if (numStations > RAILMAXSTATIONS) numStations = RAILMAXSTATIONS;
+    if (numStations < 1) {
+        lastErrorMessage += F("No station");
         return UPD_DATA_ERROR;
     }
-    if (filterPlatforms && !keepRoute && xStation.numServices) xStation.numServices--;   // Last route added needs filtering out
 
+    // Reset the counters
+    xStation.numServices=0;
+    xMessages.numMessages=0;
+    xStation.platformAvailable=false;
+    strcpy(xStation.location,"");
+
+    for (int i=0;i<MAXBOARDMESSAGES;i++) strcpy(xMessages.messages[i],"");
+    dataReceived = 0;
+    if (!statsStart) statsStart = millis();
+
+    perf.begin(PERF_RAIL);
+
+    int reqRows = numRows;
+    if (reqRows > MAXBOARDSERVICES) reqRows = MAXBOARDSERVICES;
+    if (!platforms.isEmpty()) reqRows = RAIL_FILTERROWS;   // Request more services if we're filtering platforms
+
+    loadingWDSL=false;
+    parsingDetails=false;
+    filterPlatforms = !platforms.isEmpty();
+    platformFilter = &platforms;
+
+    unsigned long parseTime = 0;    // Time spent reading and parsing (us), excludes waiting for data
+    for (int stn=0;stn<numStations;stn++) {
+        char requestBuffer[1024];
+        requestBuilder request(requestBuffer,sizeof(requestBuffer));
+        beginSoapBody(request,customToken);
+        request.add(F("<ns0:GetDepartureBoardRequest xmlns:ns0=\"http://thalesgroup.com/RTTI/2021-11-01/ldb/\"><ns0:numRows>"));
+        request.add((long)reqRows).add(F("</ns0:numRows><ns0:crs>")).addXml(crsCodes[stn]).add(F("</ns0:crs>"));
+        if (callingCrsCode[0]) {
+            request.add(F("<ns0:filterCrs>")).addXml(callingCrsCode).add(F("</ns0:filterCrs><ns0:filterType>to</ns0:filterType>"));
+        }
+        request.add(F("<ns0:timeWindow>")).add((long)RAIL_TIMEWINDOW).add(F("</ns0:timeWindow></ns0:GetDepartureBoardRequest>"));
+        endSoapBody(request);
+
+        // This station's services go after those already on the board
+        for (int i=xStation.numServices;i<RAILMAXREADSERVICES;i++) clearService(i);
+        id=xStation.numServices-1;
+        serviceLimit=xStation.numServices+MAXBOARDSERVICES;
+        coaches=0;
+        keepRoute=false;
+        skipDepth=0;
+        gotLocation=false;
+
+        int merged = xStation.numServices;
+        boardRequests++;
+        int result = soapExchange(request, &parseTime);
+        if (result == UPD_SUCCESS && !gotLocation) {
+            // We didn't get a location back so probably failed
+            lastErrorMessage += F("Data incomplete - no location in response");
+            result = UPD_DATA_ERROR;
+        }
+        if (result != UPD_SUCCESS) {
+            soapClient.stop();
+            if (!stn) return result;
+            // An extra station failed, drop whatever was read of it and keep the board from the others
+            for (int i=merged;i<xStation.numServices;i++) clearService(i);
+            xStation.numServices = merged;
+            lastErrorMessage += " (" + String(crsCodes[stn]) + F(" unavailable, board incomplete) ");
+            partialBoards++;
+            continue;
+        }
+
+        pruneServices(includeBusServices);
+        if (stn) {
+            mergeServices();
+        } else if (includeBusServices) {
+            // Look for any included bus services, and sort if found
+            for (int i=0;i<xStation.numServices;i++) {
+                if (xStation.service[i].serviceType == BUS) {
+                    std::stable_sort(xStation.service, xStation.service+xStation.numServices, compareTimes);
+                    break;
+                }
+            }
+        }
+    }
+    perf.sample(PERF_PARSED);
+    totalParseTime += parseTime;
+
+    unsigned long sanitiseTime = micros();
     sanitiseData();
-    if (includeBusServices) {
-        // Look for any included bus services, and sort if found
-        for (int i=0;i<xStation.numServices;i++) {
-            if (xStation.service[i].serviceType == BUS) {
-                size_t arraySize = xStation.numServices;
-                std::sort(xStation.service, xStation.service+arraySize,compareTimes);
-                break;
+    sanitiseTime = micros() - sanitiseTime;
+
+    // Only the first service shows calling points and formation. Fetch these when it changes, when its departure
+    // changes (a delay moves the calling times too) and every RAIL_DETAILSREFRESH refreshes to pick up anything else.
+    if (xStation.numServices && xStation.service[0].serviceId[0]) {
+        detailsAge++;
+        bool departureChanged = strcmp(station->service[0].etd,xStation.service[0].etd) || strcmp(station->service[0].platform,xStation.service[0].platform) || station->service[0].isCancelled != xStation.service[0].isCancelled;
+        if (strcmp(xStation.service[0].serviceId,detailsServiceId) || departureChanged || detailsAge >= RAIL_DETAILSREFRESH) {
+            if (updateServiceDetails(customToken,xStation.service[0].serviceId,&parseTime) != UPD_SUCCESS) {
+                lastErrorMessage += F(" (service details unavailable) ");
             }
         }
-    } else {
-        // Go through and delete any bus services
-        int i=0;
-        while (i<xStation.numServices) {
-            // Remove any bus services
-            if (xStation.service[i].serviceType == BUS) deleteService(i);
-            else i++;
+        if (!strcmp(xStation.service[0].serviceId,detailsServiceId)) {
+            xStation.service[0].classesAvailable |= detailsClasses;
+            if (!xStation.service[0].trainLength) xStation.service[0].trainLength = detailsLength;
         }
     }
+    soapClient.stop();
+    const char *firstCalling = (xStation.numServices && !strcmp(xStation.service[0].serviceId,detailsServiceId)) ? detailsCalling : "";
 
     bool noUpdate = true;
     if (!firstDataLoad) {
@@ -456,6 +561,7 @@ int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *message
                     }
                 }
             }
+            if (noUpdate && xStation.numServices && strcmp(station->calling,firstCalling)) noUpdate=false;
         }
     } else {
         firstDataLoad=false;
@@ -483,26 +589,85 @@ int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *message
             station->service[i].serviceType = xStation.service[i].serviceType;
         }
         if (xStation.numServices) {
-            strcpy(station->calling,xStation.service[0].calling);
+            strcpy(station->calling,firstCalling);
             strcpy(station->origin,xStation.service[0].origin);
             strcpy(station->serviceMessage,xStation.service[0].serviceMessage);
         }
     }
 
+    perf.sample(PERF_COPIED);
     Xcb(3,xStation.numServices);
+    totalRefreshTime += millis()-perfTimer;
+    refreshes++;
     if (noUpdate) {
         lastErrorMessage += "Success (No Changes) - data [" + String(dataReceived) + F("] load took ") + String(millis()-perfTimer) + F("ms");
-        return UPD_NO_CHANGE;
     } else {
         lastErrorMessage += "Success - data [" + String(dataReceived) + F("] took ") + String(millis()-perfTimer) + F("ms");
-        return UPD_SUCCESS;
     }
+    // Parser throughput (bytes/s) and sanitise time for performance monitoring
+    lastErrorMessage += " (parse " + String(parseTime/1000) + F("ms, ");
+    if (parseTime) lastErrorMessage += String((unsigned long)((dataReceived * 1000000ULL) / parseTime)) + F(" bytes/s, ");
+    lastErrorMessage += "sanitise " + String(sanitiseTime) + F("us)");
+    return noUpdate ? UPD_NO_CHANGE : UPD_SUCCESS;
+}
+
+//
+// Data usage since the first update, extrapolated to an hour (used by /info)
+//
+String raildataXmlClient::getUsageStats() {
+    if (!statsStart || !boardRequests) return F("no requests yet");
+    unsigned long elapsed = millis() - statsStart;
+    if (elapsed < 60000UL) elapsed = 60000UL;   // Don't extrapolate from less than a minute
+    String stats = String((unsigned long)((totalBytes * 3600000ULL) / elapsed)) + F(" bytes/hour, ");
+    stats += String((unsigned long)(((boardRequests + detailsRequests) * 3600000ULL) / elapsed)) + F(" requests/hour (") + String(boardRequests) + F(" board, ") + String(detailsRequests) + F(" details)");
+    if (refreshes) stats += ", avg refresh " + String(totalRefreshTime / refreshes) + F("ms, avg board parse ") + String((unsigned long)(totalParseTime / boardRequests)) + F("us");
+    if (connections) stats += ", " + String((float)(boardRequests + detailsRequests) / connections,1) + F(" requests per connection");
+    if (mergedDuplicates) stats += ", " + String(mergedDuplicates) + F(" duplicate services merged");
+    if (partialBoards) stats += ", " + String(partialBoards) + F(" stations left off the board");
+    if (discardedServices) stats += ", " + String(discardedServices) + F(" services filtered out");
+    return stats;
 }
 
 String raildataXmlClient::getLastError() {
     return lastErrorMessage;
 }
 
+// Host the departures are fetched from (from the WSDL)
+const char *raildataXmlClient::getHost() {
+    return soapHost;
+}
+
+// Empty a service slot so it can be reused
+void raildataXmlClient::clearService(int x) {
+    strcpy(xStation.service[x].sTime,"");
+    strcpy(xStation.service[x].destination,"");
+    strcpy(xStation.service[x].via,"");
+    strcpy(xStation.service[x].origin,"");
+    strcpy(xStation.service[x].etd,"");
+    strcpy(xStation.service[x].platform,"");
+    strcpy(xStation.service[x].opco,"");
+    strcpy(xStation.service[x].serviceMessage,"");
+    strcpy(xStation.service[x].serviceId,"");
+    strcpy(xStation.service[x].rsid,"");
+    xStation.service[x].trainLength=0;
+    xStation.service[x].classesAvailable=0;
+    xStation.service[x].serviceType=0;
+    xStation.service[x].isCancelled=false;
+    xStation.service[x].isDelayed=false;
+}
+
+//
+// Drop the service being parsed (it failed the platform filter) and skip the rest of its elements
+//
+void raildataXmlClient::discardService(int serviceDepth) {
+    clearService(id);
+    xStation.numServices--;
+    id--;
+    coaches=0;
+    skipDepth = serviceDepth;
+    discardedServices++;
+}
+
 void raildataXmlClient::deleteService(int x) {
 
   if (x==xStation.numServices-1) {
@@ -519,13 +684,6 @@ void raildataXmlClient::deleteService(int x) {
 
 void raildataXmlClient::sanitiseData() {
 
-  int i=0;
-  while (i<xStation.numServices) {
-    // Remove any services that are missing destinations/std/etd
-    if (!xStation.service[i].destination[0] || !xStation.service[i].etd[0] || !xStation.service[i].sTime[0]) deleteService(i);
-    else i++;
-  }
-
   // Issue #5 - Ampersands in Station Location
   removeHtmlTags(xStation.location);
   replaceWord(xStation.location,"&amp;","&");
@@ -534,8 +692,6 @@ void raildataXmlClient::sanitiseData() {
     // first change any &lt; &gt;
     removeHtmlTags(xStation.service[i].destination);
     replaceWord(xStation.service[i].destination,"&amp;","&");
-    removeHtmlTags(xStation.service[i].calling);
-    replaceWord(xStation.service[i].calling,"&amp;","&");
     removeHtmlTags(xStation.service[i].via);
     replaceWord(xStation.service[i].via,"&amp;","&");
     removeHtmlTags(xStation.service[i].serviceMessage);
@@ -572,139 +728,168 @@ void raildataXmlClient::sanitiseData() {
   }
 }
 
+//
+// Tags are tracked by their local name, the namespace prefixes vary between requests and schema versions
+//
 void raildataXmlClient::startTag(const char *tag)
 {
-    tagLevel++;
-    grandParentTagName = parentTagName;
-    parentTagName = tagName;
-    tagName = String(tag);
-    tagPath = grandParentTagName + "/" + parentTagName + "/" + tagName;
+    const char *localName = strchr(tag,':');
+    if (tagDepth < MAXTAGDEPTH) strlcpy(tagStack[tagDepth],localName ? localName+1 : tag,MAXTAGNAMESIZE);
+    tagDepth++;
+    if (skipDepth || loadingWDSL || parsingDetails) return;
+
+    if (isServiceTag()) {
+        // Starting a new service, skip it entirely once the board is full
+        if (id >= serviceLimit-1) {
+            skipDepth = tagDepth;
+            return;
+        }
+        id++;
+        xStation.numServices++;
+        keepRoute = false;
+        coaches = 0;
+    }
 }
 
 void raildataXmlClient::endTag(const char *tag)
 {
-    tagLevel--;
-    tagName = parentTagName;
-    parentTagName=grandParentTagName;
-    grandParentTagName="??";
+    if (skipDepth) {
+        // Still inside a discarded service?
+        if (tagDepth == skipDepth) skipDepth = 0;
+    } else if (!loadingWDSL && !parsingDetails && id>=0 && isServiceTag()) {
+        // End of a service we're keeping so far
+        if (filterPlatforms && !keepRoute) discardService(0);     // No platform given
+        else if (xStation.service[id].trainLength == 0) xStation.service[id].trainLength = coaches;
+    }
+    if (tagDepth) tagDepth--;
 }
 
-void raildataXmlClient::parameter(const char *param)
+//
+// Checks the name of the current tag (up=0) or one of its ancestors (up=1 parent, up=2 grandparent...)
+//
+bool raildataXmlClient::isTag(int up, const char *name)
 {
+    int i = tagDepth - 1 - up;
+    if (i < 0 || i >= MAXTAGDEPTH) return false;
+    return strcmp(tagStack[i],name) == 0;
 }
 
-void raildataXmlClient::value(const char *value)
+// Is the current tag a service on the departure board?
+bool raildataXmlClient::isServiceTag()
 {
-    if (loadingWDSL) return;
+    return isTag(0,"service") && (isTag(1,"trainServices") || isTag(1,"busServices") || isTag(1,"ferryServices"));
+}
 
-    if (tagLevel<6 || tagLevel==9 || tagLevel>11) return;
+void raildataXmlClient::parameter(const char *param)
+{
+}
 
-    if (tagLevel == 11 && tagPath.endsWith(F("callingPoint/lt8:locationName"))) {
-        if ((strlen(xStation.service[id].calling) + strlen(value) + 13) < sizeof(xStation.service[0].calling)) {
-            // Add the calling point, add a comma prefix if this isn't the first one
-            if (xStation.service[id].calling[0]) strcat(xStation.service[id].calling,", ");
-            strcat(xStation.service[id].calling,value);
-            addedStopLocation = true;
-        }
-        return;
-    } else if (tagLevel == 11 && tagPath.endsWith(F("callingPoint/lt8:st")) && addedStopLocation) {
-        // check there's still room to add the eta of the calling point
-        if ((strlen(xStation.service[id].calling) + strlen(value) + 4) < sizeof(xStation.service[0].calling)) {
-            strcat(xStation.service[id].calling," (");
-            strcat(xStation.service[id].calling,value);
-            strcat(xStation.service[id].calling,")");
+void raildataXmlClient::value(const char *value)
+{
+    if (loadingWDSL || skipDepth) return;
+
+    if (isTag(1,"callingPoint")) {
+        // Only the calling points after this station are shown (callingPoint/callingPointList/previousCallingPoints)
+        if (isTag(3,"previousCallingPoints") || !parsingDetails) return;
+        char *calling = detailsCalling;
+        if (isTag(0,"locationName")) {
+            if ((strlen(calling) + strlen(value) + 13) < MAXCALLINGSIZE) {
+                // Add the calling point, add a comma prefix if this isn't the first one
+                if (calling[0]) strcat(calling,", ");
+                strcat(calling,value);
+                addedStopLocation = true;
+            }
+        } else if (isTag(0,"st") && addedStopLocation) {
+            // check there's still room to add the eta of the calling point
+            if ((strlen(calling) + strlen(value) + 4) < MAXCALLINGSIZE) {
+                strcat(calling," (");
+                strcat(calling,value);
+                strcat(calling,")");
+            }
+            addedStopLocation = false;
         }
-        addedStopLocation = false;
-        return;
-    } else if (tagLevel == 11 && tagName == F("lt7:coachClass")) {
-        if (strcmp(value,"First")==0) xStation.service[id].classesAvailable = xStation.service[id].classesAvailable | 1;
-        else if (strcmp(value,"Standard")==0) xStation.service[id].classesAvailable = xStation.service[id].classesAvailable | 2;
-        coaches++;
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:length")) {
-        xStation.service[id].trainLength = String(value).toInt();
         return;
-    } else if (tagLevel == 8 && tagName == F("lt4:operator")) {
-        strncpy(xStation.service[id].opco,value,sizeof(xStation.service[0].opco)-1);
-        xStation.service[id].opco[sizeof(xStation.service[0].opco)-1] = '\0';
+    } else if (isTag(0,"coachClass")) {
+        if (!parsingDetails && id<0) return;
+        byte *classes = parsingDetails ? &detailsClasses : &xStation.service[id].classesAvailable;
+        if (strcmp(value,"First")==0) *classes = *classes | 1;
+        else if (strcmp(value,"Standard")==0) *classes = *classes | 2;
+        if (parsingDetails) detailsCoaches++; else coaches++;
         return;
-    } else if (tagLevel == 10 && tagPath.startsWith(F("lt5:origin/lt4:location/lt4:loc"))) {
-        strncpy(xStation.service[id].origin,value,sizeof(xStation.service[0].origin)-1);
-        xStation.service[id].origin[sizeof(xStation.service[0].origin)-1] = '\0';
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:serviceType")) {
-        if (strcmp(value,"train")==0) xStation.service[id].serviceType = TRAIN;
-        else if (strcmp(value,"bus")==0) xStation.service[id].serviceType = BUS;
+    }
+
+    if (parsingDetails) {
+        // GetServiceDetails response, everything else comes from the board
+        if (isTag(1,"GetServiceDetailsResult") && isTag(0,"length")) detailsLength = String(value).toInt();
         return;
-    } else if (tagLevel == 8 && tagName == F("lt4:std")) {
-        // Starting a new service
-        // If we're filtering on platform numbers, check if we need to keep the previous service (if there was one)
-        if (filterPlatforms && !keepRoute && id>=0) {
-            // We don't want this service, so clear it
-            strcpy(xStation.service[id].sTime,"");
-            strcpy(xStation.service[id].destination,"");
-            strcpy(xStation.service[id].via,"");
-            strcpy(xStation.service[id].origin,"");
-            strcpy(xStation.service[id].etd,"");
-            strcpy(xStation.service[id].platform,"");
-            strcpy(xStation.service[id].opco,"");
-            strcpy(xStation.service[id].calling,"");
-            strcpy(xStation.service[id].serviceMessage,"");
-            xStation.service[id].trainLength=0;
-            xStation.service[id].classesAvailable=0;
-            xStation.service[id].serviceType=0;
-            xStation.service[id].isCancelled=false;
-            xStation.service[id].isDelayed=false;
-            xStation.numServices--;
-            id--;
-        }
-        keepRoute = false;  // reset for next route
-        if (id>=0) {
-            if (xStation.service[id].trainLength == 0) xStation.service[id].trainLength = coaches;
-        }
-        coaches=0;
-        if (id < MAXBOARDSERVICES-1) {
-            id++;
-            xStation.numServices++;
+    }
+
+    if (isTag(1,"service")) {
+        if (id<0) return;
+        if (isTag(0,"std")) {
+            strncpy(xStation.service[id].sTime,value,sizeof(xStation.service[0].sTime));
+            xStation.service[id].sTime[sizeof(xStation.service[0].sTime)-1] = '\0';
+        } else if (isTag(0,"etd")) {
+            strncpy(xStation.service[id].etd,value,sizeof(xStation.service[0].etd));
+            xStation.service[id].etd[sizeof(xStation.service[0].etd)-1] = '\0';
+        } else if (isTag(0,"platform")) {
+            strncpy(xStation.service[id].platform,value,sizeof(xStation.service[0].platform)-1);
+            xStation.service[id].platform[sizeof(xStation.service[0].platform)-1] = '\0';
+            if (filterPlatforms) {
+                // Decide as soon as the platform is known, a rejected service's remaining elements are skipped
+                if (platformFilter->matches(xStation.service[id].platform)) keepRoute=true;
+                else discardService(tagDepth-1);
+            }
+        } else if (isTag(0,"operator")) {
+            strncpy(xStation.service[id].opco,value,sizeof(xStation.service[0].opco)-1);
+            xStation.service[id].opco[sizeof(xStation.service[0].opco)-1] = '\0';
+        } else if (isTag(0,"serviceType")) {
+            if (strcmp(value,"train")==0) xStation.service[id].serviceType = TRAIN;
+            else if (strcmp(value,"bus")==0) xStation.service[id].serviceType = BUS;
+        } else if (isTag(0,"length")) {
+            xStation.service[id].trainLength = String(value).toInt();
+        } else if (isTag(0,"delayReason")) {
+            strncpy(xStation.service[id].serviceMessage,value,sizeof(xStation.service[0].serviceMessage)-1);
+            xStation.service[id].serviceMessage[sizeof(xStation.service[0].serviceMessage)-1] = '\0';
+            xStation.service[id].isDelayed = true;
+        } else if (isTag(0,"cancelReason")) {
+            strncpy(xStation.service[id].serviceMessage,value,sizeof(xStation.service[0].serviceMessage)-1);
+            xStation.service[id].serviceMessage[sizeof(xStation.service[0].serviceMessage)-1] = '\0';
+            xStation.service[id].isCancelled = true;
+        } else if (isTag(0,"serviceID")) {
+            strlcpy(xStation.service[id].serviceId,value,sizeof(xStation.service[0].serviceId));
+        } else if (isTag(0,"rsid")) {
+            strlcpy(xStation.service[id].rsid,value,sizeof(xStation.service[0].rsid));
         }
-        strncpy(xStation.service[id].sTime,value,sizeof(xStation.service[0].sTime));
-        xStation.service[id].sTime[sizeof(xStation.service[0].sTime)-1] = '\0';
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:etd")) {
-        strncpy(xStation.service[id].etd,value,sizeof(xStation.service[0].etd));
-        xStation.service[id].etd[sizeof(xStation.service[0].etd)-1] = '\0';
-        return;
-    } else if (tagLevel == 10 && tagPath.startsWith(F("lt5:destination/lt4:location/lt4:lo"))) {
-        strncpy(xStation.service[id].destination,value,sizeof(xStation.service[0].destination)-1);
-        xStation.service[id].destination[sizeof(xStation.service[0].destination)-1] = '\0';
-        return;
-    } else if (tagLevel == 10 && tagPath == F("lt5:destination/lt4:location/lt4:via")) {
-        strncpy(xStation.service[id].via,value,sizeof(xStation.service[0].via)-1);
-        xStation.service[id].via[sizeof(xStation.service[0].via)-1] = '\0';
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:delayReason")) {
-        strncpy(xStation.service[id].serviceMessage,value,sizeof(xStation.service[0].serviceMessage)-1);
-        xStation.service[id].serviceMessage[sizeof(xStation.service[0].serviceMessage)-1] = '\0';
-        xStation.service[id].isDelayed = true;
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:cancelReason")) {
-        strncpy(xStation.service[id].serviceMessage,value,sizeof(xStation.service[0].serviceMessage)-1);
-        xStation.service[id].serviceMessage[sizeof(xStation.service[0].serviceMessage)-1] = '\0';
-        xStation.service[id].isCancelled = true;
         return;
-    } else if (tagLevel == 8 && tagName == (F("lt4:platform"))) {
-        strncpy(xStation.service[id].platform,value,sizeof(xStation.service[0].platform)-1);
-        xStation.service[id].platform[sizeof(xStation.service[0].platform)-1] = '\0';
-        if (filterPlatforms && serviceMatchesFilter(platformFilter,xStation.service[id].platform)) keepRoute=true;
-        return;
-    } else if (tagLevel == 6 && tagName == F("lt4:locationName")) {
-        strncpy(xStation.location,value,sizeof(xStation.location)-1);
-        xStation.location[sizeof(xStation.location)-1] = '\0';
+    } else if (isTag(1,"location") && isTag(3,"service") && id>=0) {
+        if (isTag(2,"origin") && isTag(0,"locationName")) {
+            strncpy(xStation.service[id].origin,value,sizeof(xStation.service[0].origin)-1);
+            xStation.service[id].origin[sizeof(xStation.service[0].origin)-1] = '\0';
+        } else if (isTag(2,"destination") && isTag(0,"locationName")) {
+            strncpy(xStation.service[id].destination,value,sizeof(xStation.service[0].destination)-1);
+            xStation.service[id].destination[sizeof(xStation.service[0].destination)-1] = '\0';
+        } else if (isTag(2,"destination") && isTag(0,"via")) {
+            strncpy(xStation.service[id].via,value,sizeof(xStation.service[0].via)-1);
+            xStation.service[id].via[sizeof(xStation.service[0].via)-1] = '\0';
+        }
         return;
-    } else if (tagLevel == 6 && tagName == F("lt4:platformAvailable")) {
-        if (strcmp(value,"true")==0) xStation.platformAvailable = true;
+    } else if (isTag(1,"GetStationBoardResult")) {
+        if (isTag(0,"locationName")) {
+            // The board is named after the first station
+            gotLocation = true;
+            if (!xStation.location[0]) {
+                strncpy(xStation.location,value,sizeof(xStation.location)-1);
+                xStation.location[sizeof(xStation.location)-1] = '\0';
+            }
+        } else if (isTag(0,"platformAvailable")) {
+            if (strcmp(value,"true")==0) xStation.platformAvailable = true;
+        }
         return;
-    } else if (tagPath.endsWith(F("nrccMessages/lt:message"))) {    // tagLevel 7
+    } else if (isTag(1,"nrccMessages") && isTag(0,"message")) {
+        for (int i=0;i<xMessages.numMessages;i++) {
+            if (!strncmp(xMessages.messages[i],value,sizeof(xMessages.messages[0])-1)) return;    // Already shown for another station
+        }
         if (xMessages.numMessages < MAXBOARDMESSAGES) {
             xMessages.numMessages++;
             strncpy(xMessages.messages[xMessages.numMessages-1],value,sizeof(xMessages.messages[0])-1);
@@ -717,7 +902,7 @@ void raildataXmlClient::value(const char *value)
 void raildataXmlClient::attribute(const char *attr)
 {
     if (loadingWDSL) {
-        if (tagName == F("soap:address")) {
+        if (isTag(0,"address")) {
             String myURL = String(attr);
             if (myURL.startsWith(F("location=\"")) && myURL.endsWith(F("\""))) {
                 soapURL = myURL.substring(10,myURL.length()-1);
@@ -13,12 +13,24 @@
 #include <xmlListener.h>
 #include <xmlStreamingParser.h>
 #include <stationData.h>
+#include <requestBuilder.h>
+#include <serviceFilter.h>
+#include <WiFiClientSecure.h>
 
 typedef void (*rdCallback) (int state, int id);
 
 #define MAXHOSTSIZE 48
 #define MAXAPIURLSIZE 48
 #define MAXPLATFORMFILTERSIZE 25
+#define MAXSERVICEIDSIZE 24
+#define MAXTAGDEPTH 14
+#define MAXTAGNAMESIZE 32
+#define RAIL_TIMEWINDOW 120     // Minutes ahead to request services for
+#define RAIL_FILTERROWS 15      // Services to request when filtering by platform
+#define RAILMAXSTATIONS 3       // Most stations that can be merged onto one board
+#define RAILMAXREADSERVICES (MAXBOARDSERVICES*2)    // The board plus the services of the station being merged
+#define MAXRSIDSIZE 10
+#define RAIL_DETAILSREFRESH 5   // Board refreshes before the first service's details are fetched again anyway
 
 
 class raildataXmlClient: public xmlListener {
@@ -37,26 +49,29 @@ class raildataXmlClient: public xmlListener {
           int trainLength;
           byte classesAvailable;
           char opco[50];
-          char calling[MAXCALLINGSIZE];
           char serviceMessage[MAXMESSAGESIZE];
           int serviceType;
+          char serviceId[MAXSERVICEIDSIZE];
+          char rsid[MAXRSIDSIZE];             // Retail service id, the same at every station the train calls at
         };
 
         struct rdiStation {
           char location[MAXLOCATIONSIZE];
           bool platformAvailable;
           int numServices;
-          rdiService service[MAXBOARDSERVICES];
+          rdiService service[RAILMAXREADSERVICES];
         };
 
-        String grandParentTagName = "";
-        String parentTagName = "";
-        String tagName = "";
-        String tagPath = "";
-        int tagLevel = 0;
+        char tagStack[MAXTAGDEPTH][MAXTAGNAMESIZE];
+        int tagDepth = 0;
+        int skipDepth = 0;                  // Depth of a service being skipped (0 when not skipping)
         bool loadingWDSL=false;
+        bool parsingDetails=false;
+        bool gotLocation=false;
+        int serviceLimit=MAXBOARDSERVICES;  // Slots this station's services can use
+        WiFiClientSecure soapClient;
         String soapURL = "";
-        char soapHost[MAXHOSTSIZE];
+        char soapHost[MAXHOSTSIZE] = "";
         char soapAPI[MAXAPIURLSIZE];
 
         String currentPath = "";
@@ -66,12 +81,35 @@ class raildataXmlClient: public xmlListener {
         bool addedStopLocation = false;
         int id=0;
         int coaches=0;
+        long dataReceived = 0;
+
+        // Calling points and formation of the first service, refreshed when it or its departure changes and every
+        // RAIL_DETAILSREFRESH board refreshes
+        char detailsServiceId[MAXSERVICEIDSIZE] = "";
+        char detailsCalling[MAXCALLINGSIZE];
+        byte detailsClasses = 0;
+        int detailsCoaches = 0;
+        int detailsLength = 0;
+        int detailsAge = 0;             // Board refreshes since the details were fetched
+
+        // Data usage
+        unsigned long statsStart = 0;
+        unsigned long long totalBytes = 0;
+        unsigned long boardRequests = 0;
+        unsigned long detailsRequests = 0;
+        unsigned long refreshes = 0;
+        unsigned long totalRefreshTime = 0;
+        unsigned long long totalParseTime = 0;
+        unsigned long discardedServices = 0;
+        unsigned long mergedDuplicates = 0;
+        unsigned long partialBoards = 0;    // Extra stations that failed and were left off the board
+        unsigned long connections = 0;
 
         String lastErrorMessage = "";
         bool firstDataLoad;
         bool endXml;
 
-        char platformFilter[MAXPLATFORMFILTERSIZE];
+        const serviceFilter *platformFilter = nullptr;
         bool filterPlatforms = false;
         bool keepRoute = false;
 
@@ -82,10 +120,17 @@ class raildataXmlClient: public xmlListener {
         void pruneFromPhrase(char* input, const char* target);
         void fixFullStop(char* input);
         void sanitiseData();
+        void clearService(int x);
+        void discardService(int serviceDepth);
         void deleteService(int x);
-        void trim(char* &start, char* &end);
-        bool equalsIgnoreCase(const char* a, int a_len, const char* b);
-        bool serviceMatchesFilter(const char* filter, const char* serviceId);
+        void pruneServices(bool includeBusServices);
+        void mergeServices();
+        bool isTag(int up, const char *name);
+        bool isServiceTag();
+        void beginSoapBody(requestBuilder &request, const char *customToken);
+        void endSoapBody(requestBuilder &request);
+        int soapExchange(requestBuilder &request, unsigned long *parseTime);
+        int updateServiceDetails(const char *customToken, const char *serviceId, unsigned long *parseTime);
 
         virtual void startTag(const char *tagName);
         virtual void endTag(const char *tagName);
@@ -96,7 +141,9 @@ class raildataXmlClient: public xmlListener {
     public:
         raildataXmlClient();
         int init(const char *wsdlHost, const char *wsdlAPI, rdCallback RDcb);
-        void cleanFilter(const char* rawFilter, char* cleanedFilter, size_t maxLen);
-        int updateDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, const char *platforms);
+        int updateDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, const serviceFilter &platforms);
+        int updateDepartures(rdStation *station, stnMessages *messages, const char *crsCodes[], int numStations, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, const serviceFilter &platforms);
         String getLastError();
+        const char *getHost();
+        String getUsageStats();
 };
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Refresh Scheduler Library - chooses the interval to the next data update from the state of the board
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <refreshScheduler.h>
+#include <apiQuota.h>
+
+refreshScheduler::refreshScheduler(unsigned long base) {
+    setBaseInterval(base);
+}
+
+// The user selected (or default) refresh interval for the board
+void refreshScheduler::setBaseInterval(unsigned long base) {
+    baseInterval = (base < REFRESH_MIN) ? REFRESH_MIN : base;
+}
+
+// The API whose request budget should stretch the interval when it's running low
+void refreshScheduler::setQuotaApi(int api) {
+    quotaApi = api;
+}
+
+void refreshScheduler::applyQuota() {
+    if (quotaApi < 0) return;
+    unsigned long stretched = quota.stretch(quotaApi, interval);
+    if (stretched > interval) {
+        interval = stretched;
+        strlcat(reason,", budget low",sizeof(reason));
+    }
+}
+
+//
+// Interval after a successful update. minutesToDeparture is -1 if unknown, hour is -1 if the clock isn't set.
+//
+unsigned long refreshScheduler::success(bool changed, int minutesToDeparture, int numServices, int hour) {
+    failures = 0;
+
+    if (!numServices) {
+        if (hour >= REFRESH_NIGHTSTART && hour < REFRESH_NIGHTEND) {
+            interval = REFRESH_OVERNIGHT;
+            strlcpy(reason,"no services overnight",sizeof(reason));
+        } else {
+            interval = (baseInterval > REFRESH_NOSERVICES) ? baseInterval : REFRESH_NOSERVICES;
+            strlcpy(reason,"no services",sizeof(reason));
+        }
+    } else if (minutesToDeparture >= 0 && minutesToDeparture <= REFRESH_DUEMINUTES) {
+        interval = (baseInterval < REFRESH_DUE) ? baseInterval : REFRESH_DUE;
+        snprintf(reason,sizeof(reason),"departure due in %d min",minutesToDeparture);
+    } else if (changed) {
+        interval = baseInterval / 2;
+        if (interval < REFRESH_MIN) interval = REFRESH_MIN;
+        strlcpy(reason,"board changing",sizeof(reason));
+    } else {
+        interval = baseInterval;
+        strlcpy(reason,"no changes",sizeof(reason));
+    }
+    applyQuota();
+    return interval;
+}
+
+//
+// Interval after a failed update - exponential backoff with jitter so boards don't all retry in step
+//
+unsigned long refreshScheduler::failure() {
+    if (failures < 16) failures++;
+    unsigned long backoff = REFRESH_FAILBASE << (failures - 1);
+    if (backoff > REFRESH_FAILMAX || failures > 10) backoff = REFRESH_FAILMAX;
+    long jitter = (long)((backoff * REFRESH_JITTER) / 100);
+    interval = backoff + random(-jitter, jitter + 1);
+    snprintf(reason,sizeof(reason),"retry after %d failure%s",failures,(failures==1)?"":"s");
+    applyQuota();
+    return interval;
+}
+
+unsigned long refreshScheduler::getInterval() {
+    return interval;
+}
+
+int refreshScheduler::getFailures() {
+    return failures;
+}
+
+const char* refreshScheduler::getReason() {
+    return reason;
+}
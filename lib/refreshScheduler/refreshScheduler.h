@@ -0,0 +1,46 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Refresh Scheduler Library - chooses the interval to the next data update from the state of the board
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+
+#define REFRESH_MIN 30000UL             // Never refresh more often than this (ms)
+#define REFRESH_DUE 30000UL             // Interval when the next departure is imminent (ms)
+#define REFRESH_DUEMINUTES 3            // A departure within this many minutes is imminent
+#define REFRESH_NOSERVICES 300000UL     // Interval when there are no services (ms)
+#define REFRESH_OVERNIGHT 900000UL      // Interval when there are no services overnight (ms)
+#define REFRESH_NIGHTSTART 0            // Overnight period (hours, local time)
+#define REFRESH_NIGHTEND 5
+#define REFRESH_FAILBASE 30000UL        // First retry after a failure (ms), doubled for each consecutive failure
+#define REFRESH_FAILMAX 600000UL        // Longest retry interval (ms)
+#define REFRESH_JITTER 25               // Random +/- percentage applied to failure retries
+#define REFRESH_REASONSIZE 48
+
+class refreshScheduler {
+
+    private:
+        unsigned long baseInterval;
+        unsigned long interval = 0;
+        int failures = 0;
+        char reason[REFRESH_REASONSIZE] = "";
+        int quotaApi = -1;                  // API budget to consult (-1 for none)
+
+        void applyQuota();
+
+    public:
+        refreshScheduler(unsigned long base);
+        void setBaseInterval(unsigned long base);
+        void setQuotaApi(int api);
+        unsigned long success(bool changed, int minutesToDeparture, int numServices, int hour);
+        unsigned long failure();
+        unsigned long getInterval();
+        int getFailures();
+        const char* getReason();
+};
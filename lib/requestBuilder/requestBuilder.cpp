@@ -0,0 +1,152 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Request Builder Library - builds an HTTP request in a caller supplied buffer (no heap allocations)
+ * and sends it with a single write.
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <requestBuilder.h>
+
+requestBuilder::requestBuilder(char *buf, size_t size) {
+    buffer = buf;
+    bufferSize = size;
+    reset();
+}
+
+void requestBuilder::reset() {
+    length = 0;
+    lengthField = 0;
+    bodyStart = 0;
+    overflow = false;
+    if (bufferSize) buffer[0] = '\0';
+}
+
+void requestBuilder::addChar(char c) {
+    if (length < bufferSize-1) {
+        buffer[length++] = c;
+        buffer[length] = '\0';
+    } else overflow = true;
+}
+
+//
+// Add literal text (template text or trusted values)
+//
+requestBuilder& requestBuilder::add(const char *text) {
+    if (!text) return *this;
+    size_t len = strlen(text);
+    if (length + len < bufferSize) {
+        memcpy(buffer + length, text, len + 1);
+        length += len;
+    } else overflow = true;
+    return *this;
+}
+
+// Flash strings are memory mapped on the ESP32 so can be copied directly
+requestBuilder& requestBuilder::add(const __FlashStringHelper *text) {
+    return add(reinterpret_cast<const char *>(text));
+}
+
+requestBuilder& requestBuilder::add(long value) {
+    char digits[12];
+    snprintf(digits,sizeof(digits),"%ld",value);
+    return add(digits);
+}
+
+requestBuilder& requestBuilder::add(float value, int decimals) {
+    char digits[20];
+    snprintf(digits,sizeof(digits),"%.*f",decimals,value);
+    return add(digits);
+}
+
+//
+// Add a field value to an XML body, escaping any markup characters
+//
+requestBuilder& requestBuilder::addXml(const char *text) {
+    if (!text) return *this;
+    for (const char *p = text; *p; p++) {
+        switch (*p) {
+            case '&': add(F("&amp;")); break;
+            case '<': add(F("&lt;")); break;
+            case '>': add(F("&gt;")); break;
+            case '"': add(F("&quot;")); break;
+            case '\'': add(F("&apos;")); break;
+            default: addChar(*p); break;
+        }
+    }
+    return *this;
+}
+
+//
+// Add a field value to a url, percent encoding anything other than unreserved characters
+//
+requestBuilder& requestBuilder::addUrl(const char *text) {
+    static const char hexDigits[] = "0123456789ABCDEF";
+    if (!text) return *this;
+    for (const char *p = text; *p; p++) {
+        if (isalnum((unsigned char)*p) || *p == '-' || *p == '_' || *p == '.' || *p == '~') {
+            addChar(*p);
+        } else {
+            addChar('%');
+            addChar(hexDigits[((unsigned char)*p) >> 4]);
+            addChar(hexDigits[((unsigned char)*p) & 0x0F]);
+        }
+    }
+    return *this;
+}
+
+//
+// Add the Content-Length header and end the headers. Space is reserved for the length, which is filled in by endBody()
+//
+void requestBuilder::beginBody() {
+    add(F("Content-Length: "));
+    lengthField = length;
+    for (int i=0;i<CONTENTLENGTHDIGITS;i++) addChar(' ');
+    add(F("\r\n\r\n"));
+    bodyStart = length;
+}
+
+//
+// Fill in the Content-Length and close up any unused reserved space
+//
+void requestBuilder::endBody() {
+    if (!bodyStart || overflow) return;
+    char digits[CONTENTLENGTHDIGITS+1];
+    int n = snprintf(digits,sizeof(digits),"%u",(unsigned int)(length - bodyStart));
+    if (n > CONTENTLENGTHDIGITS) {
+        overflow = true;
+        return;
+    }
+    memcpy(buffer + lengthField, digits, n);
+    memmove(buffer + lengthField + n, buffer + lengthField + CONTENTLENGTHDIGITS, length - lengthField - CONTENTLENGTHDIGITS + 1);
+    length -= CONTENTLENGTHDIGITS - n;
+}
+
+// False if the request didn't fit in the buffer
+bool requestBuilder::isValid() {
+    return !overflow;
+}
+
+size_t requestBuilder::size() {
+    return length;
+}
+
+const char* requestBuilder::c_str() {
+    return buffer;
+}
+
+//
+// Send the complete request with a single write. Returns the length sent, or 0 if the request overflowed the buffer
+// or only part of it was written (the connection has failed and the server won't see a valid request).
+//
+size_t requestBuilder::send(Client &client) {
+    if (overflow) return 0;
+    unsigned long sendStart = micros();
+    size_t sent = client.write((const uint8_t *)buffer, length);
+    sendTime = micros() - sendStart;
+    return (sent == length) ? sent : 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Request Builder Library - builds an HTTP request in a caller supplied buffer (no heap allocations)
+ * and sends it with a single write.
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+#include <Client.h>
+
+#define CONTENTLENGTHDIGITS 5   // Space reserved for the Content-Length value
+
+class requestBuilder {
+
+    private:
+        char *buffer;
+        size_t bufferSize;
+        size_t length = 0;
+        size_t lengthField = 0;     // Position of the reserved Content-Length value
+        size_t bodyStart = 0;       // Position of the first byte of the body
+        bool overflow = false;
+
+        void addChar(char c);
+
+    public:
+        unsigned long sendTime = 0; // Time taken by the last send (us)
+
+        requestBuilder(char *buf, size_t size);
+        void reset();
+
+        requestBuilder& add(const char *text);
+        requestBuilder& add(const __FlashStringHelper *text);
+        requestBuilder& add(long value);
+        requestBuilder& add(float value, int decimals);
+        requestBuilder& addXml(const char *text);
+        requestBuilder& addUrl(const char *text);
+
+        void beginBody();
+        void endBody();
+
+        bool isValid();
+        size_t size();
+        const char* c_str();
+        size_t send(Client &client);
+};
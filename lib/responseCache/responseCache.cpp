@@ -0,0 +1,126 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Response Cache Library - small in memory LRU cache of recent upstream responses, keyed by normalised query
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#include <responseCache.h>
+
+responseCache pickerCache;
+
+responseCache::responseCache() {
+    for (int i=0;i<RESPONSECACHE_ENTRIES;i++) {
+        entries[i].query[0] = '\0';
+        entries[i].data = nullptr;
+        entries[i].length = 0;
+    }
+}
+
+//
+// Reduce a query to its cache key - lower case, trimmed and with single spaces. Returns false if the query is
+// too long to be cached.
+//
+bool responseCache::normalise(const char *query, char *key, size_t size) {
+    size_t len = 0;
+    bool space = false;
+    while (isspace(*query)) query++;
+    for (;*query;query++) {
+        if (isspace(*query)) {
+            space = true;
+            continue;
+        }
+        if (len + (space ? 2 : 1) >= size) return false;
+        if (space) key[len++] = ' ';
+        key[len++] = tolower(*query);
+        space = false;
+    }
+    key[len] = '\0';
+    return true;
+}
+
+void responseCache::evict(int entry) {
+    if (!entries[entry].data) return;
+    heldBytes -= entries[entry].length;
+    free(entries[entry].data);
+    entries[entry].data = nullptr;
+    entries[entry].query[0] = '\0';
+    entries[entry].length = 0;
+}
+
+//
+// Find the cached response to a normalised query. The data stays owned by the cache and is only valid until the
+// next store.
+//
+bool responseCache::lookup(const char *key, const char **data, size_t *length) {
+    unsigned long now = millis();
+    for (int i=0;i<RESPONSECACHE_ENTRIES;i++) {
+        if (!entries[i].data || strcmp(entries[i].query, key)) continue;
+        if (now - entries[i].stored > RESPONSECACHE_TTL) {
+            evict(i);
+            break;
+        }
+        entries[i].lastUsed = now;
+        *data = entries[i].data;
+        *length = entries[i].length;
+        hits++;
+        return true;
+    }
+    misses++;
+    return false;
+}
+
+//
+// Cache a response. The cache takes ownership of the (malloc'd) data, which is freed if it can't be kept.
+//
+bool responseCache::store(const char *key, char *data, size_t length) {
+    if (!length || length > RESPONSECACHE_MAXRESPONSE || strlen(key) >= RESPONSECACHE_MAXQUERY) {
+        free(data);
+        return false;
+    }
+
+    // Replace an older response to the same query, then drop the least recently used until the new one fits
+    for (int i=0;i<RESPONSECACHE_ENTRIES;i++) {
+        if (entries[i].data && !strcmp(entries[i].query, key)) evict(i);
+    }
+    int slot = -1;
+    while (true) {
+        int oldest = -1;
+        slot = -1;
+        for (int i=0;i<RESPONSECACHE_ENTRIES;i++) {
+            if (!entries[i].data) {
+                if (slot < 0) slot = i;
+            } else if (oldest < 0 || (long)(entries[i].lastUsed - entries[oldest].lastUsed) < 0) {
+                oldest = i;
+            }
+        }
+        if (slot >= 0 && heldBytes + length <= RESPONSECACHE_BUDGET) break;
+        if (oldest < 0) break;
+        evict(oldest);
+    }
+
+    // Trim the buffer down to the response (realloc to a smaller size doesn't move it if it can't)
+    char *trimmed = (char *)realloc(data, length);
+    if (trimmed) data = trimmed;
+
+    cacheEntry &entry = entries[slot];
+    strlcpy(entry.query, key, sizeof(entry.query));
+    entry.data = data;
+    entry.length = length;
+    entry.stored = entry.lastUsed = millis();
+    heldBytes += length;
+    return true;
+}
+
+void responseCache::clear() {
+    for (int i=0;i<RESPONSECACHE_ENTRIES;i++) evict(i);
+}
+
+String responseCache::getStats() {
+    int used = 0;
+    for (int i=0;i<RESPONSECACHE_ENTRIES;i++) if (entries[i].data) used++;
+    return String(used) + F(" responses (") + String(heldBytes) + F(" bytes), ") + String(hits) + F(" hits, ") + String(misses) + F(" misses");
+}
@@ -0,0 +1,47 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Response Cache Library - small in memory LRU cache of recent upstream responses, keyed by normalised query
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+
+#define RESPONSECACHE_ENTRIES 6             // Responses kept, the least recently used is replaced
+#define RESPONSECACHE_BUDGET 8192           // Most heap held by all the cached responses (bytes)
+#define RESPONSECACHE_MAXRESPONSE 3072      // Largest response that's cached
+#define RESPONSECACHE_MAXQUERY 32           // Longest normalised query, including the terminator
+#define RESPONSECACHE_TTL 3600000UL         // Age before a response is fetched again (ms)
+
+class responseCache {
+
+    private:
+        struct cacheEntry {
+            char query[RESPONSECACHE_MAXQUERY];
+            char *data;                     // Heap copy of the response, nullptr if the entry is unused
+            size_t length;
+            unsigned long stored;
+            unsigned long lastUsed;
+        };
+
+        cacheEntry entries[RESPONSECACHE_ENTRIES];
+        size_t heldBytes = 0;
+        unsigned long hits = 0;
+        unsigned long misses = 0;
+
+        void evict(int entry);
+
+    public:
+        responseCache();
+        static bool normalise(const char *query, char *key, size_t size);
+        bool lookup(const char *key, const char **data, size_t *length);
+        bool store(const char *key, char *data, size_t length);
+        void clear();
+        String getStats();
+};
+
+extern responseCache pickerCache;
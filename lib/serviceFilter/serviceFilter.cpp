@@ -0,0 +1,170 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Service Filter Library - compiles a comma separated platform or bus service filter into a matcher
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ *
+ * A filter is a comma separated list of terms, matched case-insensitively:
+ *   12     exact platform or service number
+ *   1-4    inclusive platform range (also matches lettered platforms such as 2a)
+ *   X*     any service starting with X
+ */
+#include <serviceFilter.h>
+
+// Compare a value against a lower case term, ignoring the case of the value
+static int compareTerm(const char *value, const char *term) {
+    while (*value && tolower(*value) == *term) {
+        value++;
+        term++;
+    }
+    return (unsigned char)tolower(*value) - (unsigned char)*term;
+}
+
+serviceFilter::serviceFilter() {}
+
+// Remove all terms, the filter will match everything
+void serviceFilter::clear() {
+    numExact = 0;
+    numPrefix = 0;
+    numRanges = 0;
+    active = false;
+}
+
+bool serviceFilter::isEmpty() const {
+    return !active;
+}
+
+//
+// Parse a numeric range term ("1-4"). Both ends must be numbers and the low end can't be above the high end.
+//
+bool serviceFilter::parseRange(const char *term, int len, int *low, int *high) {
+    int i = 0;
+    int values[2] = {0,0};
+    for (int part=0;part<2;part++) {
+        int digits = 0;
+        while (i < len && isdigit(term[i]) && digits < 4) {
+            values[part] = values[part] * 10 + (term[i] - '0');
+            i++;
+            digits++;
+        }
+        if (!digits) return false;
+        if (part == 0) {
+            if (i >= len || term[i] != '-') return false;
+            i++;
+        }
+    }
+    if (i != len || values[0] > values[1]) return false;
+    *low = values[0];
+    *high = values[1];
+    return true;
+}
+
+//
+// Add a single trimmed term to the matcher. Returns false if the term is too long or there's no room for it.
+//
+bool serviceFilter::addTerm(const char *term, int len) {
+    if (len <= 0) return true;
+
+    if (term[len-1] == '*') {
+        // Prefix match
+        if (len > MAXFILTERTERMSIZE || numPrefix >= MAXFILTERTERMS) return false;
+        for (int i=0;i<len-1;i++) prefix[numPrefix][i] = tolower(term[i]);
+        prefix[numPrefix][len-1] = '\0';
+        prefixLen[numPrefix++] = len-1;
+        return true;
+    }
+
+    int low, high;
+    if (parseRange(term, len, &low, &high)) {
+        if (numRanges >= MAXFILTERTERMS) return false;
+        rangeLow[numRanges] = low;
+        rangeHigh[numRanges++] = high;
+        return true;
+    }
+
+    if (len >= MAXFILTERTERMSIZE || numExact >= MAXFILTERTERMS) return false;
+    char lower[MAXFILTERTERMSIZE];
+    for (int i=0;i<len;i++) lower[i] = tolower(term[i]);
+    lower[len] = '\0';
+
+    // Insert in order, ignoring duplicates
+    int pos = 0;
+    while (pos < numExact && strcmp(exact[pos], lower) < 0) pos++;
+    if (pos < numExact && strcmp(exact[pos], lower) == 0) return true;
+    for (int i=numExact;i>pos;i--) strcpy(exact[i], exact[i-1]);
+    strcpy(exact[pos], lower);
+    numExact++;
+    return true;
+}
+
+//
+// Compile a comma separated filter. An empty (or NULL) filter matches everything. Returns false if any term
+// couldn't be used, the remaining terms still apply.
+//
+bool serviceFilter::compile(const char *filter) {
+    clear();
+    if (filter == nullptr) return true;
+
+    bool result = true;
+    const char *start = filter;
+    while (true) {
+        const char *end = start;
+        while (*end && *end != ',') end++;
+
+        // Trim the term
+        const char *termStart = start;
+        const char *termEnd = end;
+        while (termStart < termEnd && isspace(*termStart)) termStart++;
+        while (termEnd > termStart && isspace(*(termEnd-1))) termEnd--;
+
+        if (termEnd > termStart) {
+            active = true;
+            if (!addTerm(termStart, termEnd - termStart)) result = false;
+        }
+        if (!*end) break;
+        start = end + 1;
+    }
+    return result;
+}
+
+//
+// Check if a platform or service number passes the filter
+//
+bool serviceFilter::matches(const char *value) const {
+    if (!active) return true;
+    if (value == nullptr || !value[0]) return false;
+
+    // Binary search of the exact terms
+    int low = 0;
+    int high = numExact - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        int cmp = compareTerm(value, exact[mid]);
+        if (!cmp) return true;
+        if (cmp < 0) high = mid - 1; else low = mid + 1;
+    }
+
+    for (int i=0;i<numPrefix;i++) {
+        int j = 0;
+        while (j < prefixLen[i] && value[j] && tolower(value[j]) == prefix[i][j]) j++;
+        if (j == prefixLen[i]) return true;
+    }
+
+    if (numRanges && isdigit(value[0])) {
+        // Leading number, optionally followed by letters (platform 2a is within 1-4)
+        int number = 0;
+        int i = 0;
+        while (isdigit(value[i]) && i < 4) number = number * 10 + (value[i++] - '0');
+        while (isalpha(value[i])) i++;
+        if (!value[i]) {
+            for (int r=0;r<numRanges;r++) {
+                if (number >= rangeLow[r] && number <= rangeHigh[r]) return true;
+            }
+        }
+    }
+    return false;
+}
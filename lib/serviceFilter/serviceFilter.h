@@ -0,0 +1,45 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Service Filter Library - compiles a comma separated platform or bus service filter into a matcher
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+
+#define MAXFILTERTERMS 12               // Most terms a filter can hold (the filter text is at most 24 characters)
+#define MAXFILTERTERMSIZE 9             // Longest term, including the terminator (matches the longest bus line name)
+
+class serviceFilter {
+
+    private:
+        // Exact terms, lower case and sorted for a binary search
+        char exact[MAXFILTERTERMS][MAXFILTERTERMSIZE];
+        uint8_t numExact = 0;
+
+        // Prefix terms ("x*"), lower case
+        char prefix[MAXFILTERTERMS][MAXFILTERTERMSIZE];
+        uint8_t prefixLen[MAXFILTERTERMS];
+        uint8_t numPrefix = 0;
+
+        // Numeric ranges ("1-4"), inclusive
+        int rangeLow[MAXFILTERTERMS];
+        int rangeHigh[MAXFILTERTERMS];
+        uint8_t numRanges = 0;
+
+        bool active = false;            // A filter has been compiled (even if none of its terms were usable)
+
+        bool addTerm(const char *term, int len);
+        bool parseRange(const char *term, int len, int *low, int *high);
+
+    public:
+        serviceFilter();
+        bool compile(const char *filter);
+        void clear();
+        bool isEmpty() const;
+        bool matches(const char *value) const;
+};
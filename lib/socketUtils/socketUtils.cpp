@@ -0,0 +1,54 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Socket Utilities Library - bounded (DNS cached) connects and select() based waits on the underlying lwIP socket
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <socketUtils.h>
+#include <lwip/sockets.h>
+
+unsigned long shortestAttempt(WiFiClient &client) {
+    return 1;
+}
+
+// An attempt needs at least a second for the handshake, there's no retry with less than that left
+unsigned long shortestAttempt(WiFiClientSecure &client) {
+    return SOCKET_MINHANDSHAKE + 1;
+}
+
+bool connectAttempt(WiFiClient &client, const char *host, IPAddress ip, uint16_t port, unsigned long remaining) {
+    return client.connect(ip, port, (int32_t)remaining);
+}
+
+// The host name is still passed for TLS so SNI works when connecting by address. That connect has no timeout
+// parameter, it uses the client's timeout for the TCP connect and the handshake timeout (whole seconds) after it,
+// so the time remaining is split between the two.
+bool connectAttempt(WiFiClientSecure &client, const char *host, IPAddress ip, uint16_t port, unsigned long remaining) {
+    unsigned long handshake = (remaining / 2000) * 1000;
+    if (handshake < SOCKET_MINHANDSHAKE) handshake = SOCKET_MINHANDSHAKE;
+    client.setTimeout(remaining - handshake);
+    client.setHandshakeTimeout(handshake / 1000);
+    return client.connect(ip, port, host, NULL, NULL, NULL);
+}
+
+//
+// Block on select() until the socket is readable or the timeout expires
+//
+void waitForSocket(int fd, long remaining) {
+    if (fd < 0) {
+        delay(SOCKET_RETRYDELAY);
+        return;
+    }
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    FD_SET(fd, &readSet);
+    struct timeval tv;
+    tv.tv_sec = remaining / 1000;
+    tv.tv_usec = (remaining % 1000) * 1000;
+    select(fd + 1, &readSet, NULL, NULL, &tv);
+}
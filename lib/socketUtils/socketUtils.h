@@ -0,0 +1,64 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Socket Utilities Library - bounded (DNS cached) connects and select() based waits on the underlying lwIP socket
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <WiFiClientSecure.h>
+#include <dnsCache.h>
+
+#define SOCKET_RETRYDELAY 20    // Pause before retrying a failed connect (ms)
+#define SOCKET_MINHANDSHAKE 1000    // Shortest TLS handshake timeout (ms, the client only takes whole seconds)
+
+// The parts that differ between plain and TLS clients, used by the templates below
+unsigned long shortestAttempt(WiFiClient &client);
+unsigned long shortestAttempt(WiFiClientSecure &client);
+bool connectAttempt(WiFiClient &client, const char *host, IPAddress ip, uint16_t port, unsigned long remaining);
+bool connectAttempt(WiFiClientSecure &client, const char *host, IPAddress ip, uint16_t port, unsigned long remaining);
+void waitForSocket(int fd, long remaining);
+
+//
+// Connect, retrying until the timeout expires. The host is resolved through the DNS cache, and a failed
+// connect drops the cached address in case it has changed. The client's own timeout is put back afterwards.
+//
+template <typename ClientType>
+bool socketConnect(ClientType &client, const char *host, uint16_t port, unsigned long timeoutMs) {
+    unsigned long start = millis();
+    unsigned long clientTimeout = client.getTimeout();
+    IPAddress ip;
+    bool connected = false;
+    while (!connected && millis() - start < timeoutMs) {
+        if (hostCache.resolve(host, ip)) {
+            unsigned long remaining = timeoutMs - (millis() - start);
+            if (remaining < shortestAttempt(client)) break;
+            connected = connectAttempt(client, host, ip, port, remaining);
+            if (!connected) hostCache.invalidate(host);
+        }
+        if (!connected) delay(SOCKET_RETRYDELAY);
+    }
+    client.setTimeout(clientTimeout);
+    return connected;
+}
+
+//
+// Wait until data is available to read. Returns false on timeout or if the connection has closed with nothing left to read.
+// For TLS connections the socket can become readable with only part of a record, so available() is checked on each wake.
+//
+template <typename ClientType>
+bool waitForData(ClientType &client, unsigned long timeoutMs) {
+    unsigned long start = millis();
+    while (true) {
+        if (client.available()) return true;
+        if (!client.connected()) return false;
+        long remaining = (long)(timeoutMs - (millis() - start));
+        if (remaining <= 0) return false;
+        waitForSocket(client.fd(), remaining);
+    }
+}
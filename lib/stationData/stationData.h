@@ -47,6 +47,8 @@ struct rdService {
     bool platformAvailable;
     int numServices;
     bool boardChanged;  // Only for TfL
+    uint16_t changedRows;   // Only for buses, a bit for each service that's new or has a different line, destination or scheduled time
+    uint16_t changedTimes;  // Only for buses, a bit for each service where only the expected time has changed
     char calling[MAXCALLINGSIZE];   // Only store the calling stops for the first service returned
     char origin[MAXLOCATIONSIZE]; // Only store the origin for the first service returned
     char serviceMessage[MAXMESSAGESIZE];  // Only store the service message for the first service returned
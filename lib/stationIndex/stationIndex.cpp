@@ -0,0 +1,138 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Station Index Library - offline station picker, searches a CRS code and station name index built into flash
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ *
+ * The index is generated from a CSV of stations by scripts/stationindex.py. Every word of a station name is a
+ * search key, so "eus" finds London Euston and "london eu" finds it too. The keys are sorted, so a query is a
+ * binary search of the (memory mapped) flash with no file system or heap access.
+ */
+#include <stationIndex.h>
+#include <stationIndexData.h>
+
+stationIndex stationList;
+
+stationIndex::stationIndex() {}
+
+bool stationIndex::isAvailable() {
+    return STATIONINDEX_STATIONS > 0;
+}
+
+int stationIndex::size() {
+    return STATIONINDEX_STATIONS;
+}
+
+//
+// Compare the name of a station from a search key onwards with a lower case query, only as far as the length of
+// the query (so every key the query is a prefix of compares equal)
+//
+int stationIndex::compareKey(int key, const char *query, size_t len) {
+    const char *name = stationNames + stationRecords[stationKeys[key].station].name + stationKeys[key].offset;
+    for (size_t i=0;i<len;i++) {
+        int c = (unsigned char)tolower(name[i]);
+        if (c != (unsigned char)query[i]) return c - (unsigned char)query[i];
+    }
+    return 0;
+}
+
+//
+// Find the station with a CRS code (linear, the records are in name order). Returns -1 if there isn't one.
+//
+int stationIndex::findCrs(const char *query) {
+    for (int i=0;i<STATIONINDEX_STATIONS;i++) {
+        const char *crs = stationRecords[i].crs;
+        if (tolower(crs[0]) == query[0] && tolower(crs[1]) == query[1] && tolower(crs[2]) == query[2]) return i;
+    }
+    return -1;
+}
+
+//
+// Search for stations matching a query. An exact CRS code comes first, then stations whose name starts with the
+// query, then those with a later word starting with it. Returns the number of stations found.
+//
+int stationIndex::search(const char *query, uint16_t *results, int maxResults) {
+    char lower[MAXLOCATIONSIZE];
+    size_t len = 0;
+    while (isspace(*query)) query++;
+    while (*query && len < sizeof(lower)-1) lower[len++] = tolower(*query++);
+    while (len && isspace(lower[len-1])) len--;
+    lower[len] = '\0';
+    queries++;
+    if (!len || !isAvailable()) return 0;
+
+    int found = 0;
+    if (len == 3) {
+        int station = findCrs(lower);
+        if (station >= 0) results[found++] = station;
+    }
+
+    // First key at or after the query
+    int low = 0;
+    int high = STATIONINDEX_KEYS;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (compareKey(mid, lower, len) < 0) low = mid + 1; else high = mid;
+    }
+    int end = low;
+    while (end < STATIONINDEX_KEYS && !compareKey(end, lower, len)) end++;
+
+    // Names starting with the query, then the other words
+    for (int pass=0;pass<2;pass++) {
+        for (int key=low;key<end && found<maxResults;key++) {
+            if ((stationKeys[key].offset == 0) != (pass == 0)) continue;
+            uint16_t station = stationKeys[key].station;
+            bool duplicate = false;
+            for (int i=0;i<found && !duplicate;i++) duplicate = (results[i] == station);
+            if (!duplicate) results[found++] = station;
+        }
+    }
+    return found;
+}
+
+const char *stationIndex::getCrs(int station) {
+    return stationRecords[station].crs;
+}
+
+const char *stationIndex::getName(int station) {
+    return stationNames + stationRecords[station].name;
+}
+
+float stationIndex::getLatitude(int station) {
+    return stationRecords[station].lat / 100000.0;
+}
+
+float stationIndex::getLongitude(int station) {
+    return stationRecords[station].lon / 100000.0;
+}
+
+//
+// Search results in the same form as the National Rail station picker, so the Web GUI can use either
+//
+String stationIndex::getJson(const char *query, bool *found) {
+    uint16_t results[STATIONINDEX_MAXRESULTS];
+    int count = search(query, results, STATIONINDEX_MAXRESULTS);
+    *found = (count > 0);
+    if (count) localAnswers++;
+
+    String json = F("{\"payload\":{\"stations\":[");
+    for (int i=0;i<count;i++) {
+        if (i) json += ',';
+        json += "{\"crsCode\":\"" + String(getCrs(results[i])) + F("\",\"name\":\"");
+        for (const char *p = getName(results[i]); *p; p++) {
+            if (*p == '"' || *p == '\\') json += '\\';
+            json += *p;
+        }
+        json += "\",\"latitude\":" + String(getLatitude(results[i]),5) + F(",\"longitude\":") + String(getLongitude(results[i]),5) + F("}");
+    }
+    json += F("]}}");
+    return json;
+}
+
+String stationIndex::getStats() {
+    return String(STATIONINDEX_STATIONS) + F(" stations, ") + String(queries) + F(" queries, ") + String(localAnswers) + F(" answered locally");
+}
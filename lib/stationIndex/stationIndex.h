@@ -0,0 +1,52 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Station Index Library - offline station picker, searches a CRS code and station name index built into flash
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+#include <stationData.h>
+
+#define STATIONINDEX_MAXRESULTS 12      // Most stations returned for a query (the picker drop-down shows eight)
+
+struct stationRecord {
+    char crs[4];                        // CRS code
+    uint32_t name;                      // Offset of the name in stationNames
+    int32_t lat;                        // Latitude and longitude in 1/100000 degrees
+    int32_t lon;
+};
+
+// Each word of a station name is a search key, sorted by the rest of the name from that word
+struct stationKey {
+    uint16_t station;
+    uint8_t offset;                     // Start of the word in the name
+};
+
+class stationIndex {
+
+    private:
+        unsigned long queries = 0;
+        unsigned long localAnswers = 0;
+
+        int compareKey(int key, const char *query, size_t len);
+        int findCrs(const char *query);
+
+    public:
+        stationIndex();
+        bool isAvailable();
+        int size();
+        int search(const char *query, uint16_t *results, int maxResults);
+        const char *getCrs(int station);
+        const char *getName(int station);
+        float getLatitude(int station);
+        float getLongitude(int station);
+        String getJson(const char *query, bool *found);
+        String getStats();
+};
+
+extern stationIndex stationList;
@@ -0,0 +1,476 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Station Index data - generated by scripts/stationindex.py, do not edit
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+
+#define STATIONINDEX_STATIONS 206
+#define STATIONINDEX_KEYS 334
+
+static const char stationNames[] PROGMEM =
+    "Abbey Wood\0"
+    "Aberdeen\0"
+    "Aberystwyth\0"
+    "Ashford International\0"
+    "Ayr\0"
+    "Banbury\0"
+    "Bangor (Gwynedd)\0"
+    "Barnsley\0"
+    "Basingstoke\0"
+    "Bath Spa\0"
+    "Bedford\0"
+    "Berwick-upon-Tweed\0"
+    "Birmingham International\0"
+    "Birmingham Moor Street\0"
+    "Birmingham New Street\0"
+    "Birmingham Snow Hill\0"
+    "Blackpool North\0"
+    "Bolton\0"
+    "Bournemouth\0"
+    "Bradford Forster Square\0"
+    "Bradford Interchange\0"
+    "Bridgend\0"
+    "Brighton\0"
+    "Bristol Parkway\0"
+    "Bristol Temple Meads\0"
+    "Brixton\0"
+    "Cambridge\0"
+    "Camden Road\0"
+    "Canterbury East\0"
+    "Canterbury West\0"
+    "Cardiff Central\0"
+    "Cardiff Queen Street\0"
+    "Carlisle\0"
+    "Carmarthen\0"
+    "Chatham\0"
+    "Chelmsford\0"
+    "Cheltenham Spa\0"
+    "Chester\0"
+    "Chesterfield\0"
+    "Chichester\0"
+    "City Thameslink\0"
+    "Clapham Junction\0"
+    "Colchester\0"
+    "Coventry\0"
+    "Crewe\0"
+    "Darlington\0"
+    "Dartford\0"
+    "Denmark Hill\0"
+    "Derby\0"
+    "Doncaster\0"
+    "Dover Priory\0"
+    "Dumfries\0"
+    "Dundee\0"
+    "Durham\0"
+    "Ealing Broadway\0"
+    "East Croydon\0"
+    "Eastbourne\0"
+    "Edinburgh\0"
+    "Ely\0"
+    "Exeter Central\0"
+    "Exeter St Davids\0"
+    "Falkirk Grahamston\0"
+    "Falkirk High\0"
+    "Farringdon\0"
+    "Finsbury Park\0"
+    "Fort William\0"
+    "Gatwick Airport\0"
+    "Glasgow Central\0"
+    "Glasgow Queen Street\0"
+    "Gloucester\0"
+    "Grantham\0"
+    "Gravesend\0"
+    "Great Yarmouth\0"
+    "Greenwich\0"
+    "Grimsby Town\0"
+    "Guildford\0"
+    "Harrogate\0"
+    "Harrow & Wealdstone\0"
+    "Hastings\0"
+    "Hayes & Harlington\0"
+    "Haymarket\0"
+    "Haywards Heath\0"
+    "Heathrow Terminals 2 & 3\0"
+    "Hereford\0"
+    "Herne Hill\0"
+    "Highbury & Islington\0"
+    "Hitchin\0"
+    "Holyhead\0"
+    "Hove\0"
+    "Huddersfield\0"
+    "Hull\0"
+    "Inverness\0"
+    "Ipswich\0"
+    "Kensington Olympia\0"
+    "Kings Lynn\0"
+    "Kirkcaldy\0"
+    "Lancaster\0"
+    "Leamington Spa\0"
+    "Leeds\0"
+    "Leicester\0"
+    "Lewes\0"
+    "Lewisham\0"
+    "Lincoln\0"
+    "Liverpool Central\0"
+    "Liverpool Lime Street\0"
+    "Llandudno Junction\0"
+    "London Blackfriars\0"
+    "London Bridge\0"
+    "London Cannon Street\0"
+    "London Charing Cross\0"
+    "London Euston\0"
+    "London Fenchurch Street\0"
+    "London Kings Cross\0"
+    "London Liverpool Street\0"
+    "London Marylebone\0"
+    "London Paddington\0"
+    "London St Pancras International\0"
+    "London Victoria\0"
+    "London Waterloo\0"
+    "London Waterloo East\0"
+    "Loughborough\0"
+    "Lowestoft\0"
+    "Luton\0"
+    "Luton Airport Parkway\0"
+    "Maidstone East\0"
+    "Manchester Airport\0"
+    "Manchester Oxford Road\0"
+    "Manchester Piccadilly\0"
+    "Manchester Victoria\0"
+    "Middlesbrough\0"
+    "Milton Keynes Central\0"
+    "Newark North Gate\0"
+    "Newcastle\0"
+    "Newport (South Wales)\0"
+    "Newton Abbot\0"
+    "Northampton\0"
+    "Norwich\0"
+    "Nottingham\0"
+    "Oxenholme Lake District\0"
+    "Oxford\0"
+    "Peckham Rye\0"
+    "Penzance\0"
+    "Perth\0"
+    "Peterborough\0"
+    "Plymouth\0"
+    "Poole\0"
+    "Portsmouth & Southsea\0"
+    "Portsmouth Harbour\0"
+    "Preston\0"
+    "Purley\0"
+    "Ramsgate\0"
+    "Reading\0"
+    "Retford\0"
+    "Richmond\0"
+    "Romford\0"
+    "Rotherham Central\0"
+    "Rugby\0"
+    "Runcorn\0"
+    "Salisbury\0"
+    "Scarborough\0"
+    "Sevenoaks\0"
+    "Sheffield\0"
+    "Shenfield\0"
+    "Shrewsbury\0"
+    "Skegness\0"
+    "Slough\0"
+    "Southampton Airport Parkway\0"
+    "Southampton Central\0"
+    "Southend Central\0"
+    "Southend Victoria\0"
+    "Stafford\0"
+    "Stansted Airport\0"
+    "Stevenage\0"
+    "Stirling\0"
+    "Stockport\0"
+    "Stoke-on-Trent\0"
+    "Stratford\0"
+    "Sunderland\0"
+    "Surbiton\0"
+    "Swansea\0"
+    "Swindon\0"
+    "Taunton\0"
+    "Tonbridge\0"
+    "Torquay\0"
+    "Tottenham Hale\0"
+    "Truro\0"
+    "Tunbridge Wells\0"
+    "Vauxhall\0"
+    "Wakefield Westgate\0"
+    "Warrington Bank Quay\0"
+    "Warrington Central\0"
+    "Watford Junction\0"
+    "West Croydon\0"
+    "Westbury\0"
+    "Weymouth\0"
+    "Wigan North Western\0"
+    "Willesden Junction\0"
+    "Wimbledon\0"
+    "Winchester\0"
+    "Woking\0"
+    "Wolverhampton\0"
+    "Woolwich Arsenal\0"
+    "Worcester Foregate Street\0"
+    "Worcester Shrub Hill\0"
+    "Worthing\0"
+    "York\0";
+
+static const stationRecord stationRecords[] PROGMEM = {
+    {"ABW",0,5149100,12140},
+    {"ABD",11,5714330,-209790},
+    {"AYW",20,5241400,-408180},
+    {"AFK",32,5114360,87610},
+    {"AYR",54,5545820,-462570},
+    {"BAN",58,5206030,-132800},
+    {"BNG",66,5322220,-413580},
+    {"BNY",83,5355420,-147740},
+    {"BSK",92,5126850,-108730},
+    {"BTH",104,5137760,-235690},
+    {"BDM",113,5213620,-47940},
+    {"BWK",121,5577430,-201090},
+    {"BHI",140,5245080,-172590},
+    {"BMO",165,5247910,-189240},
+    {"BHM",188,5247780,-189850},
+    {"BSW",210,5248330,-189910},
+    {"BPN",231,5382180,-304920},
+    {"BON",247,5357410,-242590},
+    {"BMH",254,5072740,-186450},
+    {"BDQ",266,5379670,-175290},
+    {"BDI",290,5379110,-174960},
+    {"BGN",311,5150700,-357530},
+    {"BTN",320,5082900,-14110},
+    {"BPW",329,5151380,-254200},
+    {"BRI",345,5144920,-258130},
+    {"BRX",366,5146300,-11420},
+    {"CBG",374,5219430,13740},
+    {"CMD",384,5154190,-13860},
+    {"CBE",396,5127430,107590},
+    {"CBW",412,5128420,107530},
+    {"CDF",428,5147600,-317920},
+    {"CDQ",444,5148200,-317000},
+    {"CAR",465,5489060,-293350},
+    {"CMN",474,5185300,-430590},
+    {"CTM",485,5138040,52120},
+    {"CHM",493,5173640,46860},
+    {"CNM",504,5189740,-209950},
+    {"CTR",519,5319660,-287950},
+    {"CHD",527,5323830,-142040},
+    {"CCH",540,5083200,-78190},
+    {"CTK",551,5151390,-10350},
+    {"CLJ",567,5146420,-17030},
+    {"COL",584,5190070,89270},
+    {"COV",595,5240090,-151360},
+    {"CRE",604,5308920,-243270},
+    {"DAR",610,5452050,-154740},
+    {"DFD",621,5144740,21920},
+    {"DMK",630,5146820,-8940},
+    {"DBY",643,5291650,-146340},
+    {"DON",649,5352220,-113970},
+    {"DVP",659,5112570,130530},
+    {"DMF",672,5507270,-360440},
+    {"DEE",681,5645650,-297130},
+    {"DHM",688,5477940,-158170},
+    {"EAL",695,5151500,-30170},
+    {"ECR",711,5137550,-9270},
+    {"EBN",724,5076930,28120},
+    {"EDB",735,5595200,-318940},
+    {"ELY",745,5239140,26730},
+    {"EXC",749,5072650,-353310},
+    {"EXD",764,5072920,-354340},
+    {"FKG",781,5600270,-378500},
+    {"FKK",800,5599180,-379220},
+    {"ZFD",813,5152030,-10530},
+    {"FPK",824,5156420,-10650},
+    {"FTW",838,5682050,-510580},
+    {"GTW",851,5115650,-16100},
+    {"GLC",867,5585900,-425810},
+    {"GLQ",883,5586220,-425100},
+    {"GCR",904,5186550,-223850},
+    {"GRA",915,5290640,-64240},
+    {"GRV",924,5144130,36670},
+    {"GYM",934,5261220,172110},
+    {"GNW",949,5147810,-1330},
+    {"GMB",959,5356360,-8710},
+    {"GLD",972,5123700,-58020},
+    {"HGT",982,5399320,-153740},
+    {"HRW",992,5159210,-33460},
+    {"HGS",1012,5085770,57700},
+    {"HAY",1021,5150300,-42060},
+    {"HYM",1040,5594580,-321840},
+    {"HHE",1050,5100550,-10520},
+    {"HXX",1065,5147130,-45430},
+    {"HFD",1090,5206130,-270820},
+    {"HNH",1099,5145330,-10220},
+    {"HHY",1110,5154610,-10400},
+    {"HIT",1131,5195310,-26340},
+    {"HHD",1139,5330730,-463100},
+    {"HOV",1148,5083530,-17070},
+    {"HUD",1153,5364850,-178440},
+    {"HUL",1166,5374440,-34590},
+    {"INV",1171,5748000,-422340},
+    {"IPS",1181,5205070,114460},
+    {"KPA",1189,5149830,-21040},
+    {"KLN",1208,5275380,40340},
+    {"KDY",1219,5611200,-316720},
+    {"LAN",1229,5404880,-280760},
+    {"LMS",1239,5228470,-153630},
+    {"LDS",1254,5379500,-154760},
+    {"LEI",1260,5263140,-112530},
+    {"LWS",1270,5087050,1140},
+    {"LEW",1276,5146570,-1390},
+    {"LCN",1285,5322600,-53990},
+    {"LVC",1293,5340460,-297920},
+    {"LIV",1311,5340740,-297780},
+    {"LLJ",1333,5328400,-380900},
+    {"BFR",1352,5151160,-10330},
+    {"LBG",1371,5150500,-8600},
+    {"CST",1385,5151130,-9040},
+    {"CHX",1406,5150800,-12470},
+    {"EUS",1427,5152820,-13370},
+    {"FST",1441,5151160,-7890},
+    {"KGX",1465,5153080,-12380},
+    {"LST",1484,5151780,-8230},
+    {"MYB",1508,5152250,-16310},
+    {"PAD",1526,5151540,-17550},
+    {"STP",1544,5153130,-12630},
+    {"VIC",1576,5149520,-14410},
+    {"WAT",1592,5150310,-11320},
+    {"WAE",1608,5150410,-10880},
+    {"LBO",1629,5277890,-119580},
+    {"LWT",1642,5247450,174920},
+    {"LUT",1652,5188230,-41440},
+    {"LTN",1658,5187240,-39620},
+    {"MDE",1680,5127800,52130},
+    {"MIA",1695,5336500,-227270},
+    {"MCO",1714,5347400,-224200},
+    {"MAN",1737,5347740,-223090},
+    {"MCV",1759,5348750,-224240},
+    {"MBR",1779,5457900,-123460},
+    {"MKC",1793,5203430,-77410},
+    {"NNG",1815,5308150,-79980},
+    {"NCL",1833,5496830,-161740},
+    {"NWP",1843,5158880,-300010},
+    {"NTA",1865,5052930,-359990},
+    {"NMP",1878,5223750,-90690},
+    {"NRW",1890,5262700,130680},
+    {"NOT",1898,5294700,-114610},
+    {"OXN",1909,5430490,-272190},
+    {"OXF",1933,5175350,-127000},
+    {"PMR",1940,5147000,-6940},
+    {"PNZ",1952,5012170,-553250},
+    {"PTH",1961,5639180,-343910},
+    {"PBO",1967,5257480,-25020},
+    {"PLY",1980,5037790,-414330},
+    {"POO",1989,5071940,-198330},
+    {"PMS",1995,5079850,-109080},
+    {"PMH",2017,5079700,-110780},
+    {"PRE",2036,5375660,-270810},
+    {"PUR",2044,5133750,-11410},
+    {"RAM",2051,5134060,140620},
+    {"RDG",2060,5145890,-97180},
+    {"RET",2068,5331530,-94740},
+    {"RMD",2076,5146310,-30140},
+    {"RMF",2085,5157480,18320},
+    {"RMC",2093,5343210,-136030},
+    {"RUG",2111,5237900,-125050},
+    {"RUN",2117,5333870,-273910},
+    {"SAL",2125,5107050,-180630},
+    {"SCA",2135,5427980,-40580},
+    {"SEV",2147,5127680,18170},
+    {"SHF",2157,5337810,-146210},
+    {"SNF",2167,5163090,32990},
+    {"SHR",2177,5271200,-274940},
+    {"SKG",2188,5314350,33470},
+    {"SLO",2197,5151190,-59150},
+    {"SOA",2204,5095080,-136340},
+    {"SOU",2232,5090750,-141340},
+    {"SOC",2252,5153710,71190},
+    {"SOV",2269,5154150,71150},
+    {"STA",2287,5280390,-212220},
+    {"SSD",2296,5188890,26100},
+    {"SVG",2313,5190140,-20720},
+    {"STG",2323,5611960,-393530},
+    {"SPT",2332,5340540,-216340},
+    {"SOT",2342,5300800,-218100},
+    {"SRA",2357,5154160,-340},
+    {"SUN",2367,5490540,-138230},
+    {"SUR",2378,5139260,-30400},
+    {"SWA",2387,5162510,-394180},
+    {"SWI",2395,5156540,-178550},
+    {"TAU",2403,5102330,-310300},
+    {"TON",2411,5119140,27100},
+    {"TQY",2421,5046150,-354320},
+    {"TOM",2429,5158830,-6000},
+    {"TRU",2444,5026370,-506500},
+    {"TBW",2450,5113030,26300},
+    {"VXH",2466,5148610,-12290},
+    {"WKF",2475,5368330,-150720},
+    {"WBQ",2494,5338690,-260360},
+    {"WAC",2515,5339220,-259220},
+    {"WFJ",2534,5166360,-39660},
+    {"WCY",2551,5137840,-10250},
+    {"WSB",2564,5126710,-219900},
+    {"WEY",2573,5061530,-245440},
+    {"WGN",2582,5354360,-263350},
+    {"WIJ",2602,5153250,-24450},
+    {"WIM",2621,5142140,-20640},
+    {"WIN",2631,5106720,-131970},
+    {"WOK",2642,5131850,-55700},
+    {"WVH",2649,5258790,-211950},
+    {"WWA",2663,5148990,6910},
+    {"WOF",2680,5219510,-222140},
+    {"WOS",2706,5219470,-220960},
+    {"WRH",2727,5081830,-37610},
+    {"YRK",2736,5395800,-109310},
+};
+
+static const stationKey stationKeys[] PROGMEM = {
+    {82,19},{82,23},{0,0},{134,7},{1,0},{2,0},{66,8},{125,11},
+    {171,9},{123,6},{166,12},{201,9},{3,0},{4,0},{5,0},{6,0},
+    {189,11},{7,0},{8,0},{9,0},{10,0},{11,0},{12,0},{13,0},
+    {14,0},{15,0},{106,7},{16,0},{17,0},{18,0},{19,0},{20,0},
+    {107,7},{21,0},{22,0},{23,0},{24,0},{25,0},{54,7},{26,0},
+    {27,0},{108,7},{28,0},{29,0},{30,0},{31,0},{32,0},{33,0},
+    {30,8},{59,7},{67,8},{103,10},{130,14},{155,10},{167,12},{168,9},
+    {190,11},{109,7},{34,0},{35,0},{36,0},{37,0},{38,0},{39,0},
+    {40,0},{41,0},{42,0},{43,0},{44,0},{109,15},{112,13},{55,5},
+    {192,5},{45,0},{46,0},{60,10},{47,0},{48,0},{138,15},{49,0},
+    {50,0},{51,0},{52,0},{53,0},{54,0},{28,11},{119,16},{124,10},
+    {55,0},{56,0},{57,0},{58,0},{110,7},{59,0},{60,0},{61,0},
+    {62,0},{63,0},{111,7},{64,0},{202,10},{19,9},{65,0},{131,13},
+    {66,0},{67,0},{68,0},{69,0},{61,8},{70,0},{71,0},{72,0},
+    {73,0},{74,0},{75,0},{6,8},{184,10},{147,11},{79,8},{76,0},
+    {77,0},{78,0},{79,0},{80,0},{81,0},{81,9},{82,0},{83,0},
+    {84,0},{62,8},{85,0},{15,16},{47,8},{84,6},{203,16},{86,0},
+    {87,0},{88,0},{89,0},{90,0},{20,9},{3,8},{12,11},{116,18},
+    {91,0},{92,0},{85,11},{41,8},{105,10},{191,8},{196,10},{93,0},
+    {130,7},{112,7},{94,0},{95,0},{138,10},{96,0},{97,0},{98,0},
+    {99,0},{100,0},{101,0},{104,10},{102,0},{103,0},{104,0},{113,7},
+    {105,0},{106,0},{107,0},{108,0},{109,0},{110,0},{111,0},{112,0},
+    {113,0},{114,0},{115,0},{116,0},{117,0},{118,0},{119,0},{120,0},
+    {121,0},{122,0},{123,0},{94,6},{124,0},{125,0},{126,0},{127,0},
+    {128,0},{114,7},{24,15},{129,0},{130,0},{13,11},{14,11},{131,0},
+    {132,0},{133,0},{134,0},{16,10},{131,7},{195,6},{135,0},{136,0},
+    {137,0},{93,11},{175,6},{138,0},{139,0},{126,11},{115,7},{116,10},
+    {64,9},{23,8},{123,14},{166,20},{140,0},{141,0},{142,0},{143,0},
+    {127,11},{144,0},{145,0},{146,0},{147,0},{148,0},{50,6},{149,0},
+    {189,16},{31,8},{68,8},{150,0},{151,0},{152,0},{153,0},{27,7},
+    {126,18},{154,0},{155,0},{156,0},{157,0},{140,8},{158,0},{159,0},
+    {160,0},{161,0},{162,0},{163,0},{203,10},{164,0},{165,0},{15,11},
+    {133,9},{166,0},{167,0},{168,0},{169,0},{146,13},{9,5},{36,11},
+    {97,11},{19,17},{60,7},{116,7},{170,0},{171,0},{172,0},{173,0},
+    {174,0},{175,0},{176,0},{13,16},{14,15},{31,14},{68,14},{104,15},
+    {108,14},{111,17},{113,17},{202,19},{177,0},{178,0},{179,0},{180,0},
+    {181,0},{24,8},{82,9},{40,5},{182,0},{183,0},{184,0},{74,8},
+    {175,9},{185,0},{186,0},{11,13},{11,8},{187,0},{117,7},{128,11},
+    {169,9},{188,0},{133,15},{189,0},{190,0},{118,7},{119,7},{191,0},
+    {77,9},{186,10},{29,11},{192,0},{193,0},{195,12},{188,10},{194,0},
+    {195,0},{196,0},{65,5},{197,0},{198,0},{199,0},{200,0},{0,6},
+    {201,0},{202,0},{203,0},{204,0},{72,6},{205,0},
+};
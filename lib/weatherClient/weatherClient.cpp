@@ -10,41 +10,62 @@
  */
 
 #include <weatherClient.h>
-#include <JsonListener.h>
+#include <jsonListener.h>
 #include <WiFiClient.h>
+#include <perfMonitor.h>
+#include <requestBuilder.h>
+#include <socketUtils.h>
+#include <apiQuota.h>
+#include <LittleFS.h>
+#include <time.h>
 
 weatherClient::weatherClient() {}
 
-bool weatherClient::updateWeather(String apiKey, String lat, String lon) {
+//
+// Override the default OpenWeatherMap host (e.g. to use a local test server)
+//
+void weatherClient::setApiHost(const char *host) {
+    if (host && host[0]) apiHost = host;
+}
+
+//
+// Request current weather or forecast data for a location and parse the response
+//
+bool weatherClient::getData(const __FlashStringHelper *endpoint, const char *apiKey, float lat, float lon) {
 
     lastErrorMsg = "";
 
-    JsonStreamingParser parser;
+    perf.begin(PERF_WEATHER);
+    jsonStreamingParser parser;
     parser.setListener(this);
     WiFiClient httpClient;
 
-    int retryCounter=0;
-    while (!httpClient.connect(apiHost, 80) && (retryCounter++ < 15)){
-        delay(200);
-    }
-    if (retryCounter>=15) {
+    if (!socketConnect(httpClient, apiHost, 80, 3000)) {
         lastErrorMsg += F("Connection timeout");
         return false;
     }
+    perf.sample(PERF_HANDSHAKE);
 
-    String request = "GET /data/2.5/weather?units=metric&lang=en&lat=" + lat + F("&lon=") + lon + F("&appid=") + apiKey + F(" HTTP/1.0\r\nHost: ") + String(apiHost) + F("\r\nConnection: close\r\n\r\n");
-    httpClient.print(request);
-    retryCounter=0;
-    while(!httpClient.available() && retryCounter++ < 40) {
-        delay(200);
+    char requestBuffer[256];
+    requestBuilder request(requestBuffer,sizeof(requestBuffer));
+    request.add(F("GET ")).add(endpoint);
+    if (parsing) request.add(F("cnt=")).add((long)WEATHER_PERIODS).add(F("&"));
+    request.add(F("units=metric&lang=en&lat=")).add(lat,2).add(F("&lon=")).add(lon,2).add(F("&appid=")).addUrl(apiKey);
+    request.add(F(" HTTP/1.0\r\nHost: ")).add(apiHost).add(F("\r\nConnection: close\r\n\r\n"));
+    if (!request.send(httpClient)) {
+        httpClient.stop();
+        lastErrorMsg += request.isValid() ? F("Request not sent") : F("Request too large");
+        return false;
     }
-
-    if (!httpClient.available()) {
+    quota.consume(QUOTA_WEATHER);
+    perf.setSendTime(request.sendTime);
+    if (!waitForData(httpClient, 8000)) {
         // no response within 8 seconds so exit
         httpClient.stop();
         lastErrorMsg += F("Response timeout");
         return false;
     }
+    perf.firstByte();
 
     // Parse status code
     String statusLine = httpClient.readStringUntil('\n');
@@ -67,60 +88,186 @@ bool weatherClient::updateWeather(String apiKey, String lat, String lon) {
         if (line == "\r") break;
     }
 
-    bool isBody = false;
     char c;
-    weatherItem=0;
+    description[0] = '\0';
+    temperature = 0;
+    windSpeed = 0;
+    dataReceived = 0;
+    parseTime = 0;
 
     unsigned long dataSendTimeout = millis() + 10000UL;
     while((httpClient.available() || httpClient.connected()) && (millis() < dataSendTimeout)) {
+        unsigned long parseStart = micros();
         while(httpClient.available()) {
             c = httpClient.read();
-            if (c == '{' || c == '[') isBody = true;
-            if (isBody) parser.parse(c);
+            dataReceived++;
+            parser.parse(c);
         }
-        delay(5);
+        parseTime += micros() - parseStart;
+        waitForData(httpClient, 100);
     }
+    perf.sample(PERF_PARSED);
     httpClient.stop();
     if (millis() >= dataSendTimeout) {
         lastErrorMsg += F("Data timeout");
         return false;
     }
+    return true;
+}
 
-    lastErrorMsg="";
+bool weatherClient::updateWeather(const char *apiKey, float lat, float lon) {
+    parsing = nullptr;
+    if (!getData(F("/data/2.5/weather?"), apiKey, lat, lon)) return false;
 
-    currentWeather = description + " " + String((int)round(temperature)) + F("\x80");
+    currentWeather = String(description) + " " + String((int)round(temperature)) + F("\x80");
+    perf.sample(PERF_COPIED);
     return true;
 }
 
-void weatherClient::whitespace(char c) {}
+//
+// Fetch the forecast for the next 24 hours at a location into the cache
+//
+bool weatherClient::updateForecast(const char *apiKey, float lat, float lon) {
+    weatherForecast forecast;
 
-void weatherClient::startDocument() {}
+    memset(&forecast, 0, sizeof(forecast));
+    forecast.latitude = lround(lat * 100);
+    forecast.longitude = lround(lon * 100);
+    parsing = &forecast;
+    bool result = getData(F("/data/2.5/forecast?"), apiKey, lat, lon);
+    parsing = nullptr;
+    forecastRequests++;
+    if (!result) return false;
+    if (!forecast.numPeriods) {
+        lastErrorMsg = F("No forecast periods");
+        return false;
+    }
+    forecast.fetched = time(nullptr);
 
-void weatherClient::key(String key) {
-    currentKey = key;
+    // Replace the existing forecast for the location, or the oldest one
+    loadCache();
+    weatherForecast *slot = findForecast(lat, lon);
+    if (!slot) {
+        slot = &forecasts[0];
+        for (int i=1;i<WEATHER_LOCATIONS;i++) {
+            if (forecasts[i].fetched < slot->fetched) slot = &forecasts[i];
+        }
+    }
+    *slot = forecast;
+    saveCache();
+    perf.sample(PERF_COPIED);
+    return true;
 }
 
-void weatherClient::value(String value) {
-    if (currentObject == F("weather") && weatherItem==0) {
-        // Only read the first weather entry in the array
-        if (currentKey == F("description")) description = value;
+weatherClient::weatherForecast *weatherClient::findForecast(float lat, float lon) {
+    int32_t latitude = lround(lat * 100);
+    int32_t longitude = lround(lon * 100);
+    for (int i=0;i<WEATHER_LOCATIONS;i++) {
+        if (forecasts[i].numPeriods && forecasts[i].latitude == latitude && forecasts[i].longitude == longitude) return &forecasts[i];
     }
-    else if (currentKey == F("temp")) temperature = value.toFloat();
-    // Windspeed reported in mps, converting to mph
-    else if (currentKey == F("speed")) windSpeed = value.toFloat() * 2.23694;
+    return nullptr;
 }
 
-void weatherClient::endArray() {}
+bool weatherClient::hasForecast(float lat, float lon) {
+    loadCache();
+    return findForecast(lat, lon) != nullptr;
+}
 
-void weatherClient::endObject() {
-    if (currentObject == F("weather")) weatherItem++;
-    currentObject = "";
+//
+// Check if the forecast for a location is missing, out of date or about to run out of periods
+//
+bool weatherClient::forecastDue(float lat, float lon) {
+    loadCache();
+    weatherForecast *forecast = findForecast(lat, lon);
+    if (!forecast) return true;
+    time_t now = time(nullptr);
+    if ((unsigned long)(now - forecast->fetched) > WEATHER_FORECAST_TTL) return true;
+    return (now > forecast->period[forecast->numPeriods-1].time);
 }
 
-void weatherClient::endDocument() {}
+//
+// The weather message for the forecast period covering the current time. Returns false if there isn't one.
+//
+bool weatherClient::getForecastWeather(float lat, float lon, char *message, int size) {
+    loadCache();
+    weatherForecast *forecast = findForecast(lat, lon);
+    if (!forecast) return false;
 
-void weatherClient::startArray() {}
+    time_t now = time(nullptr);
+    weatherPeriod *current = nullptr;
+    for (int i=0;i<forecast->numPeriods;i++) {
+        if (now + WEATHER_PERIOD_SPAN >= forecast->period[i].time) current = &forecast->period[i];
+    }
+    if (!current || now > current->time + WEATHER_PERIOD_SPAN) return false;
 
-void weatherClient::startObject() {
-    currentObject = currentKey;
+    snprintf(message, size, "%s %d\x80", current->description, (int)round(current->temperature));
+    cacheHits++;
+    return true;
+}
+
+// Restore the cached forecasts after a restart
+void weatherClient::loadCache() {
+    if (cacheLoaded) return;
+    cacheLoaded = true;
+    memset(forecasts, 0, sizeof(forecasts));
+    if (!LittleFS.exists(F(WEATHER_CACHE_FILE))) return;
+    File f = LittleFS.open(F(WEATHER_CACHE_FILE), "r");
+    if (!f) return;
+    if (f.size() != sizeof(forecasts) || f.read((uint8_t *)forecasts, sizeof(forecasts)) != sizeof(forecasts)) {
+        // Written by a different version of the firmware
+        memset(forecasts, 0, sizeof(forecasts));
+    }
+    f.close();
+}
+
+void weatherClient::saveCache() {
+    File f = LittleFS.open(F(WEATHER_CACHE_FILE), "w");
+    if (!f) return;
+    f.write((const uint8_t *)forecasts, sizeof(forecasts));
+    f.close();
+}
+
+void weatherClient::startContainer(const jsonPath &path, bool isArray) {}
+
+void weatherClient::endContainer(const jsonPath &path, bool isArray) {}
+
+void weatherClient::value(const jsonPath &path, const char *value, int type) {
+    if (parsing) {
+        // Forecast, list[n].dt, list[n].main.temp, list[n].weather[0].description and list[n].wind.speed
+        int n = path.index(1);
+        if (path.key(0) != jsonKey("list") || n < 0 || n >= WEATHER_PERIODS) return;
+        weatherPeriod *period = &parsing->period[n];
+        if (n >= parsing->numPeriods) parsing->numPeriods = n + 1;
+        switch (path.lastKey()) {
+            case jsonKey("dt"):
+                if (path.depth == 3) period->time = strtoul(value, nullptr, 10);
+                break;
+            case jsonKey("temp"):
+                if (path.depth == 4 && path.key(2) == jsonKey("main")) period->temperature = atof(value);
+                break;
+            case jsonKey("description"):
+                if (path.depth == 5 && path.key(2) == jsonKey("weather") && path.index(3) == 0) strlcpy(period->description, value, sizeof(period->description));
+                break;
+            case jsonKey("speed"):
+                if (path.depth == 4 && path.key(2) == jsonKey("wind")) period->windSpeed = atof(value) * 2.23694;
+                break;
+        }
+        return;
+    }
+
+    switch (path.lastKey()) {
+        case jsonKey("description"):
+            // Only read the first weather entry in the array
+            if (path.depth == 3 && path.key(0) == jsonKey("weather") && path.index(1) == 0) strlcpy(description, value, sizeof(description));
+            break;
+
+        case jsonKey("temp"):
+            if (path.depth == 2 && path.key(0) == jsonKey("main")) temperature = atof(value);
+            break;
+
+        case jsonKey("speed"):
+            // Windspeed reported in mps, converting to mph
+            if (path.depth == 2 && path.key(0) == jsonKey("wind")) windSpeed = atof(value) * 2.23694;
+            break;
+    }
 }
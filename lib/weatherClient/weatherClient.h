@@ -9,36 +9,67 @@
  * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
  */
 #pragma once
-#include <JsonListener.h>
-#include <JsonStreamingParser.h>
+#include <jsonListener.h>
+#include <jsonStreamingParser.h>
 
-class weatherClient: public JsonListener {
+#define MAXWEATHERDESCSIZE 32
+#define WEATHER_PERIODS 8                   // Three hourly forecast periods requested (24 hours)
+#define WEATHER_LOCATIONS 3                 // Locations with a cached forecast, the oldest is replaced
+#define WEATHER_FORECAST_TTL (6UL * 3600UL) // Age before a forecast is fetched again (seconds)
+#define WEATHER_PERIOD_SPAN 5400            // A period is shown from 90 minutes before its time until 90 minutes after
+#define WEATHER_CACHE_FILE "/weather.bin"
+
+class weatherClient: public jsonListener {
 
     private:
+        struct weatherPeriod {
+            uint32_t time;                  // Time of the period (seconds since the epoch)
+            float temperature;
+            float windSpeed;
+            char description[MAXWEATHERDESCSIZE];
+        };
+
+        struct weatherForecast {
+            int32_t latitude;               // Location in hundredths of a degree (about 1km)
+            int32_t longitude;
+            uint32_t fetched;               // Time the forecast was fetched (seconds since the epoch)
+            int numPeriods;
+            weatherPeriod period[WEATHER_PERIODS];
+        };
+
         const char* apiHost = "api.openweathermap.org";
-        String currentKey = "";
-        String currentObject = "";
-        int weatherItem = 0;
 
-        String description;
+        char description[MAXWEATHERDESCSIZE];
         float temperature;
         float windSpeed;
 
+        weatherForecast forecasts[WEATHER_LOCATIONS];
+        weatherForecast *parsing = nullptr; // Forecast being parsed (nullptr when parsing the current weather)
+        bool cacheLoaded = false;
+
+        bool getData(const __FlashStringHelper *endpoint, const char *apiKey, float lat, float lon);
+        weatherForecast *findForecast(float lat, float lon);
+        void loadCache();
+        void saveCache();
+
     public:
         String currentWeather = "";
         String lastErrorMsg = "";
+        unsigned long dataReceived = 0;     // Size of the last response body (bytes)
+        unsigned long parseTime = 0;        // Time spent parsing the last response (us)
+        unsigned long forecastRequests = 0;
+        unsigned long cacheHits = 0;
 
         weatherClient();
+        void setApiHost(const char *host);
+
+        bool updateWeather(const char *apiKey, float lat, float lon);
+        bool updateForecast(const char *apiKey, float lat, float lon);
+        bool hasForecast(float lat, float lon);
+        bool forecastDue(float lat, float lon);
+        bool getForecastWeather(float lat, float lon, char *message, int size);
 
-        bool updateWeather(String apiKey, String lat, String lon);
-
-        virtual void whitespace(char c);
-        virtual void startDocument();
-        virtual void key(String key);
-        virtual void value(String value);
-        virtual void endArray();
-        virtual void endObject();
-        virtual void endDocument();
-        virtual void startArray();
-        virtual void startObject();
-};
\ No newline at end of file
+        virtual void startContainer(const jsonPath &path, bool isArray);
+        virtual void endContainer(const jsonPath &path, bool isArray);
+        virtual void value(const jsonPath &path, const char *value, int type);
+};
@@ -0,0 +1,252 @@
+#
+# Tiny Departures Board (c) 2026 Gadec Software
+#
+# Replay server - a local stand-in for the upstream APIs, replaying recorded responses with shaped delivery
+#
+# https://github.com/gadec-uk/tiny-departures-board
+#
+# This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+# To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+#
+# Answers the Darwin WSDL and SOAP requests, bustimes.org departure pages and stop details, OpenWeatherMap
+# weather and forecasts, the GitHub latest release and the National Rail station picker from the files in
+# test/fixtures, so refresh times can be measured under controlled network conditions. HTTPS is served on
+# port 443 (the board doesn't check certificates, a self-signed one is made with openssl if none is given) and
+# plain HTTP on port 80 for OpenWeatherMap. Point the board at it by setting wsdlHost, busHost, weatherHost,
+# githubHost and pickerHost in config.json to the address of the machine running it, then for example:
+#
+#   sudo python scripts/replayserver.py --latency 300 --rate 20000 --encoding chunked
+#   sudo python scripts/replayserver.py --stall-after 2048 --stall 4000 --match GetDepartureBoard
+#   sudo python scripts/replayserver.py --disconnect-after 3000 --variant worst
+#
+# A response comes from <fixture>-<key>.<ext> if there is one (the CRS code, ATCO code or search), otherwise
+# <fixture>.<ext>. With --variant the <fixture>-<key>.<variant>.<ext> and <fixture>.<variant>.<ext> files are
+# tried first. In the WSDL, {{host}} is replaced by the Host the request was sent to.
+#
+import argparse
+import http.server
+import os
+import re
+import socket
+import socketserver
+import ssl
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import urllib.parse
+
+# method, path pattern, body pattern (None for any), fixture, content type. The key of a fixture is the first
+# group of the path pattern or, for SOAP requests, of the body pattern.
+ROUTES = (
+    ("GET", r"^/OpenLDBWS/wsdl\.aspx", None, "darwin/wsdl.xml", "text/xml; charset=utf-8"),
+    ("POST", r"^/OpenLDBWS/", r"<\w+:GetDepartureBoardRequest.*?<\w+:crs>(\w+)<", "darwin/GetDepartureBoard.xml", "text/xml; charset=utf-8"),
+    ("POST", r"^/OpenLDBWS/", r"<\w+:GetServiceDetailsRequest.*?<\w+:serviceID>([^<]+)<", "darwin/GetServiceDetails.xml", "text/xml; charset=utf-8"),
+    ("GET", r"^/stops/([^/]+)/departures", None, "bustimes/departures.html", "text/html; charset=utf-8"),
+    ("GET", r"^/api/stops/([^/?]+)", None, "bustimes/stop.json", "application/json"),
+    ("GET", r"^/data/2\.5/weather", None, "owm/weather.json", "application/json; charset=utf-8"),
+    ("GET", r"^/data/2\.5/forecast", None, "owm/forecast.json", "application/json; charset=utf-8"),
+    ("GET", r"^/repos/[^/]+/[^/]+/releases/latest", None, "github/release.json", "application/json; charset=utf-8"),
+    ("GET", r"^/stationPicker/([^/?]+)", None, "stationpicker/stations.json", "application/json"),
+)
+
+
+def findFixture(root, fixture, key, variant):
+    base, ext = os.path.splitext(fixture)
+    names = []
+    for v in ([variant, None] if variant else [None]):
+        suffix = ("." + v if v else "") + ext
+        if key:
+            names.append(base + "-" + re.sub(r"[^\w.-]", "_", key.lower()) + suffix)
+        names.append(base + suffix)
+    for name in names:
+        path = os.path.join(root, name)
+        if os.path.exists(path):
+            return path
+    return None
+
+
+class ReplayHandler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    options = None
+    requests = 0
+    lock = threading.Lock()
+
+    def log_message(self, format, *args):
+        pass
+
+    def do_GET(self):
+        self.replay(b"")
+
+    def do_POST(self):
+        length = int(self.headers.get("Content-Length", 0))
+        self.replay(self.rfile.read(length) if length else b"")
+
+    def route(self, body):
+        text = body.decode("utf-8", "replace")
+        for method, pathPattern, bodyPattern, fixture, contentType in ROUTES:
+            if method != self.command:
+                continue
+            pathMatch = re.search(pathPattern, self.path)
+            if not pathMatch:
+                continue
+            key = pathMatch.group(1) if pathMatch.groups() else None
+            if bodyPattern:
+                bodyMatch = re.search(bodyPattern, text, re.S)
+                if not bodyMatch:
+                    continue
+                key = bodyMatch.group(1)
+            return fixture, urllib.parse.unquote(key) if key else None, contentType
+        return None, None, None
+
+    def replay(self, body):
+        opts = self.options
+        with ReplayHandler.lock:
+            ReplayHandler.requests += 1
+            number = ReplayHandler.requests
+        start = time.monotonic()
+        fixture, key, contentType = self.route(body)
+        path = findFixture(opts.fixtures, fixture, key, opts.variant) if fixture else None
+        if not path:
+            self.send_error(404, "No fixture for %s %s" % (self.command, self.path))
+            print("%4d %s %s -> 404" % (number, self.command, self.path), flush=True)
+            return
+        with open(path, "rb") as f:
+            data = f.read()
+        if fixture == "darwin/wsdl.xml":
+            host = self.headers.get("Host", "localhost").split(":")[0]
+            data = data.replace(b"{{host}}", host.encode("ascii"))
+
+        # Faults only apply to the requests they're aimed at
+        faults = not opts.match or re.search(opts.match, self.path + " " + body.decode("utf-8", "replace"))
+        keepAlive = (self.request_version == "HTTP/1.1" and self.headers.get("Connection", "").lower() != "close")
+        chunked = opts.encoding == "chunked" and self.request_version == "HTTP/1.1"
+
+        time.sleep(opts.latency / 1000.0)
+        headers = ["HTTP/1.1 200 OK", "Content-Type: " + contentType, "Cache-Control: no-cache"]
+        headers.append("Transfer-Encoding: chunked" if chunked else "Content-Length: %d" % len(data))
+        headers.append("Connection: " + ("keep-alive" if keepAlive else "close"))
+        self.wfile.write(("\r\n".join(headers) + "\r\n\r\n").encode("ascii"))
+        self.wfile.flush()
+
+        sent, outcome = self.sendBody(data, chunked, faults)
+        self.close_connection = not keepAlive or outcome != "ok"
+        print("%4d %s %s -> %s [%s] %d/%d bytes%s in %dms %s" % (number, self.command, self.path.split("?")[0],
+              os.path.relpath(path, opts.fixtures), "chunked" if chunked else "identity", sent, len(data),
+              "" if keepAlive else ", close", (time.monotonic() - start) * 1000, outcome), flush=True)
+
+    def sendBody(self, data, chunked, faults):
+        opts = self.options
+        segment = opts.chunk if chunked else opts.segment
+        sent = 0
+        stalled = False
+        started = time.monotonic()
+        while sent < len(data):
+            end = min(sent + segment, len(data))
+            if faults and opts.disconnect_after is not None and end > opts.disconnect_after:
+                end = max(sent, opts.disconnect_after)
+            if faults and opts.stall_after is not None and not stalled and end > opts.stall_after:
+                end = max(sent, opts.stall_after)
+            piece = data[sent:end]
+            if piece:
+                try:
+                    if chunked:
+                        self.wfile.write(b"%x\r\n" % len(piece) + piece + b"\r\n")
+                    else:
+                        self.wfile.write(piece)
+                    self.wfile.flush()
+                except (BrokenPipeError, ConnectionResetError, ssl.SSLError):
+                    return sent, "client went away"
+                sent = end
+                if opts.rate:
+                    # Hold the average rate to the cap since the body started
+                    wait = started + sent / float(opts.rate) - time.monotonic()
+                    if wait > 0:
+                        time.sleep(wait)
+            if faults and opts.disconnect_after is not None and sent >= opts.disconnect_after:
+                self.abort()
+                return sent, "disconnected"
+            if faults and opts.stall_after is not None and not stalled and sent >= opts.stall_after:
+                stalled = True
+                time.sleep(opts.stall / 1000.0)
+                started += opts.stall / 1000.0
+        if chunked:
+            self.wfile.write(b"0\r\n\r\n")
+            self.wfile.flush()
+        return sent, "ok"
+
+    def abort(self):
+        # Drop the connection without a TLS close_notify or a chunked terminator, as a failing network would
+        try:
+            self.connection.setsockopt(socket.SOL_SOCKET, socket.SO_LINGER, struct.pack("ii", 1, 0))
+            self.connection.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+
+
+class ReplayServer(socketserver.ThreadingMixIn, http.server.HTTPServer):
+    daemon_threads = True
+    allow_reuse_address = True
+
+
+def makeCertificate(directory):
+    cert = os.path.join(directory, "replay.pem")
+    key = os.path.join(directory, "replay.key")
+    subprocess.run(["openssl", "req", "-x509", "-newkey", "rsa:2048", "-nodes", "-days", "30", "-subj", "/CN=replayserver",
+                    "-keyout", key, "-out", cert], check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return cert, key
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description="Replay recorded API responses to the board with shaped delivery")
+    parser.add_argument("--fixtures", default=os.path.join(root, "test", "fixtures"), help="fixture directory")
+    parser.add_argument("--variant", help="prefer <fixture>.<variant> files, e.g. small or worst")
+    parser.add_argument("--bind", default="0.0.0.0", help="address to listen on")
+    parser.add_argument("--tls-port", type=int, default=443, help="HTTPS port (0 to disable)")
+    parser.add_argument("--http-port", type=int, default=80, help="HTTP port for OpenWeatherMap (0 to disable)")
+    parser.add_argument("--cert", help="certificate (PEM), made with openssl if not given")
+    parser.add_argument("--key", help="private key (PEM) for the certificate")
+    parser.add_argument("--latency", type=int, default=0, help="delay before each response (ms)")
+    parser.add_argument("--rate", type=int, default=0, help="throughput cap (bytes/s, 0 for none)")
+    parser.add_argument("--segment", type=int, default=1460, help="bytes per write (identity encoding)")
+    parser.add_argument("--encoding", choices=("identity", "chunked"), default="identity",
+                        help="body encoding for HTTP/1.1 requests (HTTP/1.0 requests always get identity)")
+    parser.add_argument("--chunk", type=int, default=1024, help="chunk size (chunked encoding)")
+    parser.add_argument("--stall-after", type=int, help="stall once this many body bytes have been sent")
+    parser.add_argument("--stall", type=int, default=5000, help="length of the stall (ms)")
+    parser.add_argument("--disconnect-after", type=int, help="drop the connection after this many body bytes")
+    parser.add_argument("--match", help="only stall or disconnect requests whose path or body matches this regex")
+    opts = parser.parse_args()
+    ReplayHandler.options = opts
+
+    servers = []
+    if opts.tls_port:
+        cert, key = opts.cert, opts.key
+        if not cert:
+            cert, key = makeCertificate(tempfile.mkdtemp(prefix="replayserver"))
+        context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        context.load_cert_chain(cert, key)
+        server = ReplayServer((opts.bind, opts.tls_port), ReplayHandler)
+        server.socket = context.wrap_socket(server.socket, server_side=True)
+        servers.append(server)
+    if opts.http_port:
+        servers.append(ReplayServer((opts.bind, opts.http_port), ReplayHandler))
+    if not servers:
+        sys.exit("replayserver: no ports to listen on")
+
+    for server in servers:
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        print("replayserver: listening on %s:%d (%s)" % (opts.bind, server.server_address[1],
+              "https" if isinstance(server.socket, ssl.SSLSocket) else "http"), flush=True)
+    try:
+        while True:
+            time.sleep(3600)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,198 @@
+#
+# Tiny Departures Board (c) 2026 Gadec Software
+#
+# Station Index generator - builds the offline station picker index from a CSV of stations
+#
+# https://github.com/gadec-uk/tiny-departures-board
+#
+# This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+# To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+#
+# The CSV needs a header row with CRS code, station name and either latitude/longitude or OS grid
+# easting/northing columns. NaPTAN's RailReferences.csv (Open Government Licence) works as is, its grid
+# references are converted to WGS84. Run it standalone:
+#
+#   python scripts/stationindex.py [stations.csv] [stationIndexData.h]
+#
+# or from platformio.ini (extra_scripts = pre:scripts/stationindex.py), where the index is rebuilt before
+# compiling whenever scripts/stations.csv is newer than the generated header. Without a CSV the existing
+# header is left alone. The committed CSV is a starter list of the principal stations, stations missing from
+# the index are looked up with the National Rail station picker.
+#
+import csv
+import math
+import os
+import re
+import sys
+import unicodedata
+
+CRS_COLUMNS = ("crs", "crscode", "crs code", "crs_code")
+NAME_COLUMNS = ("name", "stationname", "station name", "station_name")
+LAT_COLUMNS = ("lat", "latitude")
+LON_COLUMNS = ("lon", "long", "longitude")
+EASTING_COLUMNS = ("easting",)
+NORTHING_COLUMNS = ("northing",)
+MAX_NAME = 48           # Longest name kept (MAXLOCATIONSIZE on the board)
+
+
+def findColumn(header, names, required=True):
+    for i, column in enumerate(header):
+        if column.strip().lower() in names:
+            return i
+    if required:
+        raise SystemExit("stationindex: no %s column in the CSV header" % names[0])
+    return None
+
+
+def gridToLatLon(easting, northing):
+    # OS National Grid (OSGB36, Airy 1830) to WGS84, accurate to a few metres - the Ordnance Survey's
+    # transverse Mercator inverse followed by a Helmert transformation
+    a, b = 6377563.396, 6356256.909
+    f0, lat0, lon0, n0, e0 = 0.9996012717, math.radians(49), math.radians(-2), -100000, 400000
+    e2 = 1 - (b * b) / (a * a)
+    n = (a - b) / (a + b)
+    lat = lat0
+    m = 0
+    while True:
+        lat = (northing - n0 - m) / (a * f0) + lat
+        m = b * f0 * ((1 + n + 1.25 * n ** 2 + 1.25 * n ** 3) * (lat - lat0)
+                      - (3 * n + 3 * n ** 2 + 2.625 * n ** 3) * math.sin(lat - lat0) * math.cos(lat + lat0)
+                      + (1.875 * n ** 2 + 1.875 * n ** 3) * math.sin(2 * (lat - lat0)) * math.cos(2 * (lat + lat0))
+                      - (35 / 24) * n ** 3 * math.sin(3 * (lat - lat0)) * math.cos(3 * (lat + lat0)))
+        if abs(northing - n0 - m) < 0.00001:
+            break
+    sinLat, tanLat = math.sin(lat), math.tan(lat)
+    nu = a * f0 / math.sqrt(1 - e2 * sinLat ** 2)
+    rho = a * f0 * (1 - e2) / (1 - e2 * sinLat ** 2) ** 1.5
+    eta2 = nu / rho - 1
+    secLat = 1 / math.cos(lat)
+    de = easting - e0
+    lat = (lat - tanLat / (2 * rho * nu) * de ** 2
+           + tanLat / (24 * rho * nu ** 3) * (5 + 3 * tanLat ** 2 + eta2 - 9 * tanLat ** 2 * eta2) * de ** 4
+           - tanLat / (720 * rho * nu ** 5) * (61 + 90 * tanLat ** 2 + 45 * tanLat ** 4) * de ** 6)
+    lon = (lon0 + secLat / nu * de
+           - secLat / (6 * nu ** 3) * (nu / rho + 2 * tanLat ** 2) * de ** 3
+           + secLat / (120 * nu ** 5) * (5 + 28 * tanLat ** 2 + 24 * tanLat ** 4) * de ** 5
+           - secLat / (5040 * nu ** 7) * (61 + 662 * tanLat ** 2 + 1320 * tanLat ** 4 + 720 * tanLat ** 6) * de ** 7)
+
+    # Airy 1830 to cartesian, Helmert to WGS84 (GRS80) and back to latitude/longitude
+    h = 0
+    nu = a / math.sqrt(1 - e2 * math.sin(lat) ** 2)
+    x = (nu + h) * math.cos(lat) * math.cos(lon)
+    y = (nu + h) * math.cos(lat) * math.sin(lon)
+    z = ((1 - e2) * nu + h) * math.sin(lat)
+    tx, ty, tz, s = 446.448, -125.157, 542.060, -20.4894e-6
+    rx, ry, rz = (math.radians(v / 3600) for v in (0.1502, 0.2470, 0.8421))
+    x, y, z = (tx + (1 + s) * x - rz * y + ry * z,
+               ty + rz * x + (1 + s) * y - rx * z,
+               tz - ry * x + rx * y + (1 + s) * z)
+    a, b = 6378137.0, 6356752.3141
+    e2 = 1 - (b * b) / (a * a)
+    p = math.sqrt(x * x + y * y)
+    lat = math.atan2(z, p * (1 - e2))
+    for _ in range(10):
+        nu = a / math.sqrt(1 - e2 * math.sin(lat) ** 2)
+        lat = math.atan2(z + e2 * nu * math.sin(lat), p)
+    return math.degrees(lat), math.degrees(math.atan2(y, x))
+
+
+def asciiName(name):
+    name = unicodedata.normalize("NFKD", name).encode("ascii", "ignore").decode("ascii")
+    name = re.sub(r"\s+(Rail|Railway) Station$", "", " ".join(name.split()))    # NaPTAN names
+    return name[:MAX_NAME - 1]
+
+
+def readStations(path):
+    stations = {}
+    with open(path, newline="", encoding="utf-8-sig") as f:
+        rows = csv.reader(f)
+        header = next(rows, None)
+        if header is None:
+            return []
+        crsCol = findColumn(header, CRS_COLUMNS)
+        nameCol = findColumn(header, NAME_COLUMNS)
+        latCol = findColumn(header, LAT_COLUMNS, False)
+        lonCol = findColumn(header, LON_COLUMNS, False)
+        grid = latCol is None or lonCol is None
+        if grid:
+            eastCol = findColumn(header, EASTING_COLUMNS)
+            northCol = findColumn(header, NORTHING_COLUMNS)
+        for row in rows:
+            try:
+                crs = row[crsCol].strip().upper()
+                name = asciiName(row[nameCol])
+                if grid:
+                    lat, lon = gridToLatLon(float(row[eastCol]), float(row[northCol]))
+                else:
+                    lat = float(row[latCol])
+                    lon = float(row[lonCol])
+            except (IndexError, ValueError):
+                continue
+            if len(crs) != 3 or not crs.isalpha() or not name or crs in stations:
+                continue
+            stations[crs] = (name, round(lat * 100000), round(lon * 100000))
+    return sorted(((v[0], crs, v[1], v[2]) for crs, v in stations.items()), key=lambda s: (s[0].lower(), s[1]))
+
+
+def wordStarts(name):
+    # Every letter or digit that follows a space or punctuation starts a word that can be searched for
+    return [i for i, c in enumerate(name) if c.isalnum() and (i == 0 or not name[i - 1].isalnum()) and i < 256]
+
+
+def cString(text):
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '\\0"'
+
+
+def writeHeader(stations, path):
+    keys = sorted(((s[0][o:].lower(), n, o) for n, s in enumerate(stations) for o in wordStarts(s[0])),
+                  key=lambda k: (k[0].encode("ascii"), k[1]))
+    names = []
+    offset = 0
+    records = []
+    for name, crs, lat, lon in stations:
+        records.append('    {"%s",%d,%d,%d},' % (crs, offset, lat, lon))
+        names.append("    " + cString(name))
+        offset += len(name) + 1
+
+    with open(path, "w", newline="\n") as f:
+        f.write("/*\n * Tiny Departures Board (c) 2026 Gadec Software\n *\n")
+        f.write(" * Station Index data - generated by scripts/stationindex.py, do not edit\n")
+        f.write(" *\n * https://github.com/gadec-uk/tiny-departures-board\n *\n")
+        f.write(" * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.\n")
+        f.write(" * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/\n */\n")
+        f.write("#pragma once\n\n")
+        f.write("#define STATIONINDEX_STATIONS %d\n" % len(stations))
+        f.write("#define STATIONINDEX_KEYS %d\n\n" % len(keys))
+        # The arrays can't be empty, an index without stations still has a (never used) first entry
+        f.write("static const char stationNames[] PROGMEM =\n")
+        f.write("\n".join(names) if names else '    ""')
+        f.write(";\n\nstatic const stationRecord stationRecords[] PROGMEM = {\n")
+        f.write("\n".join(records) if records else '    {"",0,0,0},')
+        f.write("\n};\n\nstatic const stationKey stationKeys[] PROGMEM = {\n")
+        for i in range(0, len(keys), 8):
+            f.write("    " + "".join("{%d,%d}," % (k[1], k[2]) for k in keys[i:i + 8]) + "\n")
+        if not keys:
+            f.write("    {0,0},\n")
+        f.write("};\n")
+    print("stationindex: %d stations, %d search keys written to %s" % (len(stations), len(keys), path))
+
+
+def build(source, target):
+    writeHeader(readStations(source), target)
+
+
+if __name__ == "__main__":
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    source = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, "scripts", "stations.csv")
+    target = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, "lib", "stationIndex", "stationIndexData.h")
+    build(source, target)
+else:
+    # Running as a PlatformIO pre: script
+    Import("env")  # noqa: F821
+    root = env.subst("$PROJECT_DIR")  # noqa: F821
+    source = os.path.join(root, "scripts", "stations.csv")
+    target = os.path.join(root, "lib", "stationIndex", "stationIndexData.h")
+    if os.path.exists(source) and (not os.path.exists(target) or os.path.getmtime(source) > os.path.getmtime(target)):
+        build(source, target)
+    elif not os.path.exists(source):
+        print("stationindex: no scripts/stations.csv, the station picker index is left as it is")
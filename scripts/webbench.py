@@ -0,0 +1,120 @@
+#
+# Tiny Departures Board (c) 2026 Gadec Software
+#
+# Web GUI benchmark - times how long the board takes to serve a page, from connecting to the last byte
+#
+# https://github.com/gadec-uk/tiny-departures-board
+#
+# This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+# To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+#
+# Requests a page (by default /index.htm, served gzipped from flash) a number of times and reports the time to
+# the first and last byte of each response, checking the body length matches Content-Length. To compare two
+# firmware builds, save the results from the first and compare the second against them:
+#
+#   python scripts/webbench.py 192.168.1.50 --save before.json
+#   (flash the other build)
+#   python scripts/webbench.py 192.168.1.50 --compare before.json
+#
+# --identity asks for the page without gzip, so it's inflated on the board as it's sent. Run both builds on the
+# same WiFi network with the board showing the same board mode, as a data refresh holds up the web server.
+#
+import argparse
+import json
+import socket
+import statistics
+import sys
+import time
+
+LABELS = (("firstByte", "time to first byte"), ("lastByte", "time to last byte"))
+
+
+def fetch(host, port, path, gzip, timeout):
+    request = "GET %s HTTP/1.1\r\nHost: %s\r\nAccept-Encoding: %s\r\nConnection: close\r\n\r\n" % (
+        path, host, "gzip, deflate" if gzip else "identity")
+    start = time.perf_counter()
+    sock = socket.create_connection((host, port), timeout)
+    try:
+        sock.sendall(request.encode("ascii"))
+        data = b""
+        firstByte = None
+        while True:
+            chunk = sock.recv(16384)
+            if not chunk:
+                break
+            if firstByte is None:
+                firstByte = time.perf_counter()
+            data += chunk
+        lastByte = time.perf_counter()
+    finally:
+        sock.close()
+
+    head, _, body = data.partition(b"\r\n\r\n")
+    lines = head.decode("latin-1").split("\r\n")
+    if lines[0].split(" ")[1:2] != ["200"]:
+        raise RuntimeError("%s: %s" % (path, lines[0]))
+    headers = dict(line.split(":", 1) for line in lines[1:] if ":" in line)
+    headers = {k.strip().lower(): v.strip() for k, v in headers.items()}
+    length = int(headers.get("content-length", -1))
+    if length != len(body):
+        raise RuntimeError("%s: Content-Length %d but %d bytes received" % (path, length, len(body)))
+    return (firstByte - start) * 1000, (lastByte - start) * 1000, len(body), headers.get("content-encoding", "identity")
+
+
+def summary(times):
+    times = sorted(times)
+    return {"min": times[0], "median": statistics.median(times), "p90": times[min(len(times) - 1, len(times) * 9 // 10)],
+            "max": times[-1]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Time the board serving a Web GUI page")
+    parser.add_argument("host", help="address of the board")
+    parser.add_argument("--port", type=int, default=80, help="web server port")
+    parser.add_argument("--path", default="/index.htm", help="page to request")
+    parser.add_argument("--runs", type=int, default=50, help="number of requests")
+    parser.add_argument("--pause", type=float, default=0.2, help="wait between requests (s)")
+    parser.add_argument("--identity", action="store_true", help="ask for the page without gzip")
+    parser.add_argument("--timeout", type=float, default=10, help="socket timeout (s)")
+    parser.add_argument("--save", help="save the results to this file")
+    parser.add_argument("--compare", help="compare with results saved by an earlier run")
+    args = parser.parse_args()
+
+    firstBytes = []
+    lastBytes = []
+    size = encoding = None
+    for _ in range(args.runs):
+        try:
+            ttfb, ttlb, size, encoding = fetch(args.host, args.port, args.path, not args.identity, args.timeout)
+        except (OSError, RuntimeError) as e:
+            print("webbench: %s" % e, file=sys.stderr)
+            continue
+        firstBytes.append(ttfb)
+        lastBytes.append(ttlb)
+        time.sleep(args.pause)
+    if not lastBytes:
+        sys.exit("webbench: no successful requests")
+
+    results = {"path": args.path, "encoding": encoding, "bytes": size, "runs": len(lastBytes),
+               "firstByte": summary(firstBytes), "lastByte": summary(lastBytes)}
+    print("%s: %d bytes (%s), %d of %d requests" % (args.path, size, encoding, len(lastBytes), args.runs))
+    print("%-22s %9s %9s %9s %9s" % ("ms", "min", "median", "p90", "max"))
+    for name, label in LABELS:
+        print("%-22s %9.1f %9.1f %9.1f %9.1f" % ((label,) + tuple(results[name][k] for k in ("min", "median", "p90", "max"))))
+
+    if args.compare:
+        with open(args.compare) as f:
+            before = json.load(f)
+        if before["path"] != args.path or before["encoding"] != encoding:
+            print("webbench: %s compares %s (%s)" % (args.compare, before["path"], before["encoding"]), file=sys.stderr)
+        print("%-22s %9s %9s %9s" % ("median ms", "before", "after", "change"))
+        for name, label in LABELS:
+            b, a = before[name]["median"], results[name]["median"]
+            print("%-22s %9.1f %9.1f %+8.0f%%" % (label, b, a, (a - b) * 100 / b if b else 0))
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(results, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
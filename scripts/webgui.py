@@ -0,0 +1,92 @@
+#
+# Tiny Departures Board (c) 2026 Gadec Software
+#
+# Web GUI generator - minifies and gzips the web/ pages into the PROGMEM arrays in include/webgui and writes
+# the ETags of every flash asset
+#
+# https://github.com/gadec-uk/tiny-departures-board
+#
+# This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+# To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+#
+# Each page has its indentation and blank lines removed and is gzipped into the array of its header, the rest
+# of the header (version defines etc.) is left alone. The board sends the gzipped page with Content-Encoding:
+# gzip, or inflates it for a browser that doesn't accept gzip. The ETag of each asset (a hash of its array) goes
+# in include/webgui/etags.h, so browsers can revalidate them cheaply. Run it from platformio.ini
+# (extra_scripts = pre:scripts/webgui.py), where a header is rebuilt whenever its page is newer, or standalone:
+#
+#   python scripts/webgui.py
+#
+import gzip
+import hashlib
+import os
+import re
+
+PAGES = (
+    ("web/index.htm", "include/webgui/index.h", "indexhtm"),
+    ("web/keys.htm", "include/webgui/keys.h", "keyshtm"),
+)
+ASSET_HEADERS = ("include/webgui/index.h", "include/webgui/keys.h", "include/webgui/webgraphics.h")
+ETAG_HEADER = "include/webgui/etags.h"
+BYTES_PER_LINE = 21
+
+
+def minify(path):
+    with open(path, encoding="utf-8") as f:
+        lines = [line.lstrip(" \t") for line in f.read().split("\n")]
+    return ("\r\n".join(line for line in lines if line.strip()) + "\r\n").encode("utf-8")
+
+
+def build(root, source, header, name):
+    data = gzip.compress(minify(os.path.join(root, source)), compresslevel=9, mtime=0)
+    path = os.path.join(root, header)
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    match = re.search(r"(%s\[\] PROGMEM=\{\n)(.*?)(\n\};)" % name, text, re.S)
+    if not match:
+        raise SystemExit("webgui: no %s array in %s" % (name, header))
+    rows = (", ".join("0x%02X" % b for b in data[i:i + BYTES_PER_LINE]) for i in range(0, len(data), BYTES_PER_LINE))
+    text = text[:match.start(2)] + ",\n".join(rows) + text[match.end(2):]
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    print("webgui: %s gzipped to %d bytes in %s" % (source, len(data), header))
+
+
+def writeEtags(root):
+    lines = ["// ETags of the Web GUI assets built into the firmware - generated by scripts/webgui.py, do not edit",
+             "#pragma once", ""]
+    for header in ASSET_HEADERS:
+        with open(os.path.join(root, header), encoding="utf-8") as f:
+            text = f.read()
+        for match in re.finditer(r"uint8_t (\w+)\[\] PROGMEM\s*=\s*\{(.*?)\};", text, re.S):
+            data = bytes(int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", match.group(2)))
+            etag = hashlib.sha1(data).hexdigest()[:16]
+            lines.append('#define ETAG_%s "\\"%s\\""' % (match.group(1).upper(), etag))
+    text = "\n".join(lines) + "\n"
+
+    # Only rewrite the header when an asset has changed, so it doesn't trigger a rebuild
+    path = os.path.join(root, ETAG_HEADER)
+    if os.path.exists(path):
+        with open(path, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    print("webgui: ETags written to %s" % ETAG_HEADER)
+
+
+def buildAll(root, force):
+    for source, header, name in PAGES:
+        sourcePath = os.path.join(root, source)
+        headerPath = os.path.join(root, header)
+        if force or os.path.getmtime(sourcePath) > os.path.getmtime(headerPath):
+            build(root, source, header, name)
+    writeEtags(root)
+
+
+if __name__ == "__main__":
+    buildAll(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), True)
+else:
+    # Running as a PlatformIO pre: script
+    Import("env")  # noqa: F821
+    buildAll(env.subst("$PROJECT_DIR"), False)  # noqa: F821
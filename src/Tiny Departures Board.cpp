@@ -40,10 +40,23 @@
 #include <stationData.h>
 #include <raildataXmlClient.h>
 #include <busDataClient.h>
+#include <busStopCache.h>
 #include <githubClient.h>
+#include <perfMonitor.h>
+#include <requestBuilder.h>
+#include <socketUtils.h>
+#include <dnsCache.h>
+#include <refreshScheduler.h>
+#include <apiQuota.h>
+#include <serviceFilter.h>
+#include <stationIndex.h>
+#include <responseCache.h>
+#include <gzipInflater.h>
+#include <boardClock.h>
 #include <webgui/webgraphics.h>
 #include <webgui/index.h>
 #include <webgui/keys.h>
+#include <webgui/etags.h>
 
 #include <time.h>
 #include <U8g2lib.h>
@@ -51,6 +64,8 @@
 #define msDay 86400000 // 86400000 milliseconds in a day
 #define msHour 3600000 // 3600000 milliseconds in an hour
 #define msMin 60000 // 60000 milliseconds in a second
+#define FLASHSEGMENTSIZE CONFIG_LWIP_TCP_SND_BUF_DEFAULT  // Flash assets are written a TCP send buffer at a time
+#define IMAGEMAXAGE 604800  // How long browsers can use the images without checking for a new version (secs - 7 days)
 
 WebServer server(80);     // Hosting the Web GUI
 File fsUploadFile;        // File uploads
@@ -251,19 +266,23 @@ bool wifiConfigured = false;        // Is WiFi configured successfully?
 // Station Board Data
 char nrToken[37] = "";              // National Rail Darwin Lite Tokens are in the format nnnnnnnn-nnnn-nnnn-nnnn-nnnnnnnnnnnn, where each 'n' represents a hexadecimal character (0-9 or a-f).
 char crsCode[4] = "";               // Station code (3 character)
+char extraCrsCodes[RAILMAXSTATIONS-1][4]; // Nearby stations merged onto the same board
 float stationLat=0;                 // Selected station Latitude/Longitude (used to get weather for the location)
 float stationLon=0;
 char callingCrsCode[4] = "";        // Station code to filter routes on
 char callingStation[45] = "";       // Calling filter station friendly name
 char platformFilter[MAXPLATFORMFILTERSIZE]; // CSV list of platforms to filter on
-char cleanPlatformFilter[MAXPLATFORMFILTERSIZE]; // Cleaned up platform filter (for performance)
+serviceFilter platformMatcher;      // Compiled platform filter
 char busAtco[13]="";                // Bus Stop ATCO location
+char busExtraAtco[BUSMAXSTOPS-1][13]; // Other stops merged onto the same board (e.g. the opposite side of the road)
 String busName="";                  // Bus Stop long name
 int busDestX;                       // Variable margin for bus destination
 char busFilter[25]="";              // CSV list of services to filter on
-char cleanBusFilter[25];            // Cleaned up bus filter (for performance)
+serviceFilter busMatcher;           // Compiled bus service filter
 float busLat=0;                     // Bus stop Latitude/Longitude (used to get weather for the location)
 float busLon=0;
+bool busStopStale = false;          // The cached details of the bus stop need refreshing
+unsigned long nextBusStopRefresh=0; // Next attempt to refresh them (ms)
 
 // tiny board has two possible modes.
 enum boardModes {
@@ -299,11 +318,23 @@ unsigned long viaTimer=0;
 bool showingMessage = false;
 int scrollPrimaryYpos = 0;
 bool isScrollingPrimary = false;
+byte scrollPrimaryRows = 0;         // Bus board lines being scrolled in (bit 0 is the top line)
+int busBoardServices = -1;          // Number of services and destination column last drawn on the bus board
+int busBoardDestX = 0;
+byte busEtdWidth[MAXBOARDSERVICES]; // Width of the time last drawn for each bus service
 
 char displayedTime[29] = "";        // The currently displayed time
 unsigned long nextClockUpdate = 0;  // Next time we need to check/update the clock display
 int fpsDelay=25;                    // Total ms between text movement (for smooth animation)
 unsigned long refreshTimer = 0;
+boardClock *loopClock = &systemClock;  // Time source for the board loops (swap in a simulatedClock to drive them)
+
+// Animation & refresh timing statistics (reported in /info)
+unsigned long framesRendered = 0;       // Total number of frames sent to the display
+unsigned long frameOverruns = 0;        // Frames where processing took longer than the frame time
+unsigned long maxFrameTime = 0;         // Longest frame processing time (ms)
+unsigned long firstBoardTime = 0;       // Time from boot to the first board being drawn (ms)
+unsigned long lastRefreshInterval = 0;  // Time between the last two successful data loads (ms)
 
 // Weather Stuff
 char weatherMsg[46];                            // Current weather at station location
@@ -315,12 +346,18 @@ bool noDataLoaded = true;                       // True if no data received for
 int lastUpdateResult = 0;                       // Result of last data refresh
 unsigned long lastDataLoadTime = 0;             // Timestamp of last data load
 long apiRefreshRate = DATAUPDATEINTERVAL;       // User selected refresh rate for National Rail API
+refreshScheduler scheduler(DATAUPDATEINTERVAL); // Picks the interval to the next data update
 
 #define MAXHOSTSIZE 48                          // Maximum size of the wsdl Host
 #define MAXAPIURLSIZE 48                        // Maximum size of the wsdl url
 
 char wsdlHost[MAXHOSTSIZE];                     // wsdl Host name
 char wsdlAPI[MAXAPIURLSIZE];                    // wsdl API url
+char busHost[MAXHOSTSIZE];                      // bustimes.org Host name
+char weatherHost[MAXHOSTSIZE];                  // OpenWeatherMap Host name
+char githubHost[MAXHOSTSIZE];                   // GitHub API Host name
+char pickerHost[MAXHOSTSIZE];                   // National Rail station picker Host name
+bool pickerFallback = true;                     // Ask the National Rail station picker when the station index has no match
 
 // RailData XML Client
 raildataXmlClient* raildata = nullptr;
@@ -628,6 +665,32 @@ void doClockCheck() {
   }
 }
 
+// Keep track of frame timing. Called once per frame with the ms remaining before the frame is due
+// (negative if the frame processing overran).
+void updateFrameStats(long delayMs) {
+  unsigned long frameTime = loopClock->millis()-refreshTimer;
+  framesRendered++;
+  if (delayMs<0) frameOverruns++;
+  // Ignore frames that included a data refresh, these block for the duration of the download
+  if (frameTime>maxFrameTime && frameTime<1000) maxFrameTime=frameTime;
+}
+
+// Minutes until the first departure on the board, using the expected time if there is one (-1 if unknown)
+int minutesToFirstDeparture() {
+  int h, m;
+  if (!station.numServices || !getLocalTime(&timeinfo,0)) return -1;
+  if (sscanf(station.service[0].etd,"%d:%d",&h,&m)!=2 && sscanf(station.service[0].sTime,"%d:%d",&h,&m)!=2) return -1;
+  int mins = (h*60+m) - (timeinfo.tm_hour*60+timeinfo.tm_min);
+  if (mins < -720) mins += 1440;  // Departure is after midnight
+  return (mins < 0) ? 0 : mins;
+}
+
+// Schedule the next data update after a successful refresh
+void scheduleNextUpdate(bool boardChanged) {
+  int hour = getLocalTime(&timeinfo,0) ? timeinfo.tm_hour : -1;
+  nextDataUpdate = millis() + scheduler.success(boardChanged,minutesToFirstDeparture(),station.numServices,hour);
+}
+
 // Callback from the raildataXMLclient library when processing data. As this can take some time, this callback is used to keep the clock working
 // and to provide progress on the initial load at boot
 void raildataCallback(int stage, int nServices) {
@@ -682,6 +745,36 @@ void writeDefaultConfig() {
     strcpy(crsCode,"");
 }
 
+// Split a comma separated list of additional bus stop ATCO codes
+void setBusExtraStops(const char *ids) {
+  int stop = 0;
+  while (*ids && stop < BUSMAXSTOPS-1) {
+    while (*ids == ',' || isspace(*ids)) ids++;
+    int len = 0;
+    while (ids[len] && ids[len] != ',' && !isspace(ids[len])) len++;
+    if (len && len < (int)sizeof(busExtraAtco[0])) {
+      memcpy(busExtraAtco[stop],ids,len);
+      busExtraAtco[stop++][len] = '\0';
+    }
+    ids += len;
+  }
+}
+
+// Split a comma separated list of additional station CRS codes
+void setExtraStations(const char *codes) {
+  int stn = 0;
+  while (*codes && stn < RAILMAXSTATIONS-1) {
+    while (*codes == ',' || isspace(*codes)) codes++;
+    int len = 0;
+    while (codes[len] && codes[len] != ',' && !isspace(codes[len])) len++;
+    if (len == 3) {
+      for (int i=0;i<3;i++) extraCrsCodes[stn][i] = toupper(codes[i]);
+      extraCrsCodes[stn++][3] = '\0';
+    }
+    codes += len;
+  }
+}
+
 // Load the configuration settings (if they exist, if not create a default set for the Web GUI page to read)
 void loadConfig() {
   JsonDocument doc;
@@ -689,6 +782,8 @@ void loadConfig() {
   // Set defaults
   strcpy(hostname,defaultHostname);
   timezone = String(ukTimezone);
+  for (int i=0;i<BUSMAXSTOPS-1;i++) busExtraAtco[i][0] = '\0';
+  for (int i=0;i<RAILMAXSTATIONS-1;i++) extraCrsCodes[i][0] = '\0';
 
   if (LittleFS.exists(F("/config.json"))) {
     File file = LittleFS.open(F("/config.json"), "r");
@@ -698,17 +793,26 @@ void loadConfig() {
         JsonObject settings = doc.as<JsonObject>();
 
         if (settings[F("crs")].is<const char*>())        strlcpy(crsCode, settings[F("crs")], sizeof(crsCode));
+        if (settings[F("extraCrs")].is<const char*>())   setExtraStations(settings[F("extraCrs")]);
         if (settings[F("callingCrs")].is<const char*>()) strlcpy(callingCrsCode, settings[F("callingCrs")], sizeof(callingCrsCode));
         if (settings[F("callingStation")].is<const char*>()) strlcpy(callingStation, settings[F("callingStation")], sizeof(callingStation));
         if (settings[F("platformFilter")].is<const char*>())  strlcpy(platformFilter, settings[F("platformFilter")], sizeof(platformFilter));
         if (settings[F("hostname")].is<const char*>())   strlcpy(hostname, settings[F("hostname")], sizeof(hostname));
         if (settings[F("wsdlHost")].is<const char*>())   strlcpy(wsdlHost, settings[F("wsdlHost")], sizeof(wsdlHost));
         if (settings[F("wsdlAPI")].is<const char*>())    strlcpy(wsdlAPI, settings[F("wsdlAPI")], sizeof(wsdlAPI));
+        if (settings[F("busHost")].is<const char*>())    strlcpy(busHost, settings[F("busHost")], sizeof(busHost));
+        if (settings[F("weatherHost")].is<const char*>()) strlcpy(weatherHost, settings[F("weatherHost")], sizeof(weatherHost));
+        if (settings[F("githubHost")].is<const char*>()) strlcpy(githubHost, settings[F("githubHost")], sizeof(githubHost));
+        if (settings[F("pickerHost")].is<const char*>()) strlcpy(pickerHost, settings[F("pickerHost")], sizeof(pickerHost));
+        if (settings[F("pickerFallback")].is<bool>())    pickerFallback = settings[F("pickerFallback")];
         if (settings[F("showBus")].is<bool>())           enableBus = settings[F("showBus")];
         if (settings[F("fastRefresh")].is<bool>())       apiRefreshRate = settings[F("fastRefresh")] ? FASTDATAUPDATEINTERVAL : DATAUPDATEINTERVAL;
         if (settings[F("weather")].is<bool>() && openWeatherMapApiKey.length())
                                                     weatherEnabled = settings[F("weather")];
         if (settings[F("update")].is<bool>())            firmwareUpdates = settings[F("update")];
+        if (settings[F("railQuota")].is<int>())          quota.setHourlyBudget(QUOTA_RAIL, settings[F("railQuota")]);
+        if (settings[F("busQuota")].is<int>())           quota.setHourlyBudget(QUOTA_BUS, settings[F("busQuota")]);
+        if (settings[F("weatherQuota")].is<int>())       quota.setHourlyBudget(QUOTA_WEATHER, settings[F("weatherQuota")]);
         if (settings[F("brightness")].is<int>())         brightness = settings[F("brightness")];
         if (settings[F("lat")].is<float>())              stationLat = settings[F("lat")];
         if (settings[F("lon")].is<float>())              stationLon = settings[F("lon")];
@@ -720,6 +824,7 @@ void loadConfig() {
         if (settings[F("busLat")].is<float>())           busLat = settings[F("busLat")];
         if (settings[F("busLon")].is<float>())           busLon = settings[F("busLon")];
         if (settings[F("busFilter")].is<const char*>())  strlcpy(busFilter, settings[F("busFilter")], sizeof(busFilter));
+        if (settings[F("busExtraIds")].is<const char*>()) setBusExtraStops(settings[F("busExtraIds")]);
 
         if (settings[F("noScroll")].is<bool>())          noScrolling = settings[F("noScroll")];
         if (settings[F("flip")].is<bool>())              flipScreen = settings[F("flip")];
@@ -800,20 +905,22 @@ void softResetBoard() {
       case MODE_BUS:
         // Create the Bus client
         busdata = new busDataClient();
+        busdata->setApiHost(busHost);
+        loadBusStopInfo();
         break;
     }
   }
 
   switch (boardMode) {
     case MODE_RAIL:
-      // Create a cleaned platform filter (if any)
-      raildata->cleanFilter(platformFilter,cleanPlatformFilter,sizeof(platformFilter));
+      // Compile the platform filter (if any)
+      platformMatcher.compile(platformFilter);
       break;
 
     case MODE_BUS:
       progressBar(F("Initialising BusTimes"),70);
-      // Create a cleaned filter
-      busdata->cleanFilter(busFilter,cleanBusFilter,sizeof(busFilter));
+      // Compile the service filter
+      busMatcher.compile(busFilter);
       break;
   }
   station.numServices=0;
@@ -919,10 +1026,16 @@ bool checkForFirmwareUpdate() {
 // Request a data update via the raildataClient
 bool getStationBoard() {
   if (!firstLoad) showUpdateIcon(true);
-  lastUpdateResult = raildata->updateDepartures(&station,&messages,crsCode,nrToken,MAXBOARDSERVICES,enableBus,callingCrsCode,cleanPlatformFilter);
-  nextDataUpdate = millis()+apiRefreshRate;
+  const char *stations[RAILMAXSTATIONS] = { crsCode };
+  int numStations = 1;
+  for (int i=0;i<RAILMAXSTATIONS-1 && extraCrsCodes[i][0];i++) stations[numStations++] = extraCrsCodes[i];
+  lastUpdateResult = raildata->updateDepartures(&station,&messages,stations,numStations,nrToken,MAXBOARDSERVICES,enableBus,callingCrsCode,platformMatcher);
+  scheduler.setBaseInterval(apiRefreshRate);
+  scheduler.setQuotaApi(QUOTA_RAIL);
   if (lastUpdateResult == UPD_SUCCESS || lastUpdateResult == UPD_NO_CHANGE) {
+    scheduleNextUpdate(lastUpdateResult == UPD_SUCCESS);
     showUpdateIcon(false);
+    if (lastDataLoadTime) lastRefreshInterval = millis()-lastDataLoadTime;
     lastDataLoadTime=millis();
     noDataLoaded=false;
     dataLoadSuccess++;
@@ -930,13 +1043,14 @@ bool getStationBoard() {
   } else if (lastUpdateResult == UPD_DATA_ERROR || lastUpdateResult == UPD_TIMEOUT) {
     lastLoadFailure=millis();
     dataLoadFailure++;
-    nextDataUpdate = millis() + 30000; // 30 secs
+    nextDataUpdate = millis() + scheduler.failure();
     showUpdateIcon(false);
     return false;
   } else if (lastUpdateResult == UPD_UNAUTHORISED) {
     showTokenErrorScreen();
     while (true) { server.handleClient(); yield();}
   } else {
+    nextDataUpdate = millis() + scheduler.failure();
     showUpdateIcon(false);
     dataLoadFailure++;
     return false;
@@ -1013,6 +1127,7 @@ void drawStationBoard() {
     u8g2.clearBuffer();
     u8g2.setContrast(brightness);
     firstLoad=false;
+    if (!firstBoardTime) firstBoardTime=millis();
     line3Service = noScrolling ? 1 : 0;
   } else {
     // Clear the top line
@@ -1140,12 +1255,54 @@ void busCallback() {
  * Bus Departures Board
  *
  */
+
+// Use the name and location of a bus stop for the board
+void applyBusStopInfo(const busStopInfo &info) {
+  busName = String(info.longName);
+  if (info.lat != 0 || info.lon != 0) {
+    busLat = info.lat;
+    busLon = info.lon;
+  }
+}
+
+// Take the bus stop details from the cache, they're refreshed in the background if they're missing or out of date
+void loadBusStopInfo() {
+  busStopInfo info;
+
+  busStopStale = false;
+  if (!busAtco[0]) return;
+  if (stopCache.lookup(busAtco,&info)) {
+    applyBusStopInfo(info);
+    busStopStale = stopCache.isStale(info);
+  } else busStopStale = true;
+  nextBusStopRefresh = millis();
+}
+
+// Fetch the bus stop details and update the cache
+void refreshBusStopInfo() {
+  busStopInfo info;
+
+  if (busdata->getStopInfo(busAtco,&info) == UPD_SUCCESS) {
+    stopCache.store(info);
+    applyBusStopInfo(info);
+    busStopStale = false;
+  } else {
+    nextBusStopRefresh = millis() + msHour;  // Try again later
+  }
+}
+
 bool getBusDeparturesBoard() {
   if (!firstLoad) showUpdateIcon(true);
-  lastUpdateResult = busdata->updateDepartures(&station,busAtco,cleanBusFilter,&busCallback);
-  nextDataUpdate = millis()+BUSDATAUPDATEINTERVAL; // default update freq
+  const char *busStops[BUSMAXSTOPS] = { busAtco };
+  int numStops = 1;
+  for (int i=0;i<BUSMAXSTOPS-1 && busExtraAtco[i][0];i++) busStops[numStops++] = busExtraAtco[i];
+  lastUpdateResult = busdata->updateDepartures(&station,busStops,numStops,busMatcher,&busCallback);
+  scheduler.setBaseInterval(BUSDATAUPDATEINTERVAL);
+  scheduler.setQuotaApi(QUOTA_BUS);
   if (lastUpdateResult == UPD_SUCCESS || lastUpdateResult == UPD_NO_CHANGE) {
+    scheduleNextUpdate(station.boardChanged);
     showUpdateIcon(false);
+    if (lastDataLoadTime) lastRefreshInterval = millis()-lastDataLoadTime;
     lastDataLoadTime=millis();
     noDataLoaded=false;
     dataLoadSuccess++;
@@ -1160,19 +1317,27 @@ bool getBusDeparturesBoard() {
   } else if (lastUpdateResult == UPD_DATA_ERROR || lastUpdateResult == UPD_TIMEOUT) {
     lastLoadFailure=millis();
     dataLoadFailure++;
-    nextDataUpdate = millis() + 30000; // 30 secs
+    nextDataUpdate = millis() + scheduler.failure();
     showUpdateIcon(false);
     return false;
   } else if (lastUpdateResult == UPD_UNAUTHORISED) {
     showTokenErrorScreen();
     while (true) { server.handleClient(); yield();}
   } else {
+    nextDataUpdate = millis() + scheduler.failure();
     showUpdateIcon(false);
     dataLoadFailure++;
     return false;
   }
 }
 
+// The time shown on the right of a bus service, the expected time if there is one
+void getBusServiceTime(int serviceId, char *etd) {
+  if (isDigit(station.service[serviceId].etd[0])) {
+    sprintf(etd,"Exp %s",station.service[serviceId].etd);
+  } else strcpy(etd,station.service[serviceId].sTime);
+}
+
 void drawBusService(int serviceId, int y, int destPos) {
   char clipDestination[MAXLOCATIONSIZE];
   char etd[16];
@@ -1180,10 +1345,9 @@ void drawBusService(int serviceId, int y, int destPos) {
   if (serviceId < station.numServices) {
     blankArea(0,y,SCREEN_WIDTH,8);
     u8g2.drawStr(0,y-1,station.service[serviceId].via);
-    if (isDigit(station.service[serviceId].etd[0])) {
-      sprintf(etd,"Exp %s",station.service[serviceId].etd);
-    } else strcpy(etd,station.service[serviceId].sTime);
+    getBusServiceTime(serviceId,etd);
     int etdWidth = getStringWidth(etd);
+    busEtdWidth[serviceId] = etdWidth;
     u8g2.drawStr(SCREEN_WIDTH - etdWidth,y-1,etd);
 
     // work out if we need to clip the destination
@@ -1201,8 +1365,25 @@ void drawBusService(int serviceId, int y, int destPos) {
   }
 }
 
+// Redraw just the time of a bus service. Returns false if the new time needs more space than the old one did.
+bool drawBusServiceTime(int serviceId, int y) {
+  char etd[16];
+
+  getBusServiceTime(serviceId,etd);
+  int etdWidth = getStringWidth(etd);
+  if (etdWidth > busEtdWidth[serviceId]) return false;
+  // The destination was clipped for the previous time, so clear all the space it used
+  blankArea(SCREEN_WIDTH - busEtdWidth[serviceId],y,busEtdWidth[serviceId],8);
+  u8g2.drawStr(SCREEN_WIDTH - etdWidth,y-1,etd);
+  return true;
+}
+
 // Draw/update the Bus Departures Board
 void drawBusDeparturesBoard() {
+  // The whole board is redrawn if the services have moved, otherwise only the lines that changed
+  bool allRows = (firstLoad || station.numServices != busBoardServices || busDestX != busBoardDestX);
+  bool fullRefresh = firstLoad;
+  bool topLineDrawn = false;
 
   if (line3Service==0) line3Service=1;
   if (firstLoad) {
@@ -1210,14 +1391,14 @@ void drawBusDeparturesBoard() {
     u8g2.clearBuffer();
     u8g2.setContrast(brightness);
     firstLoad=false;
-  } else {
-      // Clear the top two lines
-      blankArea(0,LINE1,SCREEN_WIDTH,LINE3-LINE1);
+    if (!firstBoardTime) firstBoardTime=millis();
   }
 
-  if (station.boardChanged) {
-    // prepare to scroll up primary services
+  if (allRows && station.boardChanged) {
+    // prepare to scroll up all the primary services
+    blankArea(0,LINE1,SCREEN_WIDTH,LINE3-LINE1);
     scrollPrimaryYpos = 10;
+    scrollPrimaryRows = 7;
     isScrollingPrimary = true;
     // reset line3
     if (station.numServices>2) {
@@ -1228,21 +1409,47 @@ void drawBusDeparturesBoard() {
     currentMessage = -1;
     blankArea(0,LINE3,SCREEN_WIDTH,8);
     serviceTimer=0;
-  } else {
+  } else if (allRows) {
     // Draw the primary service line(s)
+    blankArea(0,LINE1,SCREEN_WIDTH,LINE3-LINE1);
     if (station.numServices) {
       drawBusService(0,LINE1,busDestX);
       if (station.numServices>1) drawBusService(1,LINE2,busDestX);
     } else {
       centreText(F("No scheduled services"),LINE1-1);
     }
+    topLineDrawn = true;
+  } else if (station.boardChanged) {
+    // Scroll in the services that changed. If only the expected time changed, just redraw the time.
+    int rowService[3] = { 0, 1, -1 };
+    int rowY[3] = { LINE1, LINE2, LINE3 };
+    if (line3Service>1 && line3Service<station.numServices && currentMessage==-1) rowService[2] = line3Service;
+    scrollPrimaryRows = 0;
+    for (int row=0;row<3;row++) {
+      int service = rowService[row];
+      if (service<0 || service>=station.numServices) continue;
+      if (station.changedRows & (1 << service)) scrollPrimaryRows |= (1 << row);
+      else if (station.changedTimes & (1 << service)) {
+        if (!drawBusServiceTime(service,rowY[row])) drawBusService(service,rowY[row],busDestX);
+        if (row==0) topLineDrawn = true;
+      }
+    }
+    if (scrollPrimaryRows) {
+      scrollPrimaryYpos = 10;
+      isScrollingPrimary = true;
+    }
   }
+  busBoardServices = station.numServices;
+  busBoardDestX = busDestX;
+
   messages.numMessages=0;
   if (weatherEnabled && weatherMsg[0]) {
     strcpy(line2[messages.numMessages++],weatherMsg);
   }
   strcpy(line2[messages.numMessages++],btAttribution);
-  u8g2.sendBuffer();
+  // The other lines are sent with the next frame
+  if (fullRefresh) u8g2.sendBuffer();
+  else if (topLineDrawn) u8g2.updateDisplayArea(0,0,16,1);
 }
 
 /*
@@ -1296,10 +1503,44 @@ String getContentType(String filename) {
   return F("text/plain");
 }
 
-// Stream a file from the file system
-bool handleStreamFile(String filename) {
+// Browsers can keep the images for a while, pages are always checked (they change with a firmware or WebApp update)
+String getCacheControl(String filename) {
+  String contentType = getContentType(filename);
+  if (contentType.startsWith(F("image/"))) return "max-age=" + String(IMAGEMAXAGE);
+  return F("no-cache");
+}
+
+// Web GUI pages and images can be revalidated with an ETag. Other files (the .json settings files in particular)
+// can change without their size changing, or on a board without a valid clock, so they're always sent in full.
+bool isWebGuiAsset(String filename) {
+  return filename.endsWith(F(".htm")) || filename.endsWith(F(".html")) || getContentType(filename).startsWith(F("image/"));
+}
+
+// Reply 304 Not Modified if the browser already has this version of a file (its If-None-Match has the ETag). A
+// gzipped page repeats the Vary header of its 200 reply, so caches keep it apart from the inflated version.
+bool sendNotModified(String filename, const char *etag, bool gzipped = false) {
+  if (server.header(F("If-None-Match")).indexOf(etag) < 0) return false;
+  server.sendHeader(F("ETag"), etag);
+  server.sendHeader(F("Cache-Control"), getCacheControl(filename));
+  if (gzipped) server.sendHeader(F("Vary"), F("Accept-Encoding"));
+  server.send(304);
+  return true;
+}
+
+// Stream a file from the file system. A file served as part of the Web GUI gets an ETag made from its size and
+// last write time.
+bool handleStreamFile(String filename, bool useEtag = false) {
   if (LittleFS.exists(filename)) {
     File file = LittleFS.open(filename,"r");
+    if (useEtag) {
+      String etag = "\"" + String(file.size(),HEX) + "-" + String((unsigned long)file.getLastWrite(),HEX) + "\"";
+      if (sendNotModified(filename, etag.c_str())) {
+        file.close();
+        return true;
+      }
+      server.sendHeader(F("ETag"), etag);
+      server.sendHeader(F("Cache-Control"), getCacheControl(filename));
+    }
     String contentType = getContentType(filename);
     server.streamFile(file, contentType);
     file.close();
@@ -1307,32 +1548,50 @@ bool handleStreamFile(String filename) {
   } else return false;
 }
 
-// Stream a file stored in PROGMEM flash (default graphics are now included in the firmware image)
-void handleStreamFlashFile(String filename, const uint8_t *filedata, size_t contentLength) {
+// Stream a file stored in PROGMEM flash (default graphics are now included in the firmware image). The ETag is a
+// hash of the data made at build time.
+void handleStreamFlashFile(String filename, const uint8_t *filedata, size_t contentLength, const char *etag) {
 
   String contentType = getContentType(filename);
+  // The web pages are gzipped at build time, only inflate them for a browser that can't accept gzip
+  bool gzipped = gzipInflater::isGzip(filedata, contentLength);
+  gzipInflater inflater;
+  bool inflate = gzipped && server.header(F("Accept-Encoding")).indexOf(F("gzip")) < 0;
+  if (inflate && !inflater.begin()) {
+    sendResponse(503, F("Not enough memory to inflate page"));
+    return;
+  }
+
+  // The inflated page is a different representation from the gzipped one, so it isn't given the same ETag
+  if (!inflate && sendNotModified(filename, etag, gzipped)) return;
+
   WiFiClient client = server.client();
-  // Send the headers
-  client.println(F("HTTP/1.1 200 OK"));
-  client.print(F("Content-Type: "));
-  client.println(contentType);
-  client.print(F("Content-Length: "));
-  client.println(contentLength);
-  client.println(F("Connection: close"));
-  client.println(); // End of headers
-
-  const size_t chunkSize = 512;
-  uint8_t buffer[chunkSize];
-  size_t sent = 0;
+  // Send the headers in one write (rather than a write for each line)
+  char headerBuffer[256];
+  requestBuilder headers(headerBuffer,sizeof(headerBuffer));
+  headers.add(F("HTTP/1.1 200 OK\r\nContent-Type: ")).add(contentType.c_str()).add(F("\r\nContent-Length: "));
+  headers.add((long)(inflate ? gzipInflater::inflatedSize(filedata, contentLength) : contentLength));
+  if (gzipped) {
+    if (!inflate) headers.add(F("\r\nContent-Encoding: gzip"));
+    headers.add(F("\r\nVary: Accept-Encoding"));
+  }
+  if (!inflate) headers.add(F("\r\nETag: ")).add(etag).add(F("\r\nCache-Control: ")).add(getCacheControl(filename).c_str());
+  headers.add(F("\r\nConnection: close\r\n\r\n"));
+  if (!headers.send(client)) return;   // The browser has gone (or the headers didn't fit)
+
+  if (inflate) {
+    inflater.inflate(filedata, contentLength, client);
+    return;
+  }
 
+  // Flash is memory mapped, so the data is written from where it is without copying, a send buffer at a time
+  size_t sent = 0;
   while (sent < contentLength) {
-    size_t toSend = min(chunkSize, contentLength - sent);
-    // Copy from PROGMEM to buffer
-    for (size_t i=0;i<toSend;i++) {
-      buffer[i] = pgm_read_byte(&filedata[sent + i]);
-    }
-    client.write(buffer, toSend);
-    sent += toSend;
+    size_t segment = contentLength - sent;
+    if (segment > FLASHSEGMENTSIZE) segment = FLASHSEGMENTSIZE;
+    size_t written = client.write(filedata + sent, segment);
+    if (!written) break;  // The browser has gone
+    sent += written;
   }
 }
 
@@ -1356,7 +1615,7 @@ void handleSaveKeys() {
         owmToken = settings[F("owmToken")].as<String>();
         if (owmToken.length()) {
           // Check if this is a valid token...
-          if (!currentWeather.updateWeather(owmToken, "51.52", "-0.13")) {
+          if (!currentWeather.updateWeather(owmToken.c_str(), 51.52, -0.13)) {
             msg = F("The OpenWeather Map API key is not valid. Please check you have copied your key correctly. It may take up to 30 minutes for a newly created key to become active.\n\nNo changes have been saved.");
             result = false;
           }
@@ -1532,13 +1791,13 @@ void handleFileUpload() {
 
 // Fallback function for browser requests
 void handleNotFound() {
-  if ((LittleFS.exists(server.uri())) && (server.method() == HTTP_GET)) handleStreamFile(server.uri());
-  else if (server.uri() == F("/keys.htm")) handleStreamFlashFile(server.uri(), keyshtm, sizeof(keyshtm));
-  else if (server.uri() == F("/index.htm")) handleStreamFlashFile(server.uri(), indexhtm, sizeof(indexhtm));
-  else if (server.uri() == F("/nrelogo.webp")) handleStreamFlashFile(server.uri(), nrelogo, sizeof(nrelogo));
-  else if (server.uri() == F("/btlogo.webp")) handleStreamFlashFile(server.uri(), btlogo, sizeof(btlogo));
-  else if (server.uri() == F("/nr.webp")) handleStreamFlashFile(server.uri(), nricon, sizeof(nricon));
-  else if (server.uri() == F("/favicon.png")) handleStreamFlashFile(server.uri(), faviconpng, sizeof(faviconpng));
+  if ((LittleFS.exists(server.uri())) && (server.method() == HTTP_GET)) handleStreamFile(server.uri(), isWebGuiAsset(server.uri()));
+  else if (server.uri() == F("/keys.htm")) handleStreamFlashFile(server.uri(), keyshtm, sizeof(keyshtm), ETAG_KEYSHTM);
+  else if (server.uri() == F("/index.htm")) handleStreamFlashFile(server.uri(), indexhtm, sizeof(indexhtm), ETAG_INDEXHTM);
+  else if (server.uri() == F("/nrelogo.webp")) handleStreamFlashFile(server.uri(), nrelogo, sizeof(nrelogo), ETAG_NRELOGO);
+  else if (server.uri() == F("/btlogo.webp")) handleStreamFlashFile(server.uri(), btlogo, sizeof(btlogo), ETAG_BTLOGO);
+  else if (server.uri() == F("/nr.webp")) handleStreamFlashFile(server.uri(), nricon, sizeof(nricon), ETAG_NRICON);
+  else if (server.uri() == F("/favicon.png")) handleStreamFlashFile(server.uri(), faviconpng, sizeof(faviconpng), ETAG_FAVICONPNG);
   else sendResponse(404,F("Not Found"));
 }
 
@@ -1558,18 +1817,33 @@ void handleInfo() {
 
   sprintf(sysUptime,"%02d:%02d:%02d %02d/%02d/%04d",timeinfo.tm_hour,timeinfo.tm_min,timeinfo.tm_sec,timeinfo.tm_mday,timeinfo.tm_mon+1,timeinfo.tm_year+1900);
   message+="\nSystem clock: " + String(sysUptime);
-  message+="\nCRS station code: " + String(crsCode) + F("\nSuccessful: ") + String(dataLoadSuccess) + F("\nFailures: ") + String(dataLoadFailure) + F("\nTime since last data load: ") + String((int)((millis()-lastDataLoadTime)/1000)) + F(" seconds");
+  message+="\nCRS station code: " + String(crsCode);
+  for (int i=0;i<RAILMAXSTATIONS-1 && extraCrsCodes[i][0];i++) message+=", " + String(extraCrsCodes[i]);
+  message+="\nSuccessful: " + String(dataLoadSuccess) + F("\nFailures: ") + String(dataLoadFailure) + F("\nTime since last data load: ") + String((int)((millis()-lastDataLoadTime)/1000)) + F(" seconds");
   if (dataLoadFailure) message+="\nTime since last failure: " + String((int)((millis()-lastLoadFailure)/1000)) + F(" seconds");
   message+=F("\nLast Result: ");
   switch (boardMode) {
     case MODE_RAIL:
       message+=raildata->getLastError();
+      message+="\nRail data usage: " + raildata->getUsageStats();
       break;
 
     case MODE_BUS:
       message+=busdata->lastErrorMsg;
+      message+="\nBus stop cache: " + stopCache.getStats();
+      if (busStopStale) message+=F(" (refresh pending)");
       break;
   }
+  if (stationList.isAvailable()) message+="\nStation index: " + stationList.getStats();
+  else message+=F("\nStation index: not built into this firmware (National Rail station picker used)");
+  message+="\nStation picker cache: " + pickerCache.getStats();
+  if (weatherEnabled) message+="\nLast Weather Result: " + String(currentWeather.dataReceived) + F(" bytes, parse ") + String(currentWeather.parseTime) + F("us, ") + String(currentWeather.forecastRequests) + F(" forecast requests, ") + String(currentWeather.cacheHits) + F(" cached updates");
+  if (ghUpdate.releaseId.length()) message+="\nLast GitHub Result: " + ghUpdate.getLastError();
+  message+=perf.getSummary();
+  message+="\n" + hostCache.getSummary();
+  message+="\nFrames rendered: " + String(framesRendered) + F(" (") + String(frameOverruns) + F(" overruns, longest ") + String(maxFrameTime) + F("ms)");
+  message+="\nTime to first board: " + String(firstBoardTime) + F("ms\nLast refresh interval: ") + String(lastRefreshInterval/1000) + F(" seconds");
+  message+="\nRefresh interval: " + String(scheduler.getInterval()/1000) + F(" seconds (") + String(scheduler.getReason()) + F("), next in ") + String((long)(nextDataUpdate-millis())/1000) + F(" seconds");
   message+="\nServices: " + String(station.numServices) + F("\nMessages: ");
   message+=String(messages.numMessages);
   message+=F("\n");
@@ -1607,12 +1881,60 @@ void handleInfo() {
   sendResponse(200,message);
 }
 
+// Send the heap/stack usage records for recent data fetches to the browser
+void handlePerf() {
+  String message = "Free Heap: " + String(ESP.getFreeHeap()) + F(", Min Free Heap: ") + String(ESP.getMinFreeHeap()) + F(", Largest Block: ") + String(ESP.getMaxAllocHeap()) + F("\n\n");
+  message += perf.getReport();
+  sendResponse(200,message);
+}
+
+// Send the request budgets and counters for each upstream API
+void handleQuota() {
+  server.send(200,contentTypeJson,quota.getJson());
+}
+
+// Send the details of a bus stop to the Web GUI, from the cache unless they're missing or out of date
+void handleStopInfo() {
+  busStopInfo info;
+  busStopInfo fetched;
+  String atco = server.arg(F("id"));
+  atco.trim();
+  if (!atco.length() || atco.length() >= MAXATCOSIZE) {
+    sendResponse(400,F("Invalid ATCO code"));
+    return;
+  }
+
+  bool cached = stopCache.lookup(atco.c_str(),&info);
+  if (!cached || stopCache.isStale(info)) {
+    // Use the bus client if there is one, otherwise a temporary one just for the lookup
+    busDataClient *client = busdata;
+    if (!client) {
+      client = new busDataClient();
+      client->setApiHost(busHost);
+    }
+    int result = client->getStopInfo(atco.c_str(),&fetched);
+    if (client != busdata) delete client;
+    if (result == UPD_SUCCESS) {
+      stopCache.store(fetched);
+      info = fetched;
+      if (boardMode == MODE_BUS && !strcasecmp(busAtco,info.atco)) {
+        applyBusStopInfo(info);
+        busStopStale = false;
+      }
+    } else if (!cached) {
+      sendResponse(404,F("Bus stop not found"));
+      return;
+    }
+  }
+  server.send(200,contentTypeJson,stopCache.getJson(info));
+}
+
 // Stream the index.htm page unless we're in first time setup and need the api keys
 void handleRoot() {
   if (!apiKeys) {
-    if (LittleFS.exists(F("/keys.htm"))) handleStreamFile(F("/keys.htm")); else handleStreamFlashFile(F("/keys.htm"),keyshtm,sizeof(keyshtm));
+    if (LittleFS.exists(F("/keys.htm"))) handleStreamFile(F("/keys.htm"),true); else handleStreamFlashFile(F("/keys.htm"),keyshtm,sizeof(keyshtm),ETAG_KEYSHTM);
   } else {
-    if (LittleFS.exists(F("/index_d.htm"))) handleStreamFile(F("/index_d.htm")); else handleStreamFlashFile(F("/index.htm"),indexhtm,sizeof(indexhtm));
+    if (LittleFS.exists(F("/index_d.htm"))) handleStreamFile(F("/index_d.htm"),true); else handleStreamFlashFile(F("/index.htm"),indexhtm,sizeof(indexhtm),ETAG_INDEXHTM);
   }
 }
 
@@ -1625,6 +1947,7 @@ void handleFirmwareInfo() {
 // Force a reboot of the ESP32
 void handleReboot() {
   sendResponse(200,F("The Departures Board is restarting..."));
+  quota.save(true);
   delay(1000);
   ESP.restart();
 }
@@ -1706,7 +2029,9 @@ void handleOtaUpdate() {
  * External data functions - weather, stationpicker, firmware updates
  */
 
-// Call the National Rail Station Picker (called from index.htm)
+// Look up stations for the Web GUI picker (called from index.htm). The station index built into the firmware
+// answers immediately, the National Rail Station Picker is only called if it has no match (or there's no index).
+// Recent National Rail responses are cached, anything else is relayed straight through to the browser.
 void handleStationPicker() {
   if (!server.hasArg(F("q"))) {
     sendResponse(400, F("Missing Query"));
@@ -1719,38 +2044,55 @@ void handleStationPicker() {
     return;
   }
 
-  const char* host = "stationpicker.nationalrail.co.uk";
+  if (stationList.isAvailable()) {
+    bool found;
+    String json = stationList.getJson(query.c_str(),&found);
+    if (found || !pickerFallback) {
+      server.send(200, contentTypeJson, json);
+      return;
+    }
+  }
+
+  char cacheKey[RESPONSECACHE_MAXQUERY];
+  bool cacheable = responseCache::normalise(query.c_str(),cacheKey,sizeof(cacheKey));
+  const char *cached;
+  size_t cachedLength;
+  if (cacheable && pickerCache.lookup(cacheKey,&cached,&cachedLength)) {
+    server.send_P(200, contentTypeJson, cached, cachedLength);
+    return;
+  }
+
+  const char* host = pickerHost;
+  perf.begin(PERF_PICKER);
   WiFiClientSecure httpsClient;
   httpsClient.setInsecure();
   httpsClient.setTimeout(10000);
 
-  int retryCounter = 0;
-  while (!httpsClient.connect(host, 443) && retryCounter++ < 20) {
-    delay(50);
-  }
-
-  if (retryCounter >= 20) {
+  if (!socketConnect(httpsClient, host, 443, 2000)) {
     sendResponse(408, F("NR Timeout"));
     return;
   }
+  perf.sample(PERF_HANDSHAKE);
 
-  httpsClient.print(String("GET /stationPicker/") + query + F(" HTTP/1.0\r\n") +
-                    F("Host: stationpicker.nationalrail.co.uk\r\n") +
-                    F("Referer: https://www.nationalrail.co.uk\r\n") +
-                    F("Origin: https://www.nationalrail.co.uk\r\n") +
-                    F("Connection: close\r\n\r\n"));
-
-  // Wait for response header
-  retryCounter = 0;
-  while (!httpsClient.available() && retryCounter++ < 15) {
-    delay(100);
+  char requestBuffer[256];
+  requestBuilder request(requestBuffer,sizeof(requestBuffer));
+  request.add(F("GET /stationPicker/")).addUrl(query.c_str()).add(F(" HTTP/1.0\r\nHost: ")).add(host);
+  request.add(F("\r\nReferer: https://www.nationalrail.co.uk\r\nOrigin: https://www.nationalrail.co.uk\r\nConnection: close\r\n\r\n"));
+  if (!request.send(httpsClient)) {
+    httpsClient.stop();
+    if (request.isValid()) sendResponse(503, F("Station picker unavailable"));
+    else sendResponse(400, F("Query Too Long"));
+    return;
   }
+  quota.consume(QUOTA_PICKER);
 
-  if (!httpsClient.available()) {
+  // Wait for response header
+  if (!waitForData(httpsClient, 1500)) {
     httpsClient.stop();
     sendResponse(408, F("NRQ Timeout"));
     return;
   }
+  perf.firstByte();
 
   // Parse status code
   String statusLine = httpsClient.readStringUntil('\n');
@@ -1777,24 +2119,40 @@ void handleStationPicker() {
   server.setContentLength(CONTENT_LENGTH_UNKNOWN);
   server.send(200, contentTypeJson, "");
 
-  String buffer;
+  // Relay the response a block at a time, keeping a copy for the cache if it's small enough
+  uint8_t block[1024];
+  char *capture = cacheable ? (char *)malloc(RESPONSECACHE_MAXRESPONSE) : nullptr;
+  size_t captured = 0;
+  bool complete = false;
   unsigned long timeout = millis() + 5000UL;
 
-  while ((httpsClient.connected() || httpsClient.available()) && millis() < timeout) {
-    while (httpsClient.available()) {
-      char c = httpsClient.read();
-      if (c <= 128) buffer += c;
-      if (buffer.length() >= 1024) {
-        server.sendContent(buffer);
-        buffer = "";
-        yield();
+  while (millis() < timeout) {
+    int available = httpsClient.available();
+    if (available > 0) {
+      int len = httpsClient.read(block, available < (int)sizeof(block) ? available : sizeof(block));
+      if (len <= 0) continue;
+      server.sendContent((const char *)block, len);
+      if (capture) {
+        if (captured + len <= RESPONSECACHE_MAXRESPONSE) {
+          memcpy(capture + captured, block, len);
+          captured += len;
+        } else {
+          free(capture);
+          capture = nullptr;
+        }
       }
+      yield();
+    } else if (!httpsClient.connected()) {
+      complete = true;
+      break;
+    } else {
+      waitForData(httpsClient, 100);
     }
   }
+  perf.sample(PERF_PARSED);
 
-  // Flush remaining buffer
-  if (buffer.length()) {
-    server.sendContent(buffer);
+  if (capture) {
+    if (complete) pickerCache.store(cacheKey, capture, captured); else free(capture);
   }
 
   httpsClient.stop();
@@ -1802,18 +2160,22 @@ void handleStationPicker() {
   server.client().stop();
 }
 
-// Update the current weather message if weather updates are enabled and we have a lat/lon for the selected location
+// Update the weather message if weather updates are enabled and we have a lat/lon for the selected location.
+// The message comes from the cached forecast, which is only fetched again when it's out of date.
 void updateCurrentWeather(float latitude, float longitude) {
-  nextWeatherUpdate = millis() + 1200000; // update every 20 mins
-  if (!latitude || !longitude) return; // No location co-ordinates
-  strcpy(weatherMsg,"");
-  bool currentWeatherValid = currentWeather.updateWeather(openWeatherMapApiKey, String(latitude), String(longitude));
-  if (currentWeatherValid) {
-    currentWeather.currentWeather.toCharArray(weatherMsg,sizeof(weatherMsg));
+  nextWeatherUpdate = millis() + 600000;  // move on to the next forecast period every 10 mins
+  if (!latitude || !longitude) return;    // No location co-ordinates
+  if (currentWeather.forecastDue(latitude, longitude)) {
+    if (!currentWeather.updateForecast(openWeatherMapApiKey.c_str(), latitude, longitude)) {
+      nextWeatherUpdate = millis() + quota.stretch(QUOTA_WEATHER,30000); // Try again in 30s (longer if the budget is running low)
+    }
+  }
+  if (currentWeather.getForecastWeather(latitude, longitude, weatherMsg, sizeof(weatherMsg))) {
     weatherMsg[0] = toUpperCase(weatherMsg[0]);
-    weatherMsg[sizeof(weatherMsg)-1] = '\0';
-  } else {
-    nextWeatherUpdate = millis() + 30000; // Try again in 30s
+  } else if (!currentWeather.hasForecast(latitude, longitude)) {
+    // Nothing for this location yet (the old message may be for a different one). If the forecast has just run
+    // out, the last message is kept until it can be refreshed.
+    strcpy(weatherMsg,"");
   }
 }
 
@@ -1826,8 +2188,8 @@ void updateCurrentWeather(float latitude, float longitude) {
 //
 void departureBoardLoop() {
 
-  if ((millis() > nextDataUpdate) && (!isScrollingStops) && (!isScrollingService) && (lastUpdateResult != UPD_UNAUTHORISED) && (wifiConnected)) {
-    timer = millis() + 2000;
+  if ((loopClock->millis() > nextDataUpdate) && (!isScrollingStops) && (!isScrollingService) && (lastUpdateResult != UPD_UNAUTHORISED) && (wifiConnected)) {
+    timer = loopClock->millis() + 2000;
     if (getStationBoard()) {
       if ((lastUpdateResult == UPD_SUCCESS) || (lastUpdateResult == UPD_NO_CHANGE && firstLoad)) drawStationBoard(); // Something changed so redraw the board.
     } else if (lastUpdateResult == UPD_UNAUTHORISED) showTokenErrorScreen();
@@ -1835,11 +2197,13 @@ void departureBoardLoop() {
 	    if (noDataLoaded) showNoDataScreen();
 	    else drawStationBoard();
 	  } else if (noDataLoaded) showNoDataScreen();
-  } else if (weatherEnabled && (millis()>nextWeatherUpdate) && (!noDataLoaded) && (!isScrollingStops) && (!isScrollingService) && (wifiConnected)) {
+  } else if (weatherEnabled && (loopClock->millis()>nextWeatherUpdate) && (!noDataLoaded) && (!isScrollingStops) && (!isScrollingService) && (wifiConnected)) {
     updateCurrentWeather(stationLat,stationLon);
+  } else if ((loopClock->millis()+DNSCACHE_PRERESOLVE > nextDataUpdate) && (!isScrollingStops) && (!isScrollingService) && (wifiConnected)) {
+    hostCache.refresh(raildata->getHost(),DNSCACHE_PRERESOLVE);   // Idle frame ahead of the next fetch, re-resolve its host if it's about to expire
   }
 
-  if (millis()>timer && numMessages && !isScrollingStops && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR && !noScrolling) {
+  if (loopClock->millis()>timer && numMessages && !isScrollingStops && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR && !noScrolling) {
     // Need to start a new scrolling line 2
     prevMessage = currentMessage;
     prevScrollStopsLength = scrollStopsLength;
@@ -1852,21 +2216,21 @@ void departureBoardLoop() {
   }
 
   // Check if there's a via destination
-  if (millis()>viaTimer) {
+  if (loopClock->millis()>viaTimer) {
     if (station.numServices && station.service[0].via[0] && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
       isShowingVia = !isShowingVia;
       drawPrimaryService(isShowingVia);
       u8g2.updateDisplayArea(0,0,16,1);
-      if (isShowingVia) viaTimer = millis()+3000; else viaTimer = millis()+4000;
+      if (isShowingVia) viaTimer = loopClock->millis()+3000; else viaTimer = loopClock->millis()+4000;
     }
   }
 
-  if (millis()>serviceTimer && !isScrollingService && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
+  if (loopClock->millis()>serviceTimer && !isScrollingService && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
     // Need to change to the next service if there is one
     if (station.numServices <= 1 && !weatherMsg[0]) {
       // There's no other services and no weather so just so static attribution.
       drawServiceLine(1,LINE3); //TODO?
-      serviceTimer = millis() + 30000;
+      serviceTimer = loopClock->millis() + 30000;
       isScrollingService = false;
     } else {
       prevService = line3Service;
@@ -1881,7 +2245,7 @@ void departureBoardLoop() {
     }
   }
 
-  if (isScrollingStops && millis()>timer && !noScrolling) {
+  if (isScrollingStops && loopClock->millis()>timer && !noScrolling) {
     blankArea(0,LINE2,SCREEN_WIDTH,7);
     if (scrollStopsYpos) {
       // we're scrolling up the message initially
@@ -1892,26 +2256,26 @@ void departureBoardLoop() {
       else u8g2.drawStr(0,scrollStopsYpos+LINE2-2,line2[currentMessage]);
       u8g2.setMaxClipWindow();
       scrollStopsYpos--;
-      if (scrollStopsYpos==0) timer=millis()+1500;
+      if (scrollStopsYpos==0) timer=loopClock->millis()+1500;
     } else {
       // we're scrolling left
       if (scrollStopsLength<SCREEN_WIDTH && strncmp("Calling",line2[currentMessage],7)) centreText(line2[currentMessage],LINE2); // Centre text if it fits
       else u8g2.drawStr(scrollStopsXpos,LINE2-1,line2[currentMessage]);
       if (scrollStopsLength < SCREEN_WIDTH) {
         // we don't need to scroll this message, it fits so just set a longer timer
-        timer=millis()+6000;
+        timer=loopClock->millis()+6000;
         isScrollingStops=false;
       } else {
         scrollStopsXpos--;
         if (scrollStopsXpos < -scrollStopsLength) {
           isScrollingStops=false;
-          timer=millis()+500;  // pause before next message
+          timer=loopClock->millis()+500;  // pause before next message
         }
       }
     }
   }
 
-  if (isScrollingService && millis()>serviceTimer) {
+  if (isScrollingService && loopClock->millis()>serviceTimer) {
     blankArea(0,LINE3,SCREEN_WIDTH,7);
     if (scrollServiceYpos) {
       // we're scrolling the service into view
@@ -1922,7 +2286,7 @@ void departureBoardLoop() {
       u8g2.setMaxClipWindow();
       scrollServiceYpos--;
       if (scrollServiceYpos==0) {
-        serviceTimer=millis()+5000;
+        serviceTimer=loopClock->millis()+5000;
         isScrollingService=false;
       }
     }
@@ -1933,10 +2297,11 @@ void departureBoardLoop() {
 
   // To ensure a consistent refresh rate (for smooth text scrolling), we update the screen every 25ms (around 40fps)
   // so we need to wait any additional ms not used by processing so far before sending the frame to the display controller
-  long delayMs = fpsDelay - (millis()-refreshTimer);
-  if (delayMs>0) delay(delayMs);
+  long delayMs = fpsDelay - (loopClock->millis()-refreshTimer);
+  updateFrameStats(delayMs);
+  if (delayMs>0) loopClock->delay(delayMs);
   u8g2.updateDisplayArea(0,1,16,3);
-  refreshTimer=millis();
+  refreshTimer=loopClock->millis();
 }
 
 //
@@ -1946,7 +2311,7 @@ void busDeparturesLoop() {
   char serviceData[8+MAXLINESIZE+MAXLOCATIONSIZE];
   bool fullRefresh = false;
 
-  if (millis()>nextDataUpdate && !isScrollingService && !isScrollingPrimary && wifiConnected) {
+  if (loopClock->millis()>nextDataUpdate && !isScrollingService && !isScrollingPrimary && wifiConnected) {
     if (getBusDeparturesBoard()) {
       if (lastUpdateResult == UPD_SUCCESS || lastUpdateResult == UPD_NO_CHANGE) drawBusDeparturesBoard(); // Something changed so redraw the board.
     } else if (lastUpdateResult == UPD_UNAUTHORISED) showTokenErrorScreen();
@@ -1954,7 +2319,7 @@ void busDeparturesLoop() {
 	    if (noDataLoaded) showNoDataScreen();
 	    else drawBusDeparturesBoard();
 	  } else if (noDataLoaded) showNoDataScreen();
-  } else if (weatherEnabled && millis()>nextWeatherUpdate && !noDataLoaded && !isScrollingService && !isScrollingPrimary && wifiConnected) {
+  } else if (weatherEnabled && loopClock->millis()>nextWeatherUpdate && !noDataLoaded && !isScrollingService && !isScrollingPrimary && wifiConnected) {
     updateCurrentWeather(busLat,busLon);
     // Update the weather text immediately
     if (weatherMsg[0]) {
@@ -1962,14 +2327,18 @@ void busDeparturesLoop() {
       strcpy(line2[0],weatherMsg);
       messages.numMessages=2;
     }
+  } else if (busStopStale && loopClock->millis()>nextBusStopRefresh && !isScrollingService && !isScrollingPrimary && wifiConnected) {
+    refreshBusStopInfo();
+  } else if (loopClock->millis()+DNSCACHE_PRERESOLVE > nextDataUpdate && !isScrollingService && !isScrollingPrimary && wifiConnected) {
+    hostCache.refresh(busdata->getHost(),DNSCACHE_PRERESOLVE);    // Idle frame ahead of the next fetch, re-resolve its host if it's about to expire
   }
 
   // Scrolling the additional services
-  if (millis()>serviceTimer && !isScrollingPrimary && !isScrollingService && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
+  if (loopClock->millis()>serviceTimer && !isScrollingPrimary && !isScrollingService && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
     // Need to change to the next service if there is one
     if (station.numServices<=2 && messages.numMessages==1) {
       // There are no additional services or weather to scroll in so static attribution.
-      serviceTimer = millis() + 10000;
+      serviceTimer = loopClock->millis() + 10000;
       line3Service=station.numServices;
     } else {
       // Need to change to the next service or message
@@ -1994,7 +2363,7 @@ void busDeparturesLoop() {
     }
   }
 
-  if (isScrollingService && millis()>serviceTimer) {
+  if (isScrollingService && loopClock->millis()>serviceTimer) {
     if (scrollServiceYpos) {
       blankArea(0,LINE3,SCREEN_WIDTH,8);
       // we're scrolling up the message
@@ -2015,49 +2384,58 @@ void busDeparturesLoop() {
       u8g2.setMaxClipWindow();
       scrollServiceYpos--;
       if (scrollServiceYpos==0) {
-        serviceTimer = millis()+2800;
+        serviceTimer = loopClock->millis()+2800;
         if (station.numServices<=2) serviceTimer+=3000;
       }
     } else isScrollingService=false;
   }
 
   if (isScrollingPrimary) {
-    blankArea(0,LINE1,SCREEN_WIDTH,LINE3-LINE1+8);
-    fullRefresh = true;
-    // we're scrolling the primary service(s) into view
-    u8g2.setClipWindow(0,LINE1,SCREEN_WIDTH,LINE1+7);
-    if (station.numServices) drawBusService(0,scrollPrimaryYpos+LINE1-1,busDestX);
-    else centreText(F("No scheduled services"),scrollPrimaryYpos+LINE1);
-    if (station.numServices>1) {
-      u8g2.setClipWindow(0,LINE2,SCREEN_WIDTH,LINE2+7);
-      drawBusService(1,scrollPrimaryYpos+LINE2-1,busDestX);
+    // we're scrolling the primary service(s) that changed into view
+    if (scrollPrimaryRows & 1) {
+      blankArea(0,LINE1,SCREEN_WIDTH,LINE2-LINE1);
+      fullRefresh = true;   // The top line isn't in the area sent every frame
+      u8g2.setClipWindow(0,LINE1,SCREEN_WIDTH,LINE1+7);
+      if (station.numServices) drawBusService(0,scrollPrimaryYpos+LINE1-1,busDestX);
+      else centreText(F("No scheduled services"),scrollPrimaryYpos+LINE1);
     }
-    if (station.numServices>2) {
-      u8g2.setClipWindow(0,LINE3,SCREEN_WIDTH,LINE3+7);
-      drawBusService(2,scrollPrimaryYpos+LINE3-1,busDestX);
-    } else if (station.numServices<3 && messages.numMessages==1) {
-      // scroll up the attribution once...
-      u8g2.setClipWindow(0,LINE3,SCREEN_WIDTH,LINE3+7);
-      centreText(btAttribution,scrollPrimaryYpos+LINE3-1);
+    if (scrollPrimaryRows & 2) {
+      blankArea(0,LINE2,SCREEN_WIDTH,LINE3-LINE2);
+      if (station.numServices>1) {
+        u8g2.setClipWindow(0,LINE2,SCREEN_WIDTH,LINE2+7);
+        drawBusService(1,scrollPrimaryYpos+LINE2-1,busDestX);
+      }
+    }
+    if (scrollPrimaryRows & 4) {
+      blankArea(0,LINE3,SCREEN_WIDTH,8);
+      if (line3Service<station.numServices) {
+        u8g2.setClipWindow(0,LINE3,SCREEN_WIDTH,LINE3+7);
+        drawBusService(line3Service,scrollPrimaryYpos+LINE3-1,busDestX);
+      } else if (station.numServices<3 && messages.numMessages==1) {
+        // scroll up the attribution once...
+        u8g2.setClipWindow(0,LINE3,SCREEN_WIDTH,LINE3+7);
+        centreText(btAttribution,scrollPrimaryYpos+LINE3-1);
+      }
     }
     u8g2.setMaxClipWindow();
     scrollPrimaryYpos--;
     if (scrollPrimaryYpos==0) {
       isScrollingPrimary=false;
-      serviceTimer = millis()+2800;
+      serviceTimer = loopClock->millis()+2800;
     }
   }
 
   // Check if the clock should be updated
-  if (millis()>nextClockUpdate) {
-    nextClockUpdate = millis()+500;
+  if (loopClock->millis()>nextClockUpdate) {
+    nextClockUpdate = loopClock->millis()+500;
     drawCurrentTime(true);    // just use the Tube clock for bus mode
   }
 
-  long delayMs = 40 - (millis()-refreshTimer);
-  if (delayMs>0) delay(delayMs);
+  long delayMs = 40 - (loopClock->millis()-refreshTimer);
+  updateFrameStats(delayMs);
+  if (delayMs>0) loopClock->delay(delayMs);
   if (fullRefresh) u8g2.sendBuffer(); else u8g2.updateDisplayArea(0,1,16,3);
-  refreshTimer=millis();
+  refreshTimer=loopClock->millis();
 }
 
 //
@@ -2067,6 +2445,11 @@ void setup(void) {
   // These are the default wsdl XML SOAP entry points. They can be overridden in the config.json file if necessary
   strncpy(wsdlHost,"lite.realtime.nationalrail.co.uk",sizeof(wsdlHost));
   strncpy(wsdlAPI,"/OpenLDBWS/wsdl.aspx?ver=2021-11-01",sizeof(wsdlAPI));
+  // Default hosts for the other data sources. As above, these can be overridden in config.json (e.g. to point at a local test server)
+  strncpy(busHost,"bustimes.org",sizeof(busHost));
+  strncpy(weatherHost,"api.openweathermap.org",sizeof(weatherHost));
+  strncpy(githubHost,"api.github.com",sizeof(githubHost));
+  strncpy(pickerHost,"stationpicker.nationalrail.co.uk",sizeof(pickerHost));
   u8g2.begin();                       // Start the OLED panel
   u8g2.setContrast(brightness);       // Initial brightness
   u8g2.setDrawColor(1);               // Only a monochrome display, so set the colour to "on"
@@ -2084,6 +2467,8 @@ void setup(void) {
   strcpy(nrToken,"");                         // No default National Rail token
   loadApiKeys();                              // Load the API keys from the apiKeys.json
   loadConfig();                               // Load the configuration settings from config.json
+  currentWeather.setApiHost(weatherHost);     // Use the configured API hosts
+  ghUpdate.setApiHost(githubHost);
   u8g2.setContrast(brightness);               // Set the panel brightness to the user saved level
   if (flipScreen) u8g2.setFlipMode(0);
   u8g2.clearBuffer();
@@ -2140,6 +2525,9 @@ void setup(void) {
   server.on(F("/erasewifi"),handleEraseWiFi);
   server.on(F("/factoryreset"),handleFactoryReset);
   server.on(F("/info"),handleInfo);
+  server.on(F("/perf"),handlePerf);
+  server.on(F("/quota"),handleQuota);
+  server.on(F("/stopinfo"),handleStopInfo);
   server.on(F("/formatffs"),handleFormatFFS);
   server.on(F("/dir"),handleFileList);
   server.onNotFound(handleNotFound);
@@ -2191,6 +2579,8 @@ void setup(void) {
     server.send(200, contentTypeHtml, successPage);
   });
 
+  const char *headerKeys[] = {"Accept-Encoding","If-None-Match"};
+  server.collectHeaders(headerKeys, 2);   // Needed to know if the browser accepts the gzipped pages and has them cached
   server.begin();     // Start the local web server
 
   // Check for Firmware updates?
@@ -2250,6 +2640,7 @@ void setup(void) {
     delay(5000);
     ESP.restart();
   }
+  quota.load();                               // Restore the API request counters now the clock is set
 
   station.numServices=0;
   if (boardMode == MODE_RAIL) {
@@ -2261,12 +2652,14 @@ void setup(void) {
         while (true) { server.handleClient(); yield();}
       }
       progressBar(F("Initialising Nat'l Rail"),70);
-      raildata->cleanFilter(platformFilter,cleanPlatformFilter,sizeof(platformFilter));
+      platformMatcher.compile(platformFilter);
   } else if (boardMode == MODE_BUS) {
       progressBar(F("Initialising BusTimes"),70);
       busdata = new busDataClient();
-      // Create a cleaned filter
-      busdata->cleanFilter(busFilter,cleanBusFilter,sizeof(busFilter));
+      busdata->setApiHost(busHost);
+      loadBusStopInfo();
+      // Compile the service filter
+      busMatcher.compile(busFilter);
       startupProgressPercent=70;
   }
 }
@@ -2303,5 +2696,6 @@ void loop(void) {
       break;
   }
 
+  quota.save(false);                          // Persist the API request counters (rate limited)
   server.handleClient();
 }
@@ -0,0 +1,332 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Bus scraper benchmark - times the streaming HTML tokenizer in busDataClient against the line based scraper it
+ * replaced, which read the page with readStringUntil and matched each line with trim, indexOf and substring. Both
+ * read the same recorded bustimes.org page through the host shim. The old scraper only understood one tag per
+ * line, so the page is also run with its line breaks removed: the tokenizer must find the same services in both.
+ *
+ *   make -C test build/benchBusScraper && test/build/benchBusScraper test/fixtures
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <Arduino.h>
+#include <hostNetwork.h>
+#include <busDataClient.h>
+#include <socketUtils.h>
+#include <perfMonitor.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#define BENCH_RUNS 2000         // Page reads timed for each scraper
+
+static unsigned long allocations = 0;
+
+#ifdef __GLIBC__
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size) {
+    allocations++;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size) {
+    allocations++;
+    return __libc_calloc(n, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    allocations++;
+    return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+//
+// The previous scraper, as it was in busDataClient (readResponse and stripTag unchanged)
+//
+class lineScraper {
+    public:
+        struct busService {
+            char destinationName[MAXLOCATIONSIZE];
+            char lineName[MAXBUSLINESIZE];
+            char scheduled[6];
+            char expected[6];
+        };
+
+        struct busStop {
+            int numServices;
+            busService service[BUSMAXREADSERVICES];
+        };
+
+        int id=0;
+        busStop xBusStop;
+        long dataReceived = 0;
+        unsigned long parseTime = 0;
+        bool bChunked = false;
+        String lastErrorMsg = "";
+
+        String stripTag(String html);
+        int readResponse(WiFiClientSecure &httpsClient, const serviceFilter &filter, busClientCallback Xcb, bool firstResponse);
+        int update(const char *locationId, const serviceFilter &filter);
+};
+
+String lineScraper::stripTag(String html) {
+    String result = "";
+    int start = html.indexOf(">");
+    int end = html.indexOf("</");
+    if (start!=1 && end!=1 && end>start) {
+        result = html.substring(start+1,end);
+        result.trim();
+    }
+    return result;
+}
+
+int lineScraper::readResponse(WiFiClientSecure &httpsClient, const serviceFilter &filter, busClientCallback Xcb, bool firstResponse) {
+    unsigned long ticker = millis()+800;
+    if (!waitForData(httpsClient, 8000)) {
+        // no response within 8 seconds so exit
+        lastErrorMsg = F("Response timeout");
+        return UPD_TIMEOUT;
+    }
+    if (firstResponse) perf.firstByte();
+
+    // Parse status code
+    String statusLine = httpsClient.readStringUntil('\n');
+    if (!statusLine.startsWith(F("HTTP/")) || statusLine.indexOf(F("200 OK")) == -1) {
+        if (statusLine.indexOf(F("401")) > 0 || statusLine.indexOf(F("429")) > 0) {
+            lastErrorMsg = F("Not Authorized");
+            return UPD_UNAUTHORISED;
+        } else if (statusLine.indexOf(F("500")) > 0) {
+            lastErrorMsg = statusLine;
+            return UPD_DATA_ERROR;
+        } else {
+            lastErrorMsg = statusLine;
+            return UPD_HTTP_ERROR;
+        }
+    }
+
+    // Skip the remaining headers
+    while (httpsClient.connected() || httpsClient.available()) {
+        String line = httpsClient.readStringUntil('\n');
+        if (line == F("\r")) break;
+        if (line.startsWith(F("Transfer-Encoding:")) && line.indexOf(F("chunked")) >= 0) bChunked=true;
+    }
+
+    // Start scraping the data
+    unsigned long dataSendTimeout = millis() + 10000UL;
+    int maxId = id + MAXBOARDSERVICES;
+    if (maxId > BUSMAXREADSERVICES) maxId = BUSMAXREADSERVICES;
+    bool maxServicesRead = (id >= maxId);
+    int parseStep = PBT_START; // looking for the start of data
+    int dataColumns = 0;
+    bool serviceData;
+    String serviceId;
+    String destination;
+
+    while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout) && (!maxServicesRead)) {
+        unsigned long parseStart = micros();
+        while(httpsClient.available() && !maxServicesRead) {
+            String line = httpsClient.readStringUntil('\n');
+            dataReceived+=line.length()+1;
+            line.trim();
+            if (line.length()) {
+                if (line.indexOf("</body>")>=0) {
+                    // end of page
+                    maxServicesRead = true;
+                } else {
+                    switch (parseStep) {
+                        case PBT_START:
+                            if (line.indexOf("<tr>")>=0) parseStep = PBT_HEADER;
+                            break;
+
+                        case PBT_HEADER:
+                            if (line.indexOf("</tr>")>=0) {
+                                parseStep = PBT_SERVICE;
+                                serviceData = false;
+                            }
+                            else if (line.substring(0,1)=="<") dataColumns++;
+                            break;
+
+                        case PBT_SERVICE:
+                            if (line.indexOf("</table>")>=0) {
+                                // Assume another day of data with headers
+                                dataColumns=0;
+                                parseStep = PBT_START;
+                            }
+                            else if (line.indexOf("</td>")>=0) parseStep = PBT_DESTINATION;
+                            else if (line.substring(0,3)=="<td") serviceData = true;
+                            else if (line.substring(0,7)=="<a href" && serviceData) {
+                                // Get the service name from within the hyperlink
+                                serviceId = stripTag(line);
+                                strncpy(xBusStop.service[id].lineName,serviceId.c_str(),MAXBUSLINESIZE-1);
+                                xBusStop.service[id].lineName[MAXBUSLINESIZE-1] = '\0';
+                            } else {
+                                // must be a service Id without hyperlink
+                                serviceId = line;
+                                strncpy(xBusStop.service[id].lineName,serviceId.c_str(),MAXBUSLINESIZE-1);
+                                xBusStop.service[id].lineName[MAXBUSLINESIZE-1] = '\0';
+                            }
+                            break;
+
+                        case PBT_DESTINATION:
+                            if (line.indexOf("</td>")>=0) parseStep = PBT_SCHEDULED;
+                            else if (line.substring(0,1)!="<") {
+                                strncpy(xBusStop.service[id].destinationName,line.c_str(),MAXLOCATIONSIZE-1);
+                                xBusStop.service[id].destinationName[MAXLOCATIONSIZE-1] = '\0';
+                            }
+                            break;
+
+                        case PBT_SCHEDULED:
+                            if (line.indexOf("</td>")>=0) {
+                                if (dataColumns == 4) parseStep = PBT_EXPECTED; else {
+                                    strcpy(xBusStop.service[id].expected,"");
+                                    parseStep = PBT_HEADER;
+                                    if (filter.matches(xBusStop.service[id].lineName)) id++;
+                                    if (id>=maxId) maxServicesRead=true;
+                                }
+                            } else if (line.substring(0,1)!="<") {
+                                strncpy(xBusStop.service[id].scheduled,line.c_str(),sizeof(xBusStop.service[id].scheduled));
+                                xBusStop.service[id].scheduled[sizeof(xBusStop.service[id].scheduled)-1] = '\0';
+                            }
+                            break;
+
+                        case PBT_EXPECTED:
+                            if (line.indexOf("</td>")>=0) {
+                                parseStep = PBT_HEADER;
+                                if (filter.matches(xBusStop.service[id].lineName)) id++;
+                                if (id>=maxId) maxServicesRead=true;
+                            }
+                            else if (line.substring(0,1)!="<") {
+                                strncpy(xBusStop.service[id].expected,line.c_str(),sizeof(xBusStop.service[id].expected));
+                                xBusStop.service[id].expected[sizeof(xBusStop.service[id].expected)-1] = '\0';
+                            }
+                            break;
+                    }
+                }
+            }
+            if (millis()>ticker) {
+                Xcb();
+                ticker = millis()+800;
+            }
+        }
+        parseTime += micros() - parseStart;
+        if (!maxServicesRead) waitForData(httpsClient, 100);
+    }
+
+    if (millis() >= dataSendTimeout) {
+        lastErrorMsg = F("Timed out during msgs data receive operation");
+        return UPD_TIMEOUT;
+    }
+    return UPD_SUCCESS;
+}
+
+// Request and scrape one stop the way the old updateDepartures did, without the copy to the board
+int lineScraper::update(const char *locationId, const serviceFilter &filter) {
+    id=0;
+    for (int i=0;i<BUSMAXREADSERVICES;i++) {
+        strcpy(xBusStop.service[i].destinationName,"Check front of bus");
+        strcpy(xBusStop.service[i].scheduled,"");
+        strcpy(xBusStop.service[i].expected,"");
+    }
+    WiFiClientSecure httpsClient;
+    if (!socketConnect(httpsClient, "bustimes.org", 443, 3000)) return UPD_NO_RESPONSE;
+    String request = "GET /stops/" + String(locationId) + F("/departures HTTP/1.0\r\nHost: bustimes.org\r\nConnection: close\r\n\r\n");
+    httpsClient.print(request);
+    int result = readResponse(httpsClient, filter, []() {}, true);
+    httpsClient.stop();
+    xBusStop.numServices = id;
+    return result;
+}
+
+static hostResponse page;
+
+static const hostResponse *respond(const char *request, size_t length) {
+    return strncmp(request, "GET /stops/", 11) ? nullptr : &page;
+}
+
+static void busCallback() {}
+
+static std::string loadPage(const std::string &name) {
+    std::ifstream f(name, std::ios::binary);
+    if (!f) {
+        fprintf(stderr, "benchBusScraper: can't read %s\n", name.c_str());
+        exit(1);
+    }
+    std::stringstream contents;
+    contents << f.rdbuf();
+    return "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\nConnection: close\r\n\r\n" + contents.str();
+}
+
+static int failures = 0;
+
+// The tokenizer must find the services the old scraper did on the page it was written for, whatever the layout
+static void compare(const char *layout, const lineScraper &old, const rdStation &station) {
+    if (station.numServices != old.xBusStop.numServices) {
+        printf("FAIL: %s layout, old scraper found %d services, tokenizer %d\n", layout, old.xBusStop.numServices, station.numServices);
+        failures++;
+        return;
+    }
+    for (int i=0;i<station.numServices;i++) {
+        const lineScraper::busService &s = old.xBusStop.service[i];
+        String destination = s.destinationName;
+        destination.replace("&amp;", "&");
+        if (strcmp(s.lineName, station.service[i].via) || strcmp(destination.c_str(), station.service[i].destination) || strcmp(s.scheduled, station.service[i].sTime) || strcmp(s.expected, station.service[i].etd)) {
+            printf("FAIL: %s layout, service %d old [%s|%s|%s|%s] tokenizer [%s|%s|%s|%s]\n", layout, i, s.lineName, destination.c_str(), s.scheduled, s.expected,
+                station.service[i].via, station.service[i].destination, station.service[i].sTime, station.service[i].etd);
+            failures++;
+        }
+    }
+}
+
+template <typename Run>
+static void timeRuns(const char *scraper, const char *layout, const int &services, Run run) {
+    unsigned long long startBytes = hostBytesRead;
+    unsigned long startAllocations = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (int i=0;i<BENCH_RUNS;i++) run();
+    double perRun = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_RUNS;
+    char allocs[16] = "-";
+#ifdef __GLIBC__
+    snprintf(allocs, sizeof(allocs), "%.1f", (double)(allocations - startAllocations) / BENCH_RUNS);
+#endif
+    printf("%-10s %-14s %9d %10llu %10.1f %10s\n", scraper, layout, services, (hostBytesRead - startBytes) / BENCH_RUNS, perRun, allocs);
+}
+
+int main(int argc, char *argv[]) {
+    std::string fixtureDir = (argc > 1) ? argv[1] : "fixtures";
+    std::string lines = loadPage(fixtureDir + "/bustimes/departures.lines.html");
+    std::string wrapped = lines.substr(0, lines.find("\r\n\r\n") + 4);
+    for (char c : lines.substr(wrapped.size())) if (c != '\n') wrapped += c;
+    hostSetResponder(respond);
+
+    static lineScraper old, reference;
+    static busDataClient bus;
+    static rdStation station;
+    serviceFilter filter;
+    page.data = lines.data();
+    page.length = lines.size();
+    reference.update("490010769B", filter);
+
+    printf("%-10s %-14s %9s %10s %10s %10s\n", "scraper", "layout", "services", "bytes/run", "us/run", "allocs/run");
+    for (const std::string *layout : { &lines, &wrapped }) {
+        const char *layoutName = (layout == &lines) ? "tag per line" : "no newlines";
+        page.data = layout->data();
+        page.length = layout->size();
+        station.numServices = 0;
+        bus.updateDepartures(&station, "490010769B", filter, busCallback);
+        compare(layoutName, reference, station);
+        timeRuns("lines", layoutName, old.xBusStop.numServices, [&]() { old.update("490010769B", filter); });
+        timeRuns("tokenizer", layoutName, station.numServices, [&]() { bus.updateDepartures(&station, "490010769B", filter, busCallback); });
+    }
+    return failures ? 1 : 0;
+}
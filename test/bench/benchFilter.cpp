@@ -0,0 +1,120 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Service filter benchmark - times the compiled serviceFilter against the matcher it replaced, which re-parsed
+ * the comma separated filter text for every service. Both must agree on plain lists (the old matcher had no
+ * ranges or wildcards), which is checked before anything is timed.
+ *
+ *   make -C test build/benchFilter && test/build/benchFilter
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <Arduino.h>
+#include <serviceFilter.h>
+#include <chrono>
+
+#define BENCH_MATCHES 2000000   // Matches timed for each filter
+
+//
+// The previous matcher, as it was in raildataXmlClient and busDataClient
+//
+static void trim(char* &start, char* &end) {
+  while (start <= end && isspace(*start)) start++;
+  while (end >= start && isspace(*end)) end--;
+}
+
+static bool equalsIgnoreCase(const char* a, int a_len, const char* b) {
+  for (int i = 0; i < a_len; i++) {
+    if (tolower(a[i]) != tolower(b[i])) return false;
+  }
+  return b[a_len] == '\0';
+}
+
+static bool serviceMatchesFilter(const char* filter, const char* serviceId) {
+  if (filter == nullptr || filter[0] == '\0') return true; // empty filter = match all
+
+  const char* start = filter;
+  const char* ptr = filter;
+
+  while (true) {
+    if (*ptr == ',' || *ptr == '\0') {
+      const char* end = ptr - 1;
+      char* trimStart = const_cast<char*>(start);
+      char* trimEnd   = const_cast<char*>(end);
+      trim(trimStart, trimEnd);
+      int len = trimEnd - trimStart + 1;
+      if (len > 0 && equalsIgnoreCase(trimStart, len, serviceId)) {
+        return true;
+      }
+      if (*ptr == '\0') break;
+      ptr++;
+      start = ptr;
+    } else {
+      ptr++;
+    }
+  }
+
+  return false;
+}
+
+// Platforms and bus line names as they come from the feeds
+static const char *values[] = { "1", "2", "3", "4", "7", "9", "10", "12", "13", "14", "2a", "B", "N5", "x12", "X5", "36", "390", "" };
+#define NUMVALUES (sizeof(values)/sizeof(values[0]))
+
+static int failures = 0;
+
+static void expect(const char *filter, const char *value, bool expected, bool actual) {
+    if (expected == actual) return;
+    printf("FAIL: filter \"%s\" value \"%s\" should %smatch\n", filter, value, expected ? "" : "not ");
+    failures++;
+}
+
+static double timeMatches(const char *filter, const serviceFilter *compiled) {
+    volatile int hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i=0;i<BENCH_MATCHES;i++) {
+        const char *value = values[i % NUMVALUES];
+        hits += compiled ? compiled->matches(value) : serviceMatchesFilter(filter, value);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BENCH_MATCHES;
+}
+
+int main() {
+    // Plain lists: the compiled filter must give the same answers as the old matcher
+    const char *plainFilters[] = { "", "1", "1,2", " 1, 2,3 ,4", "1,2,3,4,5,6,7,8,9,10,11,12", "36, 390,N5", "B,x12" };
+    for (const char *filter : plainFilters) {
+        serviceFilter compiled;
+        compiled.compile(filter);
+        for (const char *value : values) expect(filter, value, serviceMatchesFilter(filter, value), compiled.matches(value));
+    }
+
+    // Ranges and wildcards, which only the compiled filter understands
+    serviceFilter ranges;
+    ranges.compile("1-4,X*,n5");
+    const char *rangeFilter = "1-4,X*,n5";
+    expect(rangeFilter, "2a", true, ranges.matches("2a"));
+    expect(rangeFilter, "4", true, ranges.matches("4"));
+    expect(rangeFilter, "5", false, ranges.matches("5"));
+    expect(rangeFilter, "x12", true, ranges.matches("x12"));
+    expect(rangeFilter, "N5", true, ranges.matches("N5"));
+    expect(rangeFilter, "N6", false, ranges.matches("N6"));
+    serviceFilter tooLong;
+    tooLong.compile("toolongname");
+    expect("toolongname", "toolongname", false, tooLong.matches("toolongname"));
+    if (failures) return 1;
+
+    printf("%-30s %14s %14s\n", "filter", "old ns/match", "new ns/match");
+    const char *timedFilters[] = { "1", " 1, 2,3 ,4", "1,2,3,4,5,6,7,8,9,10,11,12", "36, 390,N5,x12,B" };
+    for (const char *filter : timedFilters) {
+        serviceFilter compiled;
+        compiled.compile(filter);
+        double before = timeMatches(filter, nullptr);
+        double after = timeMatches(filter, &compiled);
+        printf("%-30s %14.1f %14.1f\n", filter, before, after);
+    }
+    return 0;
+}
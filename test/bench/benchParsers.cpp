@@ -0,0 +1,309 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Parser benchmark - runs the streaming parsers, and the rail, bus, weather and GitHub clients end to end,
+ * natively against the responses in test/fixtures. The clients are built unchanged, the host shim answers
+ * their requests from memory so only the reading, parsing and copying is timed. Reports the time per run,
+ * throughput (bytes/s) and heap allocations per run (malloc, calloc and realloc calls, glibc only).
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <Arduino.h>
+#include <hostNetwork.h>
+#include <xmlStreamingParser.h>
+#include <jsonStreamingParser.h>
+#include <raildataXmlClient.h>
+#include <busDataClient.h>
+#include <weatherClient.h>
+#include <githubClient.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#define BENCH_MINTIME 0.5       // Shortest timed run for each benchmark (s)
+
+//
+// Allocation counting. glibc lets the program replace malloc and friends, and still exports its own.
+//
+static unsigned long allocations = 0;
+
+#ifdef __GLIBC__
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size) {
+    allocations++;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size) {
+    allocations++;
+    return __libc_calloc(n, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    allocations++;
+    return __libc_realloc(ptr, size);
+}
+}
+#define BENCH_COUNTALLOCS true
+#else
+#define BENCH_COUNTALLOCS false
+#endif
+
+static std::string fixtureDir = "fixtures";
+static double minTime = BENCH_MINTIME;
+static bool verbose = false;
+
+static std::string loadFixture(const std::string &name) {
+    std::ifstream f(fixtureDir + "/" + name, std::ios::binary);
+    if (!f) {
+        fprintf(stderr, "benchParsers: can't read %s/%s\n", fixtureDir.c_str(), name.c_str());
+        exit(1);
+    }
+    std::stringstream contents;
+    contents << f.rdbuf();
+    return contents.str();
+}
+
+// A recorded body wrapped in the response headers the upstream API sends
+struct fixture {
+    std::string name;
+    std::string body;
+    std::string http;
+    hostResponse response;
+
+    void load(const std::string &fixtureName, const char *contentType, bool keepAlive) {
+        name = fixtureName;
+        body = loadFixture(fixtureName);
+        wrap(contentType, keepAlive);
+    }
+
+    void wrap(const char *contentType, bool keepAlive) {
+        http = std::string("HTTP/1.1 200 OK\r\nContent-Type: ") + contentType + "\r\nContent-Length: " + std::to_string(body.size())
+            + "\r\nConnection: " + (keepAlive ? "keep-alive" : "close") + "\r\n\r\n" + body;
+        response.data = http.data();
+        response.length = http.size();
+    }
+};
+
+//
+// Times batches of runs until a batch takes at least minTime, then reports that batch. Throughput is for the bytes
+// given, or if none are, for the bytes the client read from its connections (headers included).
+//
+template <typename Run>
+static void benchmark(const char *name, const std::string &fixtureName, size_t bytes, Run run) {
+    if (!run()) {
+        fprintf(stderr, "benchParsers: %s failed on %s\n", name, fixtureName.c_str());
+        exit(1);
+    }
+    unsigned long iterations = 1;
+    double elapsed;
+    unsigned long allocated;
+    while (true) {
+        unsigned long startAllocations = allocations;
+        unsigned long long startBytes = hostBytesRead;
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned long i=0;i<iterations;i++) run();
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        allocated = allocations - startAllocations;
+        if (elapsed >= minTime) {
+            if (!bytes) bytes = (hostBytesRead - startBytes) / iterations;
+            break;
+        }
+        double scale = (elapsed > 0) ? minTime * 1.2 / elapsed : 100;
+        if (scale > 100) scale = 100;
+        if (scale < 2) scale = 2;
+        iterations = (unsigned long)(iterations * scale);
+    }
+    double perRun = elapsed / iterations;
+    char allocs[16] = "-";
+    if (BENCH_COUNTALLOCS) snprintf(allocs, sizeof(allocs), "%.1f", (double)allocated / iterations);
+    printf("%-26s %-40s %8zu %9lu %10.1f %10.2f %10s\n", name, fixtureName.c_str(), bytes, iterations, perRun * 1e6, bytes / perRun / 1e6, allocs);
+}
+
+//
+// Listeners that take the parser output and do nothing with it, to time the parsers on their own
+//
+class nullXmlListener : public xmlListener {
+    public:
+        unsigned long tags = 0;
+        virtual void startTag(const char *tagName) { tags++; }
+        virtual void endTag(const char *tagName) {}
+        virtual void parameter(const char *param) {}
+        virtual void value(const char *value) {}
+        virtual void attribute(const char *attribute) {}
+};
+
+class nullJsonListener : public jsonListener {
+    public:
+        unsigned long values = 0;
+        virtual void startContainer(const jsonPath &path, bool isArray) {}
+        virtual void endContainer(const jsonPath &path, bool isArray) {}
+        virtual void value(const jsonPath &path, const char *value, int type) { values++; }
+};
+
+//
+// The responder answers whichever request arrives from the fixtures of the benchmark being run
+//
+static const fixture *wsdlFixture;
+static const fixture *boardFixture[2];      // Alternated so the first service changes on every refresh
+static const fixture *detailsFixture;
+static const fixture *busFixture;
+static const fixture *jsonFixture;
+static int boardRequests = 0;
+
+static const hostResponse *respond(const char *request, size_t length) {
+    if (!strncmp(request, "GET /OpenLDBWS/wsdl", 19)) return &wsdlFixture->response;
+    if (strstr(request, "GetDepartureBoardRequest")) return &boardFixture[boardRequests++ & 1]->response;
+    if (strstr(request, "GetServiceDetailsRequest")) return &detailsFixture->response;
+    if (!strncmp(request, "GET /stops/", 11)) return &busFixture->response;
+    if (!strncmp(request, "GET /data/2.5/", 14) || !strncmp(request, "GET /repos/", 11)) return &jsonFixture->response;
+    return nullptr;
+}
+
+static void railCallback(int state, int id) {}
+static void busCallback() {}
+
+static void benchXmlParser(const fixture &f) {
+    nullXmlListener listener;
+    xmlStreamingParser parser;
+    parser.setListener(&listener);
+    benchmark("xmlStreamingParser", f.name, f.body.size(), [&]() {
+        parser.reset();
+        for (char c : f.body) parser.parse(c);
+        return listener.tags > 0;
+    });
+}
+
+static void benchJsonParser(const fixture &f) {
+    nullJsonListener listener;
+    jsonStreamingParser parser;
+    parser.setListener(&listener);
+    benchmark("jsonStreamingParser", f.name, f.body.size(), [&]() {
+        parser.reset();
+        for (char c : f.body) parser.parse(c);
+        return listener.values > 0;
+    });
+}
+
+//
+// A full rail refresh: GetDepartureBoard, sanitising, GetServiceDetails for the first service and the copy
+//
+static void benchRail(const char *variant) {
+    std::string suffix = variant[0] ? std::string(".") + variant : "";
+    fixture wsdl, boardA, boardB, details;
+    wsdl.load("darwin/wsdl.xml", "text/xml; charset=utf-8", false);
+    size_t host = wsdl.body.find("{{host}}");
+    while (host != std::string::npos) {
+        wsdl.body.replace(host, 8, "lite.realtime.nationalrail.co.uk");
+        host = wsdl.body.find("{{host}}");
+    }
+    wsdl.wrap("text/xml; charset=utf-8", false);
+    boardA.load("darwin/GetDepartureBoard" + suffix + ".xml", "text/xml; charset=utf-8", true);
+    boardB = boardA;
+    size_t serviceId = boardB.body.find("serviceID>");
+    if (serviceId != std::string::npos) boardB.body.insert(boardB.body.find('<', serviceId), "B");
+    boardB.wrap("text/xml; charset=utf-8", true);
+    details.load("darwin/GetServiceDetails" + suffix + ".xml", "text/xml; charset=utf-8", true);
+    wsdlFixture = &wsdl;
+    boardFixture[0] = &boardA;
+    boardFixture[1] = &boardB;
+    detailsFixture = &details;
+
+    static raildataXmlClient rail;
+    static rdStation station;
+    static stnMessages messages;
+    static serviceFilter platforms;
+    if (rail.init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx", railCallback) != UPD_SUCCESS) {
+        fprintf(stderr, "benchParsers: rail client init failed\n");
+        exit(1);
+    }
+    benchmark("raildataXmlClient", boardA.name + " +details", 0, [&]() {
+        int result = rail.updateDepartures(&station, &messages, "PAD", "", MAXBOARDSERVICES, false, "", platforms);
+        return result == UPD_SUCCESS || result == UPD_NO_CHANGE;
+    });
+    if (verbose) printf("  %d services, %d messages, calling \"%.60s...\"\n  %s\n", station.numServices, messages.numMessages, station.calling, rail.getLastError().c_str());
+}
+
+static void benchBus(const char *variant) {
+    fixture page;
+    page.load(std::string("bustimes/departures") + (variant[0] ? "." : "") + variant + ".html", "text/html; charset=utf-8", false);
+    busFixture = &page;
+
+    static busDataClient bus;
+    static rdStation station;
+    static serviceFilter filter;
+    benchmark("busDataClient", page.name, 0, [&]() {
+        int result = bus.updateDepartures(&station, "0100BRP90312", filter, busCallback);
+        return result == UPD_SUCCESS || result == UPD_NO_CHANGE;
+    });
+    if (verbose) printf("  %d services, first %s %s %s\n  %s\n", station.numServices, station.service[0].via, station.service[0].destination, station.service[0].sTime, bus.lastErrorMsg.c_str());
+}
+
+static void benchWeather() {
+    fixture current, forecast;
+    current.load("owm/weather.json", "application/json; charset=utf-8", false);
+    forecast.load("owm/forecast.json", "application/json; charset=utf-8", false);
+
+    static weatherClient weather;
+    jsonFixture = &current;
+    benchmark("weatherClient (current)", current.name, 0, [&]() {
+        return weather.updateWeather("key", 51.52, -0.18);
+    });
+    if (verbose) printf("  %s\n", weather.currentWeather.c_str());
+    jsonFixture = &forecast;
+    benchmark("weatherClient (forecast)", forecast.name, 0, [&]() {
+        return weather.updateForecast("key", 51.52, -0.18);
+    });
+}
+
+static void benchGithub() {
+    fixture release;
+    release.load("github/release.json", "application/json; charset=utf-8", false);
+    jsonFixture = &release;
+
+    static github gh("");
+    benchmark("githubClient", release.name, 0, [&]() {
+        return gh.getLatestRelease();
+    });
+    if (verbose) printf("  %s, %d assets\n  %s\n", gh.releaseId.c_str(), gh.releaseAssets, gh.getLastError().c_str());
+}
+
+int main(int argc, char *argv[]) {
+    for (int i=1;i<argc;i++) {
+        if (!strcmp(argv[i], "-v")) verbose = true;
+        else if (!strcmp(argv[i], "-t") && i+1 < argc) minTime = atof(argv[++i]);
+        else if (argv[i][0] != '-') fixtureDir = argv[i];
+        else {
+            fprintf(stderr, "usage: benchParsers [-v] [-t seconds] [fixture directory]\n");
+            return 2;
+        }
+    }
+    hostSetResponder(respond);
+
+    printf("%-26s %-40s %8s %9s %10s %10s %10s\n", "benchmark", "fixture", "bytes/run", "runs", "us/run", "MB/s", "allocs/run");
+    const char *variants[] = { "small", "", "worst" };
+    for (const char *variant : variants) {
+        fixture board;
+        board.load(std::string("darwin/GetDepartureBoard") + (variant[0] ? "." : "") + variant + ".xml", "text/xml", true);
+        benchXmlParser(board);
+    }
+    for (const char *name : { "owm/forecast.json", "github/release.json" }) {
+        fixture json;
+        json.load(name, "application/json", false);
+        benchJsonParser(json);
+    }
+    for (const char *variant : variants) benchRail(variant);
+    for (const char *variant : variants) benchBus(variant);
+    benchWeather();
+    benchGithub();
+    return 0;
+}
@@ -0,0 +1,69 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - enough of the Arduino core (ESP32) to run the data clients natively for benchmarks
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(PSTR(s)))
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+size_t strlcpy(char *dst, const char *src, size_t size);
+size_t strlcat(char *dst, const char *src, size_t size);
+#endif
+
+#include <WString.h>
+#include <Stream.h>
+
+using std::min;
+using std::max;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+// Heap figures are fixed on the host, they're only reported
+class EspClass {
+    public:
+        uint32_t getFreeHeap() { return 160000; }
+        uint32_t getMinFreeHeap() { return 120000; }
+        uint32_t getMaxAllocHeap() { return 110000; }
+        uint32_t getCpuFreqMHz() { return 160; }
+        const char *getCoreVersion() { return "host"; }
+};
+extern EspClass ESP;
+
+typedef void *TaskHandle_t;
+unsigned int uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+class HardwareSerial : public Stream {
+    public:
+        void begin(unsigned long baud) {}
+        size_t write(uint8_t c);
+        size_t write(const uint8_t *buffer, size_t size);
+        int available() { return 0; }
+        int read() { return -1; }
+        int peek() { return -1; }
+};
+extern HardwareSerial Serial;
@@ -0,0 +1,45 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - an empty file system (nothing exists and nothing can be opened)
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+
+namespace fs {
+
+class File : public Stream {
+    public:
+        size_t write(uint8_t c) { return 0; }
+        size_t write(const uint8_t *buffer, size_t size) { return 0; }
+        int available() { return 0; }
+        int read() { return -1; }
+        size_t read(uint8_t *buffer, size_t size) { return 0; }
+        int peek() { return -1; }
+        size_t size() const { return 0; }
+        void close() {}
+        operator bool() const { return false; }
+};
+
+class FS {
+    public:
+        File open(const char *path, const char *mode = "r", bool create = false) { return File(); }
+        File open(const String &path, const char *mode = "r", bool create = false) { return File(); }
+        File open(const __FlashStringHelper *path, const char *mode = "r", bool create = false) { return File(); }
+        bool exists(const char *path) { return false; }
+        bool exists(const String &path) { return false; }
+        bool exists(const __FlashStringHelper *path) { return false; }
+        bool remove(const char *path) { return false; }
+        bool remove(const String &path) { return false; }
+        bool rename(const char *from, const char *to) { return false; }
+};
+
+}
+
+using fs::File;
+using fs::FS;
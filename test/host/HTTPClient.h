@@ -0,0 +1,12 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - HTTPClient is only used by code the benchmarks don't run
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
@@ -0,0 +1,28 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - IPv4 addresses
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+
+class IPAddress {
+
+    private:
+        uint8_t octets[4] = {0, 0, 0, 0};
+
+    public:
+        IPAddress() {}
+        IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octets{a, b, c, d} {}
+        uint8_t operator[](int index) const { return octets[index]; }
+        uint8_t &operator[](int index) { return octets[index]; }
+        bool operator==(const IPAddress &rhs) const { return !memcmp(octets, rhs.octets, sizeof(octets)); }
+        bool operator!=(const IPAddress &rhs) const { return !(*this == rhs); }
+        operator uint32_t() const { return octets[0] | (octets[1] << 8) | (octets[2] << 16) | ((uint32_t)octets[3] << 24); }
+        String toString() const;
+};
@@ -0,0 +1,46 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - Print and Stream, as far as the data clients use them
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <WString.h>
+
+class Print {
+    public:
+        virtual ~Print() {}
+        virtual size_t write(uint8_t c) = 0;
+        virtual size_t write(const uint8_t *buffer, size_t size);
+        size_t write(const char *str);
+        size_t print(const String &s);
+        size_t print(const char *str);
+        size_t print(const __FlashStringHelper *str);
+        size_t print(long value);
+        size_t println(const String &s);
+        size_t println(const char *str);
+        size_t println();
+        size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+// Reads don't block on the host, a read with nothing available returns -1 straight away
+class Stream : public Print {
+    protected:
+        unsigned long _timeout = 1000;
+
+    public:
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int peek() = 0;
+
+        void setTimeout(unsigned long timeout) { _timeout = timeout; }
+        unsigned long getTimeout() const { return _timeout; }
+        size_t readBytes(char *buffer, size_t length);
+        size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+        String readString();
+        String readStringUntil(char terminator);
+};
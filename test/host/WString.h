@@ -0,0 +1,138 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - the Arduino String class. Storage follows the ESP32 core (short strings held inline,
+ * longer ones on the heap in 16 byte steps) so allocation counts match the board.
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+class __FlashStringHelper;
+class StringSumHelper;
+
+#define STRING_SSOSIZE 15       // Inline buffer, as sizeof(ptr,cap,len)+3 on the 32 bit ESP32
+
+class String {
+
+    private:
+        char *heap = nullptr;
+        unsigned int cap = 0;
+        unsigned int len = 0;
+        char sso[STRING_SSOSIZE] = {0};
+
+        char *buffer() { return heap ? heap : sso; }
+        const char *buffer() const { return heap ? heap : sso; }
+        bool changeBuffer(unsigned int maxStrLen);
+        String &copy(const char *cstr, unsigned int length);
+        void move(String &rhs);
+
+    public:
+        String(const char *cstr = "");
+        String(const char *cstr, unsigned int length);
+        String(const String &str);
+        String(String &&rval);
+        String(const __FlashStringHelper *str);
+        explicit String(char c);
+        explicit String(unsigned char value, unsigned char base = 10);
+        explicit String(int value, unsigned char base = 10);
+        explicit String(unsigned int value, unsigned char base = 10);
+        explicit String(long value, unsigned char base = 10);
+        explicit String(unsigned long value, unsigned char base = 10);
+        explicit String(long long value, unsigned char base = 10);
+        explicit String(unsigned long long value, unsigned char base = 10);
+        explicit String(float value, unsigned int decimalPlaces = 2);
+        explicit String(double value, unsigned int decimalPlaces = 2);
+        ~String();
+
+        bool reserve(unsigned int size);
+        unsigned int length() const { return len; }
+        bool isEmpty() const { return len == 0; }
+        const char *c_str() const { return buffer(); }
+
+        String &operator=(const String &rhs);
+        String &operator=(String &&rval);
+        String &operator=(const char *cstr);
+        String &operator=(const __FlashStringHelper *str);
+
+        bool concat(const String &str);
+        bool concat(const char *cstr);
+        bool concat(const char *cstr, unsigned int length);
+        bool concat(char c);
+        bool concat(int num);
+        bool concat(unsigned int num);
+        bool concat(long num);
+        bool concat(unsigned long num);
+        bool concat(const __FlashStringHelper *str);
+
+        String &operator+=(const String &rhs) { concat(rhs); return *this; }
+        String &operator+=(const char *cstr) { concat(cstr); return *this; }
+        String &operator+=(char c) { concat(c); return *this; }
+        String &operator+=(int num) { concat(num); return *this; }
+        String &operator+=(unsigned int num) { concat(num); return *this; }
+        String &operator+=(long num) { concat(num); return *this; }
+        String &operator+=(unsigned long num) { concat(num); return *this; }
+        String &operator+=(const __FlashStringHelper *str) { concat(str); return *this; }
+
+        friend StringSumHelper &operator+(const StringSumHelper &lhs, const String &rhs);
+        friend StringSumHelper &operator+(const StringSumHelper &lhs, const char *cstr);
+        friend StringSumHelper &operator+(const StringSumHelper &lhs, char c);
+        friend StringSumHelper &operator+(const StringSumHelper &lhs, int num);
+        friend StringSumHelper &operator+(const StringSumHelper &lhs, unsigned int num);
+        friend StringSumHelper &operator+(const StringSumHelper &lhs, long num);
+        friend StringSumHelper &operator+(const StringSumHelper &lhs, unsigned long num);
+        friend StringSumHelper &operator+(const StringSumHelper &lhs, const __FlashStringHelper *rhs);
+
+        int compareTo(const String &s) const;
+        bool equals(const String &s) const;
+        bool equals(const char *cstr) const;
+        bool equalsIgnoreCase(const String &s) const;
+        bool operator==(const String &rhs) const { return equals(rhs); }
+        bool operator==(const char *cstr) const { return equals(cstr); }
+        bool operator==(const __FlashStringHelper *rhs) const { return equals(reinterpret_cast<const char *>(rhs)); }
+        bool operator!=(const String &rhs) const { return !equals(rhs); }
+        bool operator!=(const char *cstr) const { return !equals(cstr); }
+        bool operator<(const String &rhs) const { return compareTo(rhs) < 0; }
+        bool startsWith(const String &prefix) const;
+        bool startsWith(const String &prefix, unsigned int offset) const;
+        bool endsWith(const String &suffix) const;
+
+        char charAt(unsigned int index) const;
+        char operator[](unsigned int index) const { return charAt(index); }
+        char &operator[](unsigned int index);
+        void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const;
+
+        int indexOf(char ch, unsigned int fromIndex = 0) const;
+        int indexOf(const String &str, unsigned int fromIndex = 0) const;
+        int lastIndexOf(char ch) const;
+        int lastIndexOf(const String &str) const;
+        String substring(unsigned int beginIndex) const { return substring(beginIndex, len); }
+        String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+        void replace(const String &find, const String &replace);
+        void remove(unsigned int index);
+        void remove(unsigned int index, unsigned int count);
+        void toLowerCase();
+        void toUpperCase();
+        void trim();
+
+        long toInt() const;
+        float toFloat() const;
+        double toDouble() const;
+};
+
+class StringSumHelper : public String {
+    public:
+        StringSumHelper(const String &s) : String(s) {}
+        StringSumHelper(const char *p) : String(p) {}
+        StringSumHelper(char c) : String(c) {}
+        StringSumHelper(int num) : String(num) {}
+        StringSumHelper(unsigned int num) : String(num) {}
+        StringSumHelper(long num) : String(num) {}
+        StringSumHelper(unsigned long num) : String(num) {}
+};
@@ -0,0 +1,20 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - name lookups (every host resolves to the loopback address)
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <WiFiClient.h>
+
+class WiFiClass {
+    public:
+        int hostByName(const char *host, IPAddress &ip);
+};
+extern WiFiClass WiFi;
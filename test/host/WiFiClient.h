@@ -0,0 +1,44 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - a plain client that is answered from hostNetwork instead of a socket
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <Client.h>
+#include <hostNetwork.h>
+
+class WiFiClient : public Client {
+
+    protected:
+        char request[HOSTNET_MAXREQUEST];
+        size_t requestLength = 0;
+        const hostResponse *response = nullptr;
+        size_t position = 0;
+        bool open = false;
+
+        void dispatch();
+
+    public:
+        int connect(IPAddress ip, uint16_t port);
+        int connect(IPAddress ip, uint16_t port, int32_t timeout);
+        int connect(const char *host, uint16_t port);
+        int connect(const char *host, uint16_t port, int32_t timeout);
+        size_t write(uint8_t c);
+        size_t write(const uint8_t *buffer, size_t size);
+        int available();
+        int read();
+        int read(uint8_t *buffer, size_t size);
+        int peek();
+        void flush() {}
+        void stop();
+        uint8_t connected();
+        operator bool() { return connected(); }
+        int fd() const { return -1; }
+        int setNoDelay(bool noDelay) { return 0; }
+        using Print::write;
+};
@@ -0,0 +1,20 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - the TLS client (no TLS on the host, it is answered like the plain client)
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <WiFiClient.h>
+
+class WiFiClientSecure : public WiFiClient {
+    public:
+        void setInsecure() {}
+        void setHandshakeTimeout(unsigned long handshakeTimeout) {}
+        int connect(IPAddress ip, uint16_t port, const char *host, const char *rootCA, const char *cliCert, const char *cliKey) { return WiFiClient::connect(ip, port); }
+        using WiFiClient::connect;
+};
@@ -0,0 +1,470 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - String, Print/Stream, timing and the ESP32 system calls
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <chrono>
+#include <thread>
+
+EspClass ESP;
+HardwareSerial Serial;
+
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long micros() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield() {}
+
+unsigned int uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    return 4096;
+}
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+size_t strlcpy(char *dst, const char *src, size_t size) {
+    size_t length = strlen(src);
+    if (size) {
+        size_t n = (length < size-1) ? length : size-1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return length;
+}
+
+size_t strlcat(char *dst, const char *src, size_t size) {
+    size_t length = strnlen(dst, size);
+    if (length == size) return size + strlen(src);
+    return length + strlcpy(dst + length, src, size - length);
+}
+#endif
+
+//
+// String
+//
+String::String(const char *cstr) {
+    if (cstr) copy(cstr, strlen(cstr));
+}
+
+String::String(const char *cstr, unsigned int length) {
+    if (cstr) copy(cstr, length);
+}
+
+String::String(const String &str) {
+    copy(str.buffer(), str.len);
+}
+
+String::String(String &&rval) {
+    move(rval);
+}
+
+String::String(const __FlashStringHelper *str) : String(reinterpret_cast<const char *>(str)) {}
+
+String::String(char c) {
+    char buf[2] = {c, '\0'};
+    copy(buf, 1);
+}
+
+static const char *formatNumber(char *buf, unsigned long long value, bool negative, unsigned char base) {
+    char *p = buf + 67;
+    *p = '\0';
+    if (base < 2) base = 10;
+    do {
+        int digit = value % base;
+        *--p = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        value /= base;
+    } while (value);
+    if (negative) *--p = '-';
+    return p;
+}
+
+String::String(unsigned char value, unsigned char base) : String((unsigned long long)value, base) {}
+String::String(int value, unsigned char base) : String((long long)value, base) {}
+String::String(unsigned int value, unsigned char base) : String((unsigned long long)value, base) {}
+String::String(long value, unsigned char base) : String((long long)value, base) {}
+String::String(unsigned long value, unsigned char base) : String((unsigned long long)value, base) {}
+
+String::String(long long value, unsigned char base) {
+    char buf[68];
+    bool negative = (value < 0 && base == 10);
+    const char *digits = formatNumber(buf, negative ? -(unsigned long long)value : (unsigned long long)value, negative, base);
+    copy(digits, strlen(digits));
+}
+
+String::String(unsigned long long value, unsigned char base) {
+    char buf[68];
+    const char *digits = formatNumber(buf, value, false, base);
+    copy(digits, strlen(digits));
+}
+
+String::String(float value, unsigned int decimalPlaces) : String((double)value, decimalPlaces) {}
+
+String::String(double value, unsigned int decimalPlaces) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimalPlaces, value);
+    copy(buf, strlen(buf));
+}
+
+String::~String() {
+    free(heap);
+}
+
+// As the ESP32 core: inline below the SSO size, otherwise a heap buffer rounded up to 16 bytes
+bool String::changeBuffer(unsigned int maxStrLen) {
+    if (maxStrLen < STRING_SSOSIZE - 1) {
+        if (heap) {
+            memcpy(sso, heap, len + 1);
+            free(heap);
+            heap = nullptr;
+            cap = 0;
+        }
+        return true;
+    }
+    size_t newSize = (maxStrLen + 16) & ~0xf;
+    char *newBuffer;
+    if (heap) {
+        newBuffer = (char *)realloc(heap, newSize);
+    } else {
+        newBuffer = (char *)malloc(newSize);
+        if (newBuffer) memcpy(newBuffer, sso, len + 1);
+    }
+    if (!newBuffer) return false;
+    heap = newBuffer;
+    cap = newSize - 1;
+    return true;
+}
+
+bool String::reserve(unsigned int size) {
+    if (size <= (heap ? cap : STRING_SSOSIZE - 1)) return true;
+    return changeBuffer(size);
+}
+
+String &String::copy(const char *cstr, unsigned int length) {
+    if (!reserve(length)) return *this;
+    memmove(buffer(), cstr, length);
+    len = length;
+    buffer()[len] = '\0';
+    return *this;
+}
+
+void String::move(String &rhs) {
+    free(heap);
+    heap = rhs.heap;
+    cap = rhs.cap;
+    len = rhs.len;
+    memcpy(sso, rhs.sso, sizeof(sso));
+    rhs.heap = nullptr;
+    rhs.cap = 0;
+    rhs.len = 0;
+    rhs.sso[0] = '\0';
+}
+
+String &String::operator=(const String &rhs) {
+    if (this != &rhs) copy(rhs.buffer(), rhs.len);
+    return *this;
+}
+
+String &String::operator=(String &&rval) {
+    if (this != &rval) move(rval);
+    return *this;
+}
+
+String &String::operator=(const char *cstr) {
+    if (cstr) copy(cstr, strlen(cstr));
+    else len = 0, buffer()[0] = '\0';
+    return *this;
+}
+
+String &String::operator=(const __FlashStringHelper *str) {
+    return *this = reinterpret_cast<const char *>(str);
+}
+
+bool String::concat(const char *cstr, unsigned int length) {
+    if (!cstr) return false;
+    if (!length) return true;
+    unsigned int newLength = len + length;
+    if (cstr >= buffer() && cstr < buffer() + len) {
+        // Appending part of ourselves, the buffer may move
+        unsigned int offset = cstr - buffer();
+        if (!reserve(newLength)) return false;
+        cstr = buffer() + offset;
+    } else if (!reserve(newLength)) return false;
+    memmove(buffer() + len, cstr, length);
+    len = newLength;
+    buffer()[len] = '\0';
+    return true;
+}
+
+bool String::concat(const String &str) { return concat(str.buffer(), str.len); }
+bool String::concat(const char *cstr) { return cstr ? concat(cstr, strlen(cstr)) : false; }
+bool String::concat(char c) { return concat(&c, 1); }
+bool String::concat(int num) { return concat(String(num)); }
+bool String::concat(unsigned int num) { return concat(String(num)); }
+bool String::concat(long num) { return concat(String(num)); }
+bool String::concat(unsigned long num) { return concat(String(num)); }
+bool String::concat(const __FlashStringHelper *str) { return concat(reinterpret_cast<const char *>(str)); }
+
+StringSumHelper &operator+(const StringSumHelper &lhs, const String &rhs) {
+    StringSumHelper &a = const_cast<StringSumHelper &>(lhs);
+    a.concat(rhs);
+    return a;
+}
+
+StringSumHelper &operator+(const StringSumHelper &lhs, const char *cstr) {
+    StringSumHelper &a = const_cast<StringSumHelper &>(lhs);
+    a.concat(cstr);
+    return a;
+}
+
+StringSumHelper &operator+(const StringSumHelper &lhs, char c) {
+    StringSumHelper &a = const_cast<StringSumHelper &>(lhs);
+    a.concat(c);
+    return a;
+}
+
+StringSumHelper &operator+(const StringSumHelper &lhs, int num) {
+    StringSumHelper &a = const_cast<StringSumHelper &>(lhs);
+    a.concat(num);
+    return a;
+}
+
+StringSumHelper &operator+(const StringSumHelper &lhs, unsigned int num) {
+    StringSumHelper &a = const_cast<StringSumHelper &>(lhs);
+    a.concat(num);
+    return a;
+}
+
+StringSumHelper &operator+(const StringSumHelper &lhs, long num) {
+    StringSumHelper &a = const_cast<StringSumHelper &>(lhs);
+    a.concat(num);
+    return a;
+}
+
+StringSumHelper &operator+(const StringSumHelper &lhs, unsigned long num) {
+    StringSumHelper &a = const_cast<StringSumHelper &>(lhs);
+    a.concat(num);
+    return a;
+}
+
+StringSumHelper &operator+(const StringSumHelper &lhs, const __FlashStringHelper *rhs) {
+    StringSumHelper &a = const_cast<StringSumHelper &>(lhs);
+    a.concat(rhs);
+    return a;
+}
+
+int String::compareTo(const String &s) const {
+    return strcmp(buffer(), s.buffer());
+}
+
+bool String::equals(const String &s) const {
+    return len == s.len && !strcmp(buffer(), s.buffer());
+}
+
+bool String::equals(const char *cstr) const {
+    return cstr ? !strcmp(buffer(), cstr) : len == 0;
+}
+
+bool String::equalsIgnoreCase(const String &s) const {
+    return len == s.len && !strcasecmp(buffer(), s.buffer());
+}
+
+bool String::startsWith(const String &prefix) const {
+    return len >= prefix.len && startsWith(prefix, 0);
+}
+
+bool String::startsWith(const String &prefix, unsigned int offset) const {
+    if (offset > len || prefix.len > len - offset) return false;
+    return !strncmp(buffer() + offset, prefix.buffer(), prefix.len);
+}
+
+bool String::endsWith(const String &suffix) const {
+    if (len < suffix.len) return false;
+    return !strcmp(buffer() + len - suffix.len, suffix.buffer());
+}
+
+char String::charAt(unsigned int index) const {
+    return index < len ? buffer()[index] : '\0';
+}
+
+char &String::operator[](unsigned int index) {
+    static char dummy;
+    if (index >= len) {
+        dummy = '\0';
+        return dummy;
+    }
+    return buffer()[index];
+}
+
+void String::toCharArray(char *buf, unsigned int bufsize, unsigned int index) const {
+    if (!bufsize || !buf) return;
+    if (index >= len) {
+        buf[0] = '\0';
+        return;
+    }
+    unsigned int n = bufsize - 1;
+    if (n > len - index) n = len - index;
+    memcpy(buf, buffer() + index, n);
+    buf[n] = '\0';
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const {
+    if (fromIndex >= len) return -1;
+    const char *found = strchr(buffer() + fromIndex, ch);
+    return found ? found - buffer() : -1;
+}
+
+int String::indexOf(const String &str, unsigned int fromIndex) const {
+    if (fromIndex >= len) return -1;
+    const char *found = strstr(buffer() + fromIndex, str.buffer());
+    return found ? found - buffer() : -1;
+}
+
+int String::lastIndexOf(char ch) const {
+    const char *found = strrchr(buffer(), ch);
+    return found ? found - buffer() : -1;
+}
+
+int String::lastIndexOf(const String &str) const {
+    int found = -1;
+    for (int i = indexOf(str); i >= 0; i = indexOf(str, i + 1)) found = i;
+    return found;
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+    if (beginIndex > endIndex) std::swap(beginIndex, endIndex);
+    if (beginIndex >= len) return String();
+    if (endIndex > len) endIndex = len;
+    return String(buffer() + beginIndex, endIndex - beginIndex);
+}
+
+void String::replace(const String &find, const String &replace) {
+    if (!len || !find.len) return;
+    String result;
+    const char *start = buffer();
+    const char *found;
+    while ((found = strstr(start, find.buffer())) != nullptr) {
+        result.concat(start, found - start);
+        result.concat(replace);
+        start = found + find.len;
+    }
+    result.concat(start);
+    *this = std::move(result);
+}
+
+void String::remove(unsigned int index) {
+    remove(index, (unsigned int)-1);
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index >= len) return;
+    if (count > len - index) count = len - index;
+    char *writeTo = buffer() + index;
+    memmove(writeTo, writeTo + count, len - index - count + 1);
+    len -= count;
+}
+
+void String::toLowerCase() {
+    for (char *p = buffer(); *p; p++) *p = tolower((unsigned char)*p);
+}
+
+void String::toUpperCase() {
+    for (char *p = buffer(); *p; p++) *p = toupper((unsigned char)*p);
+}
+
+void String::trim() {
+    if (!len) return;
+    char *begin = buffer();
+    while (isspace((unsigned char)*begin)) begin++;
+    char *end = buffer() + len - 1;
+    while (end >= begin && isspace((unsigned char)*end)) end--;
+    len = end + 1 - begin;
+    if (begin > buffer()) memmove(buffer(), begin, len);
+    buffer()[len] = '\0';
+}
+
+long String::toInt() const { return atol(buffer()); }
+float String::toFloat() const { return atof(buffer()); }
+double String::toDouble() const { return atof(buffer()); }
+
+//
+// Print and Stream
+//
+size_t Print::write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+}
+
+size_t Print::write(const char *str) {
+    return str ? write((const uint8_t *)str, strlen(str)) : 0;
+}
+
+size_t Print::print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+size_t Print::print(const char *str) { return write(str); }
+size_t Print::print(const __FlashStringHelper *str) { return write(reinterpret_cast<const char *>(str)); }
+size_t Print::print(long value) { return print(String(value)); }
+size_t Print::println(const String &s) { return print(s) + println(); }
+size_t Print::println(const char *str) { return print(str) + println(); }
+size_t Print::println() { return write("\r\n"); }
+
+size_t Print::printf(const char *format, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (n < 0) return 0;
+    return write((const uint8_t *)buf, (size_t)n < sizeof(buf) ? n : sizeof(buf) - 1);
+}
+
+size_t Stream::readBytes(char *buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = read();
+        if (c < 0) break;
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+String Stream::readString() {
+    String ret;
+    int c;
+    while ((c = read()) >= 0) ret += (char)c;
+    return ret;
+}
+
+// One character at a time, as the core does
+String Stream::readStringUntil(char terminator) {
+    String ret;
+    int c = read();
+    while (c >= 0 && c != terminator) {
+        ret += (char)c;
+        c = read();
+    }
+    return ret;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+    return fwrite(buffer, 1, size, stdout);
+}
@@ -0,0 +1,128 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - clients answered from memory, name lookups and the (empty) file system
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostNetwork.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <LittleFS.h>
+
+WiFiClass WiFi;
+fs::FS LittleFS;
+
+unsigned long hostConnects = 0;
+unsigned long hostRequests = 0;
+unsigned long long hostBytesRead = 0;
+static hostResponder responder = nullptr;
+
+void hostSetResponder(hostResponder r) {
+    responder = r;
+}
+
+String IPAddress::toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return String(buf);
+}
+
+int WiFiClass::hostByName(const char *host, IPAddress &ip) {
+    if (!host || !host[0]) return 0;
+    ip = IPAddress(127, 0, 0, 1);
+    return 1;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) {
+    stop();
+    open = true;
+    hostConnects++;
+    return 1;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port, int32_t timeout) {
+    return connect(ip, port);
+}
+
+int WiFiClient::connect(const char *host, uint16_t port) {
+    return connect(IPAddress(127, 0, 0, 1), port);
+}
+
+int WiFiClient::connect(const char *host, uint16_t port, int32_t timeout) {
+    return connect(host, port);
+}
+
+void WiFiClient::stop() {
+    open = false;
+    response = nullptr;
+    position = 0;
+    requestLength = 0;
+}
+
+//
+// Collect the request, and once the headers and any body have arrived look up the response to play back
+//
+size_t WiFiClient::write(const uint8_t *buffer, size_t size) {
+    if (!open || response || requestLength + size >= sizeof(request)) return 0;
+    memcpy(request + requestLength, buffer, size);
+    requestLength += size;
+    request[requestLength] = '\0';
+    dispatch();
+    return size;
+}
+
+size_t WiFiClient::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+void WiFiClient::dispatch() {
+    const char *headersEnd = strstr(request, "\r\n\r\n");
+    if (!headersEnd) return;
+    size_t headerLength = headersEnd + 4 - request;
+    const char *contentLength = strcasestr(request, "\r\nContent-Length:");
+    if (contentLength && contentLength < headersEnd && requestLength < headerLength + (size_t)atol(contentLength + 17)) return;
+
+    response = responder ? responder(request, requestLength) : nullptr;
+    position = 0;
+    requestLength = 0;
+    if (response) hostRequests++;
+    else open = false;
+}
+
+int WiFiClient::available() {
+    if (!response) return 0;
+    size_t remaining = response->length - position;
+    return remaining > HOSTNET_SEGMENT ? HOSTNET_SEGMENT : (int)remaining;
+}
+
+int WiFiClient::read() {
+    if (!response || position >= response->length) return -1;
+    hostBytesRead++;
+    return (uint8_t)response->data[position++];
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size) {
+    int bytes = available();
+    if (bytes <= 0) return -1;
+    if ((size_t)bytes > size) bytes = size;
+    memcpy(buffer, response->data + position, bytes);
+    position += bytes;
+    hostBytesRead += bytes;
+    return bytes;
+}
+
+int WiFiClient::peek() {
+    if (!response || position >= response->length) return -1;
+    return (uint8_t)response->data[position];
+}
+
+// Connected until the whole response has been read, then the server closes it
+uint8_t WiFiClient::connected() {
+    if (open && response && position >= response->length) open = false;
+    return open;
+}
@@ -0,0 +1,31 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - answers client requests from memory. The benchmark installs a responder which is called
+ * with each complete request and returns the recorded response to play back. The server closes the connection
+ * once the response has been read, so a keep-alive client reconnects for its next request.
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+#pragma once
+#include <stddef.h>
+
+#define HOSTNET_MAXREQUEST 2048     // Largest request a client can send
+#define HOSTNET_SEGMENT 1460        // Most bytes available() reports at once (one TCP segment)
+
+struct hostResponse {
+    const char *data;
+    size_t length;
+};
+
+// Returns the response to a request, or nullptr to drop the connection without one
+typedef const hostResponse *(*hostResponder)(const char *request, size_t length);
+
+void hostSetResponder(hostResponder responder);
+
+extern unsigned long hostConnects;      // Connections made
+extern unsigned long hostRequests;      // Requests answered
+extern unsigned long long hostBytesRead;   // Response bytes read by the clients
@@ -0,0 +1,28 @@
+/*
+ * Tiny Departures Board (c) 2026 Gadec Software
+ *
+ * Host build shim - stand-ins for the libraries that need the file system or ArduinoJson. Requests are
+ * counted against the quota but never refused.
+ *
+ * https://github.com/gadec-uk/tiny-departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <apiQuota.h>
+#include <md5Utils.h>
+
+apiQuota quota;
+
+apiQuota::apiQuota() {
+    memset(budgets, 0, sizeof(budgets));
+}
+
+bool apiQuota::consume(int api) {
+    if (api < 0 || api >= QUOTA_APIS) return true;
+    budgets[api].total++;
+    return true;
+}
+
+md5Utils::md5Utils() {}